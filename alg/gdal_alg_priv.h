@@ -20,7 +20,10 @@
 
 #include <cstdint>
 
+#include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "gdal_alg.h"
 #include "ogr_spatialref.h"
@@ -194,6 +197,20 @@ bool GDALTransformIsAffineNoRotation(GDALTransformerFunc pfnTransformer,
 
 bool GDALTransformHasFastClone(void *pTransformerArg);
 
+/* Cache of transformed coordinates (GDAL_WARP_TRANSFORM_CACHE_SIZE) */
+
+size_t GDALWarpTransformCacheGetMaxSize();
+
+std::string GDALWarpTransformCacheGetKey(GDALTransformerFunc pfnTransformer,
+                                         void *pTransformerArg);
+
+std::shared_ptr<const std::vector<double>>
+GDALWarpTransformCacheGet(const std::string &osKey);
+
+void GDALWarpTransformCachePut(
+    const std::string &osKey,
+    std::shared_ptr<const std::vector<double>> poValues);
+
 typedef struct _CPLQuadTree CPLQuadTree;
 
 typedef struct
@@ -203,6 +220,9 @@ typedef struct
     bool bReversed;
     double dfOversampleFactor;
 
+    // Number of threads used to generate the backmap.
+    int nNumThreads;
+
     // Map from target georef coordinates back to geolocation array
     // pixel line coordinates.  Built only if needed.
     int nBackMapWidth;
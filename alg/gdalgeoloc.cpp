@@ -27,6 +27,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -36,6 +39,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "memdataset.h"
 
 constexpr float INVALID_BMXY = -10.0f;
@@ -1142,12 +1146,6 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         }
     };
 
-    // Keep those objects in this outer scope, so they are re-used, to
-    // save memory allocations.
-    OGRPoint oPoint;
-    OGRLinearRing oRing;
-    oRing.setNumPoints(5);
-
     /* -------------------------------------------------------------------- */
     /*      Run through the whole geoloc array forward projecting and       */
     /*      pushing into the backmap.                                       */
@@ -1205,220 +1203,366 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         xStartEnd[iXBlock].second = dfX + dfStep / 10;
     }
 
-    for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+    // Outcome of the processing of a sample (dfX, dfY) of the geolocation
+    // array. It only depends on the geolocation array, and not on the
+    // current state of the backmap, so that it can be computed by worker
+    // threads, whereas the backmap is updated in the sample order.
+    struct BackMapSample
     {
-        for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
+        enum Kind : GByte
         {
-#if 0
-        CPLDebug("Process geoloc block (y=%d,x=%d) for y in [%f, %f] and x in [%f, %f]",
-                 iYBlock, iXBlock,
-                 yStartEnd[iYBlock].first, yStartEnd[iYBlock].second,
-                 xStartEnd[iXBlock].first, xStartEnd[iXBlock].second);
-#endif
-            for (double dfY = yStartEnd[iYBlock].first;
-                 dfY < yStartEnd[iYBlock].second; dfY += dfStep)
-            {
-                for (double dfX = xStartEnd[iXBlock].first;
-                     dfX < xStartEnd[iXBlock].second; dfX += dfStep)
-                {
-                    // Use forward geolocation array interpolation to compute
-                    // the georeferenced position corresponding to (dfX, dfY)
-                    double dfGeoLocX;
-                    double dfGeoLocY;
-                    if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX,
-                                       dfGeoLocY))
-                        continue;
+            SKIP,        // no update of the backmap
+            EXACT,       // backmap cell set to (dfA, dfB) with weight 1
+            ACCUMULATE,  // sample at backmap position (dfA, dfB) accumulated
+                         // on its 4 neighbouring cells
+        };
+
+        Kind eKind = SKIP;
+        int iBMX = 0;
+        int iBMY = 0;
+        double dfA = 0;
+        double dfB = 0;
+    };
 
-                    // Compute the floating point coordinates in the pixel space
-                    // of the backmap
-                    const double dBMX = static_cast<double>(
-                        (dfGeoLocX - dfMinX) / dfPixelXSize);
+    const auto ProcessSample = [&](double dfX, double dfY, OGRPoint &oPoint,
+                                   OGRLinearRing &oRing,
+                                   BackMapSample &sSample)
+    {
+        sSample.eKind = BackMapSample::SKIP;
 
-                    const double dBMY = static_cast<double>(
-                        (dfMaxY - dfGeoLocY) / dfPixelYSize);
+        // Use forward geolocation array interpolation to compute
+        // the georeferenced position corresponding to (dfX, dfY)
+        double dfGeoLocX;
+        double dfGeoLocY;
+        if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX, dfGeoLocY))
+            return;
 
-                    // Get top left index by truncation
-                    const int iBMX = static_cast<int>(std::floor(dBMX));
-                    const int iBMY = static_cast<int>(std::floor(dBMY));
+        // Compute the floating point coordinates in the pixel space
+        // of the backmap
+        const double dBMX =
+            static_cast<double>((dfGeoLocX - dfMinX) / dfPixelXSize);
 
-                    if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 &&
-                        iBMY < nBMYSize)
-                    {
-                        // Compute the georeferenced position of the top-left
-                        // index of the backmap
-                        double dfGeoX = dfMinX + iBMX * dfPixelXSize;
-                        const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
+        const double dBMY =
+            static_cast<double>((dfMaxY - dfGeoLocY) / dfPixelYSize);
+
+        // Get top left index by truncation
+        const int iBMX = static_cast<int>(std::floor(dBMX));
+        const int iBMY = static_cast<int>(std::floor(dBMY));
+
+        if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 && iBMY < nBMYSize)
+        {
+            // Compute the georeferenced position of the top-left
+            // index of the backmap
+            double dfGeoX = dfMinX + iBMX * dfPixelXSize;
+            const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
+
+            bool bMatchingGeoLocCellFound = false;
 
-                        bool bMatchingGeoLocCellFound = false;
+            const int nOuterIters =
+                psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+                        fabs(dfGeoX) >= 180
+                    ? 2
+                    : 1;
 
-                        const int nOuterIters =
-                            psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-                                    fabs(dfGeoX) >= 180
-                                ? 2
-                                : 1;
+            for (int iOuterIter = 0; iOuterIter < nOuterIters; ++iOuterIter)
+            {
+                if (iOuterIter == 1 && dfGeoX >= 180)
+                    dfGeoX -= 360;
+                else if (iOuterIter == 1 && dfGeoX <= -180)
+                    dfGeoX += 360;
+
+                // Identify a cell (quadrilateral in georeferenced
+                // space) in the geolocation array in which dfGeoX,
+                // dfGeoY falls into.
+                oPoint.setX(dfGeoX);
+                oPoint.setY(dfGeoY);
+                const int nX = static_cast<int>(std::floor(dfX));
+                const int nY = static_cast<int>(std::floor(dfY));
+                for (int sx = -1; !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                {
+                    for (int sy = -1; !bMatchingGeoLocCellFound && sy <= 0;
+                         sy++)
+                    {
+                        const int pixel = nX + sx;
+                        const int line = nY + sy;
+                        double x0, y0, x1, y1, x2, y2, x3, y3;
+                        if (!PixelLineToXY(psTransform, pixel, line, x0, y0) ||
+                            !PixelLineToXY(psTransform, pixel + 1, line, x2,
+                                           y2) ||
+                            !PixelLineToXY(psTransform, pixel, line + 1, x1,
+                                           y1) ||
+                            !PixelLineToXY(psTransform, pixel + 1, line + 1,
+                                           x3, y3))
+                        {
+                            break;
+                        }
 
-                        for (int iOuterIter = 0; iOuterIter < nOuterIters;
-                             ++iOuterIter)
+                        int nIters = 1;
+                        if (psTransform
+                                ->bGeographicSRSWithMinus180Plus180LongRange &&
+                            std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
+                            std::fabs(x2) > 170 && std::fabs(x3) > 170 &&
+                            (std::fabs(x1 - x0) > 180 ||
+                             std::fabs(x2 - x0) > 180 ||
+                             std::fabs(x3 - x0) > 180))
+                        {
+                            nIters = 2;
+                            if (x0 > 0)
+                                x0 -= 360;
+                            if (x1 > 0)
+                                x1 -= 360;
+                            if (x2 > 0)
+                                x2 -= 360;
+                            if (x3 > 0)
+                                x3 -= 360;
+                        }
+                        for (int iIter = 0; iIter < nIters; ++iIter)
                         {
-                            if (iOuterIter == 1 && dfGeoX >= 180)
-                                dfGeoX -= 360;
-                            else if (iOuterIter == 1 && dfGeoX <= -180)
-                                dfGeoX += 360;
-
-                            // Identify a cell (quadrilateral in georeferenced
-                            // space) in the geolocation array in which dfGeoX,
-                            // dfGeoY falls into.
-                            oPoint.setX(dfGeoX);
-                            oPoint.setY(dfGeoY);
-                            const int nX = static_cast<int>(std::floor(dfX));
-                            const int nY = static_cast<int>(std::floor(dfY));
-                            for (int sx = -1;
-                                 !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                            if (iIter == 1)
+                            {
+                                x0 += 360;
+                                x1 += 360;
+                                x2 += 360;
+                                x3 += 360;
+                            }
+
+                            oRing.setPoint(0, x0, y0);
+                            oRing.setPoint(1, x2, y2);
+                            oRing.setPoint(2, x3, y3);
+                            oRing.setPoint(3, x1, y1);
+                            oRing.setPoint(4, x0, y0);
+                            if (oRing.isPointInRing(&oPoint) ||
+                                oRing.isPointOnRingBoundary(&oPoint))
                             {
-                                for (int sy = -1;
-                                     !bMatchingGeoLocCellFound && sy <= 0; sy++)
-                                {
-                                    const int pixel = nX + sx;
-                                    const int line = nY + sy;
-                                    double x0, y0, x1, y1, x2, y2, x3, y3;
-                                    if (!PixelLineToXY(psTransform, pixel, line,
-                                                       x0, y0) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line, x2, y2) ||
-                                        !PixelLineToXY(psTransform, pixel,
-                                                       line + 1, x1, y1) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line + 1, x3, y3))
-                                    {
-                                        break;
-                                    }
-
-                                    int nIters = 1;
-                                    if (psTransform
-                                            ->bGeographicSRSWithMinus180Plus180LongRange &&
-                                        std::fabs(x0) > 170 &&
-                                        std::fabs(x1) > 170 &&
-                                        std::fabs(x2) > 170 &&
-                                        std::fabs(x3) > 170 &&
-                                        (std::fabs(x1 - x0) > 180 ||
-                                         std::fabs(x2 - x0) > 180 ||
-                                         std::fabs(x3 - x0) > 180))
-                                    {
-                                        nIters = 2;
-                                        if (x0 > 0)
-                                            x0 -= 360;
-                                        if (x1 > 0)
-                                            x1 -= 360;
-                                        if (x2 > 0)
-                                            x2 -= 360;
-                                        if (x3 > 0)
-                                            x3 -= 360;
-                                    }
-                                    for (int iIter = 0; iIter < nIters; ++iIter)
-                                    {
-                                        if (iIter == 1)
-                                        {
-                                            x0 += 360;
-                                            x1 += 360;
-                                            x2 += 360;
-                                            x3 += 360;
-                                        }
-
-                                        oRing.setPoint(0, x0, y0);
-                                        oRing.setPoint(1, x2, y2);
-                                        oRing.setPoint(2, x3, y3);
-                                        oRing.setPoint(3, x1, y1);
-                                        oRing.setPoint(4, x0, y0);
-                                        if (oRing.isPointInRing(&oPoint) ||
-                                            oRing.isPointOnRingBoundary(
-                                                &oPoint))
-                                        {
-                                            bMatchingGeoLocCellFound = true;
-                                            double dfBMXValue = pixel;
-                                            double dfBMYValue = line;
-                                            GDALInverseBilinearInterpolation(
-                                                dfGeoX, dfGeoY, x0, y0, x1, y1,
-                                                x2, y2, x3, y3, dfBMXValue,
-                                                dfBMYValue);
-
-                                            dfBMXValue =
-                                                (dfBMXValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfPIXEL_STEP +
-                                                psTransform->dfPIXEL_OFFSET;
-                                            dfBMYValue =
-                                                (dfBMYValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfLINE_STEP +
-                                                psTransform->dfLINE_OFFSET;
-
-                                            pAccessors->backMapXAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMXValue));
-                                            pAccessors->backMapYAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMYValue));
-                                            pAccessors->backMapWeightAccessor
-                                                .Set(iBMX, iBMY, 1.0f);
-                                        }
-                                    }
-                                }
+                                bMatchingGeoLocCellFound = true;
+                                double dfBMXValue = pixel;
+                                double dfBMYValue = line;
+                                GDALInverseBilinearInterpolation(
+                                    dfGeoX, dfGeoY, x0, y0, x1, y1, x2, y2, x3,
+                                    y3, dfBMXValue, dfBMYValue);
+
+                                sSample.eKind = BackMapSample::EXACT;
+                                sSample.iBMX = iBMX;
+                                sSample.iBMY = iBMY;
+                                sSample.dfA =
+                                    (dfBMXValue + dfGeorefConventionOffset) *
+                                        psTransform->dfPIXEL_STEP +
+                                    psTransform->dfPIXEL_OFFSET;
+                                sSample.dfB =
+                                    (dfBMYValue + dfGeorefConventionOffset) *
+                                        psTransform->dfLINE_STEP +
+                                    psTransform->dfLINE_OFFSET;
                             }
                         }
-                        if (bMatchingGeoLocCellFound)
-                            continue;
                     }
+                }
+            }
+            if (bMatchingGeoLocCellFound)
+                return;
+        }
 
-                    // We will end up here in non-nominal cases, with nodata,
-                    // holes, etc.
+        // We will end up here in non-nominal cases, with nodata,
+        // holes, etc.
 
-                    // Check if the center is in range
-                    if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize ||
-                        iBMY > nBMYSize)
-                        continue;
+        // Check if the center is in range
+        if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize || iBMY > nBMYSize)
+            return;
 
-                    const double fracBMX = dBMX - iBMX;
-                    const double fracBMY = dBMY - iBMY;
+        sSample.eKind = BackMapSample::ACCUMULATE;
+        sSample.iBMX = iBMX;
+        sSample.iBMY = iBMY;
+        sSample.dfA = dBMX;
+        sSample.dfB = dBMY;
+    };
 
-                    // Check logic for top left pixel
-                    if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
-                    }
+    const auto ApplySample = [&](double dfX, double dfY,
+                                 const BackMapSample &sSample)
+    {
+        const int iBMX = sSample.iBMX;
+        const int iBMY = sSample.iBMY;
+        if (sSample.eKind == BackMapSample::EXACT)
+        {
+            pAccessors->backMapXAccessor.Set(iBMX, iBMY,
+                                             static_cast<float>(sSample.dfA));
+            pAccessors->backMapYAccessor.Set(iBMX, iBMY,
+                                             static_cast<float>(sSample.dfB));
+            pAccessors->backMapWeightAccessor.Set(iBMX, iBMY, 1.0f);
+            return;
+        }
+        if (sSample.eKind != BackMapSample::ACCUMULATE)
+            return;
 
-                    // Check logic for top right pixel
-                    if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = fracBMX * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
-                    }
+        const double fracBMX = sSample.dfA - iBMX;
+        const double fracBMY = sSample.dfB - iBMY;
 
-                    // Check logic for bottom right pixel
-                    if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1,
-                                                              iBMY + 1) != 1.0f)
-                    {
-                        const double tempwt = fracBMX * fracBMY;
-                        UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
-                    }
+        // Check logic for top left pixel
+        if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
+            (iBMY < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
+            UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
+        }
 
-                    // Check logic for bottom left pixel
-                    if ((iBMX >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * fracBMY;
-                        UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
-                    }
+        // Check logic for top right pixel
+        if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) && (iBMY < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) != 1.0f)
+        {
+            const double tempwt = fracBMX * (1.0 - fracBMY);
+            UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom right pixel
+        if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = fracBMX * fracBMY;
+            UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom left pixel
+        if ((iBMX >= 0) && (iBMX < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * fracBMY;
+            UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
+        }
+    };
+
+    const auto ForEachSampleOfBlock =
+        [&yStartEnd, &xStartEnd, dfStep](int iYBlock, int iXBlock, auto &&func)
+    {
+#if 0
+        CPLDebug("Process geoloc block (y=%d,x=%d) for y in [%f, %f] and x in [%f, %f]",
+                 iYBlock, iXBlock,
+                 yStartEnd[iYBlock].first, yStartEnd[iYBlock].second,
+                 xStartEnd[iXBlock].first, xStartEnd[iXBlock].second);
+#endif
+        for (double dfY = yStartEnd[iYBlock].first;
+             dfY < yStartEnd[iYBlock].second; dfY += dfStep)
+        {
+            for (double dfX = xStartEnd[iXBlock].first;
+                 dfX < xStartEnd[iXBlock].second; dfX += dfStep)
+            {
+                func(dfX, dfY);
+            }
+        }
+    };
+
+    // Processing of samples may be done by worker threads, provided that the
+    // geolocation arrays are in RAM (the cached pixel accessors of the
+    // dataset-backed storage are not thread-safe).
+    const int nBlocks = nXBlocks * nYBlocks;
+    const int nThreads =
+        std::is_same<Accessors, GDALGeoLocCArrayAccessors>::value
+            ? std::min(psTransform->nNumThreads, nBlocks)
+            : 1;
+    auto poThreadPool = nThreads > 1 ? GDALGetGlobalThreadPool(nThreads)
+                                     : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poJobQueue)
+    {
+        CPLDebug("GEOLOC", "Using %d threads for backmap generation",
+                 nThreads);
+
+        std::vector<size_t> anYSamples(nYBlocks);
+        for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+        {
+            for (double dfY = yStartEnd[iYBlock].first;
+                 dfY < yStartEnd[iYBlock].second; dfY += dfStep)
+            {
+                ++anYSamples[iYBlock];
+            }
+        }
+        std::vector<size_t> anXSamples(nXBlocks);
+        for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
+        {
+            for (double dfX = xStartEnd[iXBlock].first;
+                 dfX < xStartEnd[iXBlock].second; dfX += dfStep)
+            {
+                ++anXSamples[iXBlock];
+            }
+        }
+
+        // Process batches of nThreads blocks: samples of each block are
+        // processed by a worker thread, and the backmap is then updated
+        // from them in the same order as in the single-threaded case, so
+        // that the result does not depend on the number of threads.
+        std::vector<std::vector<BackMapSample>> aasSamples(nThreads);
+        for (int iBlockStart = 0; iBlockStart < nBlocks;
+             iBlockStart += nThreads)
+        {
+            const int nBatchSize = std::min(nThreads, nBlocks - iBlockStart);
+            for (int i = 0; i < nBatchSize; ++i)
+            {
+                const int iYBlock = (iBlockStart + i) / nXBlocks;
+                const int iXBlock = (iBlockStart + i) % nXBlocks;
+                auto &asSamples = aasSamples[i];
+                try
+                {
+                    asSamples.resize(anYSamples[iYBlock] *
+                                     anXSamples[iXBlock]);
                 }
+                catch (const std::bad_alloc &)
+                {
+                    poJobQueue->WaitCompletion();
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Out of memory in backmap generation");
+                    return false;
+                }
+                poJobQueue->SubmitJob(
+                    [&ProcessSample, &ForEachSampleOfBlock, &asSamples,
+                     iYBlock, iXBlock]()
+                    {
+                        OGRPoint oPoint;
+                        OGRLinearRing oRing;
+                        oRing.setNumPoints(5);
+                        size_t iSample = 0;
+                        ForEachSampleOfBlock(
+                            iYBlock, iXBlock,
+                            [&](double dfX, double dfY)
+                            {
+                                ProcessSample(dfX, dfY, oPoint, oRing,
+                                              asSamples[iSample++]);
+                            });
+                    });
+            }
+            poJobQueue->WaitCompletion();
+
+            for (int i = 0; i < nBatchSize; ++i)
+            {
+                const int iYBlock = (iBlockStart + i) / nXBlocks;
+                const int iXBlock = (iBlockStart + i) % nXBlocks;
+                const auto &asSamples = aasSamples[i];
+                size_t iSample = 0;
+                ForEachSampleOfBlock(iYBlock, iXBlock,
+                                     [&](double dfX, double dfY) {
+                                         ApplySample(dfX, dfY,
+                                                     asSamples[iSample++]);
+                                     });
+            }
+        }
+    }
+    else
+    {
+        // Keep those objects in this outer scope, so they are re-used, to
+        // save memory allocations.
+        OGRPoint oPoint;
+        OGRLinearRing oRing;
+        oRing.setNumPoints(5);
+        BackMapSample sSample;
+
+        for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+        {
+            for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
+            {
+                ForEachSampleOfBlock(iYBlock, iXBlock,
+                                     [&](double dfX, double dfY)
+                                     {
+                                         ProcessSample(dfX, dfY, oPoint, oRing,
+                                                       sSample);
+                                         ApplySample(dfX, dfY, sSample);
+                                     });
             }
         }
     }
@@ -1785,6 +1929,16 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                      CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_OVERSAMPLE_FACTOR",
                                         "1.3")))));
 
+    const char *pszNumThreads = CSLFetchNameValue(papszTransformOptions,
+                                                  "NUM_THREADS");
+    if (pszNumThreads == nullptr)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    psTransform->nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                   ? CPLGetNumCPUs()
+                                   : atoi(pszNumThreads);
+    psTransform->nNumThreads =
+        std::max(1, std::min(128, psTransform->nNumThreads));
+
     memcpy(psTransform->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
     psTransform->sTI.pszClassName = "GDALGeoLocTransformer";
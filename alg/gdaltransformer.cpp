@@ -27,6 +27,7 @@
 #include <algorithm>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -2132,6 +2133,12 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
  * the backmap. The default is NO, that is to use in-memory arrays, unless the
  * number of pixels of the geolocation array is greater than 16 megapixels.
  * </li>
+ * <li> NUM_THREADS=number_of_threads or ALL_CPUS. Number of worker threads
+ * used to solve thin plate spline transformers, and (GDAL &gt;= 3.12) to
+ * generate the backmap of geolocation array transformers when it is stored
+ * in RAM. Defaults to the value of the GDAL_NUM_THREADS configuration option,
+ * or 1.
+ * </li>
  * <li>
  * GEOLOC_ARRAY/SRC_GEOLOC_ARRAY=filename. (GDAL &gt;= 3.5.2) Name of a GDAL
  * dataset containing a geolocation array and associated metadata. This is an
@@ -4051,6 +4058,39 @@ void GDALRefreshApproxTransformer(void *hTransformArg)
 /*                      GDALApproxTransformInternal()                   */
 /************************************************************************/
 
+namespace
+{
+/** Range of points of a row for which the transformed coordinates of the
+ * Start, Middle and End points are known. */
+struct GDALApproxSegment
+{
+    int iStart = 0;
+    int nPoints = 0;
+    // SME = Start, Middle, End.
+    double xSME[3] = {};
+    double ySME[3] = {};
+    double zSME[3] = {};
+};
+
+/** Segment whose interpolation error is above the threshold, and which is
+ * split in two halves. */
+struct GDALApproxSplit
+{
+    GDALApproxSegment sSeg{};
+    bool bUseBaseTransformForHalf1 = false;
+    bool bUseBaseTransformForHalf2 = false;
+    // Index in the batch of points of the first transformed middle point.
+    size_t iFirstMiddle = 0;
+};
+}  // namespace
+
+// Instead of recursing on each half of a segment, which issues one call to
+// the base transformer per segment, the segments are processed level by
+// level: the middle points of all the segments of a level, and the points of
+// the halves that must be transformed exactly, are transformed with a single
+// call to the base transformer. The transformed coordinates are the same
+// as with a depth-first subdivision.
+
 static int GDALApproxTransformInternal(void *pCBData, int bDstToSrc,
                                        int nPoints, double *x, double *y,
                                        double *z, int *panSuccess,
@@ -4061,242 +4101,259 @@ static int GDALApproxTransformInternal(void *pCBData, int bDstToSrc,
 {
     GDALApproxTransformInfo *psATInfo =
         static_cast<GDALApproxTransformInfo *>(pCBData);
-    const int nMiddle = (nPoints - 1) / 2;
+    const double dfMaxError =
+        (bDstToSrc) ? psATInfo->dfMaxErrorReverse : psATInfo->dfMaxErrorForward;
 
-#ifdef notdef_sanify_check
-    {
-        double x2[3] = {x[0], x[nMiddle], x[nPoints - 1]};
-        double y2[3] = {y[0], y[nMiddle], y[nPoints - 1]};
-        double z2[3] = {z[0], z[nMiddle], z[nPoints - 1]};
-        int anSuccess2[3] = {};
-
-        const int bSuccess = psATInfo->pfnBaseTransformer(
-            psATInfo->pBaseCBData, bDstToSrc, 3, x2, y2, z2, anSuccess2);
-        CPLAssert(bSuccess);
-        CPLAssert(anSuccess2[0]);
-        CPLAssert(anSuccess2[1]);
-        CPLAssert(anSuccess2[2]);
-        CPLAssert(x2[0] == xSMETransformed[0]);
-        CPLAssert(y2[0] == ySMETransformed[0]);
-        CPLAssert(z2[0] == zSMETransformed[0]);
-        CPLAssert(x2[1] == xSMETransformed[1]);
-        CPLAssert(y2[1] == ySMETransformed[1]);
-        CPLAssert(z2[1] == zSMETransformed[1]);
-        CPLAssert(x2[2] == xSMETransformed[2]);
-        CPLAssert(y2[2] == ySMETransformed[2]);
-        CPLAssert(z2[2] == zSMETransformed[2]);
+    std::vector<GDALApproxSegment> aoSegments(1);
+    aoSegments[0].nPoints = nPoints;
+    for (int i = 0; i < 3; ++i)
+    {
+        aoSegments[0].xSME[i] = xSMETransformed[i];
+        aoSegments[0].ySME[i] = ySMETransformed[i];
+        aoSegments[0].zSME[i] = zSMETransformed[i];
     }
-#endif
 
-#ifdef DEBUG_APPROX_TRANSFORMER
-    fprintf(stderr, "start (%.3f,%.3f) -> (%.3f,%.3f)\n", /*ok*/
-            x[0], y[0], xSMETransformed[0], ySMETransformed[0]);
-    fprintf(stderr, "middle (%.3f,%.3f) -> (%.3f,%.3f)\n", /*ok*/
-            x[nMiddle], y[nMiddle], xSMETransformed[1], ySMETransformed[1]);
-    fprintf(stderr, "end (%.3f,%.3f) -> (%.3f,%.3f)\n", /*ok*/
-            x[nPoints - 1], y[nPoints - 1], xSMETransformed[2],
-            ySMETransformed[2]);
-#endif
-
-    /* -------------------------------------------------------------------- */
-    /*      Is the error at the middle acceptable relative to an            */
-    /*      interpolation of the middle position?                           */
-    /* -------------------------------------------------------------------- */
-    const double dfDeltaX =
-        (xSMETransformed[2] - xSMETransformed[0]) / (x[nPoints - 1] - x[0]);
-    const double dfDeltaY =
-        (ySMETransformed[2] - ySMETransformed[0]) / (x[nPoints - 1] - x[0]);
-    const double dfDeltaZ =
-        (zSMETransformed[2] - zSMETransformed[0]) / (x[nPoints - 1] - x[0]);
-
-    const double dfError =
-        fabs((xSMETransformed[0] + dfDeltaX * (x[nMiddle] - x[0])) -
-             xSMETransformed[1]) +
-        fabs((ySMETransformed[0] + dfDeltaY * (x[nMiddle] - x[0])) -
-             ySMETransformed[1]);
+    std::vector<GDALApproxSplit> aoSplits;
+    // (start, count) of ranges of points to transform with the base
+    // transformer.
+    std::vector<std::pair<int, int>> anRanges;
+    std::vector<double> adfX;
+    std::vector<double> adfY;
+    std::vector<double> adfZ;
+    std::vector<int> anSuccess;
+    int bRet = TRUE;
 
-    const double dfMaxError =
-        (bDstToSrc) ? psATInfo->dfMaxErrorReverse : psATInfo->dfMaxErrorForward;
-    if (dfError > dfMaxError)
+    while (!aoSegments.empty() || !anRanges.empty())
     {
-#if DEBUG_VERBOSE
-        CPLDebug("GDAL",
-                 "ApproxTransformer - "
-                 "error %g over threshold %g, subdivide %d points.",
-                 dfError, dfMaxError, nPoints);
-#endif
+        adfX.clear();
+        adfY.clear();
+        adfZ.clear();
+        aoSplits.clear();
 
-        double xMiddle[3] = {x[(nMiddle - 1) / 2], x[nMiddle - 1],
-                             x[nMiddle + (nPoints - nMiddle - 1) / 2]};
-        double yMiddle[3] = {y[(nMiddle - 1) / 2], y[nMiddle - 1],
-                             y[nMiddle + (nPoints - nMiddle - 1) / 2]};
-        double zMiddle[3] = {z[(nMiddle - 1) / 2], z[nMiddle - 1],
-                             z[nMiddle + (nPoints - nMiddle - 1) / 2]};
-
-        const bool bUseBaseTransformForHalf1 =
-            nMiddle <= 5 || y[0] != y[nMiddle - 1] ||
-            y[0] != y[(nMiddle - 1) / 2] || x[0] == x[nMiddle - 1] ||
-            x[0] == x[(nMiddle - 1) / 2];
-        const bool bUseBaseTransformForHalf2 =
-            nPoints - nMiddle <= 5 || y[nMiddle] != y[nPoints - 1] ||
-            y[nMiddle] != y[nMiddle + (nPoints - nMiddle - 1) / 2] ||
-            x[nMiddle] == x[nPoints - 1] ||
-            x[nMiddle] == x[nMiddle + (nPoints - nMiddle - 1) / 2];
-
-        int anSuccess2[3] = {};
-        int bSuccess = FALSE;
-        if (!bUseBaseTransformForHalf1 && !bUseBaseTransformForHalf2)
-            bSuccess = psATInfo->pfnBaseTransformer(
-                psATInfo->pBaseCBData, bDstToSrc, 3, xMiddle, yMiddle, zMiddle,
-                anSuccess2);
-        else if (!bUseBaseTransformForHalf1)
+        for (const auto &[iStart, nCount] : anRanges)
         {
-            bSuccess = psATInfo->pfnBaseTransformer(
-                psATInfo->pBaseCBData, bDstToSrc, 2, xMiddle, yMiddle, zMiddle,
-                anSuccess2);
-            anSuccess2[2] = TRUE;
-        }
-        else if (!bUseBaseTransformForHalf2)
-        {
-            bSuccess = psATInfo->pfnBaseTransformer(
-                psATInfo->pBaseCBData, bDstToSrc, 1, xMiddle + 2, yMiddle + 2,
-                zMiddle + 2, anSuccess2 + 2);
-            anSuccess2[0] = TRUE;
-            anSuccess2[1] = TRUE;
-        }
-
-        if (!bSuccess || !anSuccess2[0] || !anSuccess2[1] || !anSuccess2[2])
-        {
-            bSuccess = psATInfo->pfnBaseTransformer(
-                psATInfo->pBaseCBData, bDstToSrc, nMiddle - 1, x + 1, y + 1,
-                z + 1, panSuccess + 1);
-            bSuccess &= psATInfo->pfnBaseTransformer(
-                psATInfo->pBaseCBData, bDstToSrc, nPoints - nMiddle - 2,
-                x + nMiddle + 1, y + nMiddle + 1, z + nMiddle + 1,
-                panSuccess + nMiddle + 1);
-
-            x[0] = xSMETransformed[0];
-            y[0] = ySMETransformed[0];
-            z[0] = zSMETransformed[0];
-            panSuccess[0] = TRUE;
-            x[nMiddle] = xSMETransformed[1];
-            y[nMiddle] = ySMETransformed[1];
-            z[nMiddle] = zSMETransformed[1];
-            panSuccess[nMiddle] = TRUE;
-            x[nPoints - 1] = xSMETransformed[2];
-            y[nPoints - 1] = ySMETransformed[2];
-            z[nPoints - 1] = zSMETransformed[2];
-            panSuccess[nPoints - 1] = TRUE;
-            return bSuccess;
+            adfX.insert(adfX.end(), x + iStart, x + iStart + nCount);
+            adfY.insert(adfY.end(), y + iStart, y + iStart + nCount);
+            adfZ.insert(adfZ.end(), z + iStart, z + iStart + nCount);
         }
+        const size_t nRangePoints = adfX.size();
 
-        double x2[3] = {};
-        double y2[3] = {};
-        double z2[3] = {};
-        if (!bUseBaseTransformForHalf1)
+        for (const auto &sSeg : aoSegments)
         {
-            x2[0] = xSMETransformed[0];
-            y2[0] = ySMETransformed[0];
-            z2[0] = zSMETransformed[0];
-            x2[1] = xMiddle[0];
-            y2[1] = yMiddle[0];
-            z2[1] = zMiddle[0];
-            x2[2] = xMiddle[1];
-            y2[2] = yMiddle[1];
-            z2[2] = zMiddle[1];
-
-            bSuccess = GDALApproxTransformInternal(
-                psATInfo, bDstToSrc, nMiddle, x, y, z, panSuccess, x2, y2, z2);
-        }
-        else
-        {
-            bSuccess = psATInfo->pfnBaseTransformer(
-                psATInfo->pBaseCBData, bDstToSrc, nMiddle - 1, x + 1, y + 1,
-                z + 1, panSuccess + 1);
-            x[0] = xSMETransformed[0];
-            y[0] = ySMETransformed[0];
-            z[0] = zSMETransformed[0];
-            panSuccess[0] = TRUE;
-        }
+            double *px = x + sSeg.iStart;
+            double *py = y + sSeg.iStart;
+            double *pz = z + sSeg.iStart;
+            const int nSegPoints = sSeg.nPoints;
+            const int nMiddle = (nSegPoints - 1) / 2;
+
+            /* ------------------------------------------------------------ */
+            /*      Is the error at the middle acceptable relative to an    */
+            /*      interpolation of the middle position?                   */
+            /* ------------------------------------------------------------ */
+            const double dfDeltaX = (sSeg.xSME[2] - sSeg.xSME[0]) /
+                                    (px[nSegPoints - 1] - px[0]);
+            const double dfDeltaY = (sSeg.ySME[2] - sSeg.ySME[0]) /
+                                    (px[nSegPoints - 1] - px[0]);
+            const double dfDeltaZ = (sSeg.zSME[2] - sSeg.zSME[0]) /
+                                    (px[nSegPoints - 1] - px[0]);
+
+            const double dfError =
+                fabs((sSeg.xSME[0] + dfDeltaX * (px[nMiddle] - px[0])) -
+                     sSeg.xSME[1]) +
+                fabs((sSeg.ySME[0] + dfDeltaY * (px[nMiddle] - px[0])) -
+                     sSeg.ySME[1]);
+
+            if (dfError <= dfMaxError)
+            {
+                /* -------------------------------------------------------- */
+                /*      Use an affine approximation of the transform        */
+                /*      along the segment.                                  */
+                /* -------------------------------------------------------- */
+                int *pnSuccess = panSuccess + sSeg.iStart;
+                for (int i = nSegPoints - 1; i >= 0; i--)
+                {
+                    const double dfDist = (px[i] - px[0]);
+                    px[i] = sSeg.xSME[0] + dfDeltaX * dfDist;
+                    py[i] = sSeg.ySME[0] + dfDeltaY * dfDist;
+                    pz[i] = sSeg.zSME[0] + dfDeltaZ * dfDist;
+                    pnSuccess[i] = TRUE;
+                }
+                continue;
+            }
 
-        if (!bSuccess)
-            return FALSE;
+#if DEBUG_VERBOSE
+            CPLDebug("GDAL",
+                     "ApproxTransformer - "
+                     "error %g over threshold %g, subdivide %d points.",
+                     dfError, dfMaxError, nSegPoints);
+#endif
 
-        if (!bUseBaseTransformForHalf2)
-        {
-            x2[0] = xSMETransformed[1];
-            y2[0] = ySMETransformed[1];
-            z2[0] = zSMETransformed[1];
-            x2[1] = xMiddle[2];
-            y2[1] = yMiddle[2];
-            z2[1] = zMiddle[2];
-            x2[2] = xSMETransformed[2];
-            y2[2] = ySMETransformed[2];
-            z2[2] = zSMETransformed[2];
-
-            bSuccess = GDALApproxTransformInternal(
-                psATInfo, bDstToSrc, nPoints - nMiddle, x + nMiddle,
-                y + nMiddle, z + nMiddle, panSuccess + nMiddle, x2, y2, z2);
+            GDALApproxSplit sSplit;
+            sSplit.sSeg = sSeg;
+            sSplit.bUseBaseTransformForHalf1 =
+                nMiddle <= 5 || py[0] != py[nMiddle - 1] ||
+                py[0] != py[(nMiddle - 1) / 2] || px[0] == px[nMiddle - 1] ||
+                px[0] == px[(nMiddle - 1) / 2];
+            sSplit.bUseBaseTransformForHalf2 =
+                nSegPoints - nMiddle <= 5 ||
+                py[nMiddle] != py[nSegPoints - 1] ||
+                py[nMiddle] != py[nMiddle + (nSegPoints - nMiddle - 1) / 2] ||
+                px[nMiddle] == px[nSegPoints - 1] ||
+                px[nMiddle] == px[nMiddle + (nSegPoints - nMiddle - 1) / 2];
+            sSplit.iFirstMiddle = adfX.size();
+            if (!sSplit.bUseBaseTransformForHalf1)
+            {
+                for (const int iMiddle : {(nMiddle - 1) / 2, nMiddle - 1})
+                {
+                    adfX.push_back(px[iMiddle]);
+                    adfY.push_back(py[iMiddle]);
+                    adfZ.push_back(pz[iMiddle]);
+                }
+            }
+            if (!sSplit.bUseBaseTransformForHalf2)
+            {
+                const int iMiddle =
+                    nMiddle + (nSegPoints - nMiddle - 1) / 2;
+                adfX.push_back(px[iMiddle]);
+                adfY.push_back(py[iMiddle]);
+                adfZ.push_back(pz[iMiddle]);
+            }
+            aoSplits.push_back(sSplit);
         }
-        else
+        aoSegments.clear();
+
+        /* ---------------------------------------------------------------- */
+        /*      Transform all the points of this level at once.             */
+        /* ---------------------------------------------------------------- */
+        // Set when the base transformer reports a failure that is not
+        // explained by the success flags of the points.
+        bool bUnexplainedFailure = false;
+        if (!adfX.empty())
         {
-            bSuccess = psATInfo->pfnBaseTransformer(
-                psATInfo->pBaseCBData, bDstToSrc, nPoints - nMiddle - 2,
-                x + nMiddle + 1, y + nMiddle + 1, z + nMiddle + 1,
-                panSuccess + nMiddle + 1);
-
-            x[nMiddle] = xSMETransformed[1];
-            y[nMiddle] = ySMETransformed[1];
-            z[nMiddle] = zSMETransformed[1];
-            panSuccess[nMiddle] = TRUE;
-            x[nPoints - 1] = xSMETransformed[2];
-            y[nPoints - 1] = ySMETransformed[2];
-            z[nPoints - 1] = zSMETransformed[2];
-            panSuccess[nPoints - 1] = TRUE;
+            anSuccess.assign(adfX.size(), FALSE);
+            const int bSuccess = psATInfo->pfnBaseTransformer(
+                psATInfo->pBaseCBData, bDstToSrc,
+                static_cast<int>(adfX.size()), adfX.data(), adfY.data(),
+                adfZ.data(), anSuccess.data());
+
+            size_t iIdx = 0;
+            bool bRangeFailure = false;
+            for (const auto &[iStart, nCount] : anRanges)
+            {
+                memcpy(x + iStart, adfX.data() + iIdx, nCount * sizeof(double));
+                memcpy(y + iStart, adfY.data() + iIdx, nCount * sizeof(double));
+                memcpy(z + iStart, adfZ.data() + iIdx, nCount * sizeof(double));
+                for (int i = 0; i < nCount; ++i)
+                {
+                    panSuccess[iStart + i] = anSuccess[iIdx + i];
+                    if (!anSuccess[iIdx + i])
+                        bRangeFailure = true;
+                }
+                iIdx += nCount;
+            }
+
+            if (!bSuccess)
+            {
+                bUnexplainedFailure =
+                    std::find(anSuccess.begin(), anSuccess.end(), FALSE) ==
+                    anSuccess.end();
+                if (nRangePoints > 0 && (bRangeFailure || bUnexplainedFailure))
+                    bRet = FALSE;
+            }
         }
+        anRanges.clear();
 
-        if (!bSuccess)
-            return FALSE;
+        /* ---------------------------------------------------------------- */
+        /*      Split the segments in halves, either approximated in the    */
+        /*      next iteration or transformed with the base transformer.    */
+        /* ---------------------------------------------------------------- */
+        for (const auto &sSplit : aoSplits)
+        {
+            const auto &sSeg = sSplit.sSeg;
+            const int iStart = sSeg.iStart;
+            const int nSegPoints = sSeg.nPoints;
+            const int nMiddle = (nSegPoints - 1) / 2;
+            bool bUseBaseTransformForHalf1 = sSplit.bUseBaseTransformForHalf1;
+            bool bUseBaseTransformForHalf2 = sSplit.bUseBaseTransformForHalf2;
+
+            const size_t nMiddleCount =
+                (bUseBaseTransformForHalf1 ? 0 : 2) +
+                (bUseBaseTransformForHalf2 ? 0 : 1);
+            // If the middle points could not be transformed, transform
+            // the whole segment with the base transformer.
+            bool bMiddleOK = nMiddleCount > 0 && !bUnexplainedFailure;
+            for (size_t i = 0; bMiddleOK && i < nMiddleCount; ++i)
+            {
+                if (!anSuccess[sSplit.iFirstMiddle + i])
+                    bMiddleOK = false;
+            }
+            if (!bMiddleOK)
+            {
+                bUseBaseTransformForHalf1 = true;
+                bUseBaseTransformForHalf2 = true;
+            }
 
-        return TRUE;
-    }
+            size_t iMiddle = sSplit.iFirstMiddle;
+            if (!bUseBaseTransformForHalf1)
+            {
+                GDALApproxSegment sHalf;
+                sHalf.iStart = iStart;
+                sHalf.nPoints = nMiddle;
+                sHalf.xSME[0] = sSeg.xSME[0];
+                sHalf.ySME[0] = sSeg.ySME[0];
+                sHalf.zSME[0] = sSeg.zSME[0];
+                for (int i = 1; i <= 2; ++i, ++iMiddle)
+                {
+                    sHalf.xSME[i] = adfX[iMiddle];
+                    sHalf.ySME[i] = adfY[iMiddle];
+                    sHalf.zSME[i] = adfZ[iMiddle];
+                }
+                aoSegments.push_back(sHalf);
+            }
+            else
+            {
+                if (nMiddle > 1)
+                    anRanges.emplace_back(iStart + 1, nMiddle - 1);
+                x[iStart] = sSeg.xSME[0];
+                y[iStart] = sSeg.ySME[0];
+                z[iStart] = sSeg.zSME[0];
+                panSuccess[iStart] = TRUE;
+            }
 
-    /* -------------------------------------------------------------------- */
-    /*      Error is OK since this is just used to compute output bounds    */
-    /*      of newly created file for gdalwarper.  So just use affine       */
-    /*      approximation of the reverse transform.  Eventually we          */
-    /*      should implement iterative searching to find a result within    */
-    /*      our error threshold.                                            */
-    /*      NOTE: the above comment is not true: gdalwarp uses approximator */
-    /*      also to compute the source pixel of each target pixel.          */
-    /* -------------------------------------------------------------------- */
-    for (int i = nPoints - 1; i >= 0; i--)
-    {
-#ifdef check_error
-        double xtemp = x[i];
-        double ytemp = y[i];
-        double ztemp = z[i];
-        double x_ori = xtemp;
-        double y_ori = ytemp;
-        int btemp = FALSE;
-        psATInfo->pfnBaseTransformer(psATInfo->pBaseCBData, bDstToSrc, 1,
-                                     &xtemp, &ytemp, &ztemp, &btemp);
-#endif
-        const double dfDist = (x[i] - x[0]);
-        x[i] = xSMETransformed[0] + dfDeltaX * dfDist;
-        y[i] = ySMETransformed[0] + dfDeltaY * dfDist;
-        z[i] = zSMETransformed[0] + dfDeltaZ * dfDist;
-#ifdef check_error
-        const double dfError2 = fabs(x[i] - xtemp) + fabs(y[i] - ytemp);
-        if (dfError2 > 4 /*10 * dfMaxError*/)
-        {
-            /*ok*/ printf("Error = %f on (%f, %f)\n", dfError2, x_ori, y_ori);
+            if (!bUseBaseTransformForHalf2)
+            {
+                GDALApproxSegment sHalf;
+                sHalf.iStart = iStart + nMiddle;
+                sHalf.nPoints = nSegPoints - nMiddle;
+                sHalf.xSME[0] = sSeg.xSME[1];
+                sHalf.ySME[0] = sSeg.ySME[1];
+                sHalf.zSME[0] = sSeg.zSME[1];
+                sHalf.xSME[1] = adfX[iMiddle];
+                sHalf.ySME[1] = adfY[iMiddle];
+                sHalf.zSME[1] = adfZ[iMiddle];
+                sHalf.xSME[2] = sSeg.xSME[2];
+                sHalf.ySME[2] = sSeg.ySME[2];
+                sHalf.zSME[2] = sSeg.zSME[2];
+                aoSegments.push_back(sHalf);
+            }
+            else
+            {
+                if (nSegPoints - nMiddle > 2)
+                    anRanges.emplace_back(iStart + nMiddle + 1,
+                                          nSegPoints - nMiddle - 2);
+                x[iStart + nMiddle] = sSeg.xSME[1];
+                y[iStart + nMiddle] = sSeg.ySME[1];
+                z[iStart + nMiddle] = sSeg.zSME[1];
+                panSuccess[iStart + nMiddle] = TRUE;
+                x[iStart + nSegPoints - 1] = sSeg.xSME[2];
+                y[iStart + nSegPoints - 1] = sSeg.ySME[2];
+                z[iStart + nSegPoints - 1] = sSeg.zSME[2];
+                panSuccess[iStart + nSegPoints - 1] = TRUE;
+            }
         }
-#endif
-        panSuccess[i] = TRUE;
     }
 
-    return TRUE;
+    return bRet;
 }
 
 /************************************************************************/
@@ -20,6 +20,13 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -30,6 +37,7 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
+#include "gdal_alg_priv.h"
 #include "gdal_priv.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
@@ -1163,6 +1171,11 @@ const char *GDALWarpGetOptionList(void)
            "Can be set to a numeric value or ALL_CPUS to set the number of "
            "threads to use to parallelize the computation part of the warping. "
            "If not set, computation will be done in a single thread..'/>"
+           "<Option name='MULTI_CHUNK_THREADS' type='string' description='"
+           "Can be set to a numeric value or ALL_CPUS to set the number of "
+           "chunks processed concurrently by the multithreaded warping "
+           "implementation (ChunkAndWarpMulti()). Each of them uses up to the "
+           "warp memory limit.' default='2'/>"
            "<Option name='STREAMABLE_OUTPUT' type='boolean' description='"
            "This defaults to FALSE, but may be set to TRUE typically when "
            "writing to a streamed file. The gdalwarp utility automatically "
@@ -1399,6 +1412,12 @@ const char *GDALWarpGetOptionList(void)
  * set the number of threads to use to parallelize the computation part of the
  * warping. If not set, computation will be done in a single thread.</li>
  *
+ * <li>MULTI_CHUNK_THREADS: (GDAL >= 3.12) Can be set to a numeric value or
+ * ALL_CPUS to set the number of chunks processed concurrently by
+ * GDALWarpOperation::ChunkAndWarpMulti(). Each of them uses up to
+ * GDALWarpOptions::dfWarpMemoryLimit bytes of working memory. Defaults to 2.
+ * </li>
+ *
  * <li>STREAMABLE_OUTPUT: (GDAL >= 2.0) This defaults to FALSE, but may
  * be set to TRUE typically when writing to a streamed file. The
  * gdalwarp utility automatically sets this option when writing to
@@ -2483,3 +2502,179 @@ bool GDALGetWarpResampleAlg(const char *pszResampling,
     }
     return true;
 }
+
+/************************************************************************/
+/*                        GDALWarpTransformCache                        */
+/************************************************************************/
+
+namespace
+{
+/** Process-wide least-recently-used cache of arrays of transformed
+ * coordinates, bounded by the GDAL_WARP_TRANSFORM_CACHE_SIZE configuration
+ * option. */
+class GDALWarpTransformCache
+{
+    // Keys of the entries, most recently used first. They point to the keys
+    // of m_oMapEntries, so that each key is stored only once.
+    using LRUList = std::list<const std::string *>;
+
+    struct Entry
+    {
+        std::shared_ptr<const std::vector<double>> poValues{};
+        LRUList::iterator oLRUIter{};
+    };
+
+    std::mutex m_oMutex{};
+    LRUList m_oLRUList{};
+    std::map<std::string, Entry> m_oMapEntries{};
+    size_t m_nSize = 0;
+
+    static size_t GetEntrySize(const std::string &osKey,
+                               const std::vector<double> &adfValues)
+    {
+        return osKey.size() + adfValues.size() * sizeof(double);
+    }
+
+    void Remove(std::map<std::string, Entry>::iterator oIter)
+    {
+        m_nSize -= GetEntrySize(oIter->first, *(oIter->second.poValues));
+        m_oLRUList.erase(oIter->second.oLRUIter);
+        m_oMapEntries.erase(oIter);
+    }
+
+  public:
+    std::shared_ptr<const std::vector<double>> Get(const std::string &osKey)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const auto oIter = m_oMapEntries.find(osKey);
+        if (oIter == m_oMapEntries.end())
+            return nullptr;
+        m_oLRUList.splice(m_oLRUList.begin(), m_oLRUList,
+                          oIter->second.oLRUIter);
+        return oIter->second.poValues;
+    }
+
+    void Put(const std::string &osKey,
+             std::shared_ptr<const std::vector<double>> poValues,
+             size_t nMaxSize)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const auto oIter = m_oMapEntries.find(osKey);
+        if (oIter != m_oMapEntries.end())
+            Remove(oIter);
+
+        const size_t nEntrySize = GetEntrySize(osKey, *poValues);
+        if (nEntrySize > nMaxSize)
+            return;
+        while (!m_oLRUList.empty() && m_nSize + nEntrySize > nMaxSize)
+            Remove(m_oMapEntries.find(*(m_oLRUList.back())));
+
+        const auto oNewIter =
+            m_oMapEntries.emplace(osKey, Entry{std::move(poValues)}).first;
+        m_oLRUList.push_front(&(oNewIter->first));
+        oNewIter->second.oLRUIter = m_oLRUList.begin();
+        m_nSize += nEntrySize;
+    }
+};
+
+GDALWarpTransformCache &GetWarpTransformCache()
+{
+    static GDALWarpTransformCache oCache;
+    return oCache;
+}
+}  // namespace
+
+/************************************************************************/
+/*                  GDALWarpTransformCacheGetMaxSize()                  */
+/************************************************************************/
+
+/** Return the maximum size in bytes of the cache of transformed coordinates,
+ * from the GDAL_WARP_TRANSFORM_CACHE_SIZE configuration option (in MB when
+ * no unit is specified). 0 means that the cache is disabled, which is the
+ * default.
+ */
+size_t GDALWarpTransformCacheGetMaxSize()
+{
+    const char *pszCacheSize =
+        CPLGetConfigOption("GDAL_WARP_TRANSFORM_CACHE_SIZE", "0");
+    GIntBig nCacheSize = 0;
+    bool bUnitSpecified = false;
+    if (CPLParseMemorySize(pszCacheSize, &nCacheSize, &bUnitSpecified) !=
+        CE_None)
+    {
+        return 0;
+    }
+    if (!bUnitSpecified)
+    {
+        if (nCacheSize > std::numeric_limits<GIntBig>::max() / (1024 * 1024))
+            return 0;
+        nCacheSize *= 1024 * 1024;
+    }
+    return static_cast<size_t>(std::min<GIntBig>(
+        nCacheSize, static_cast<GIntBig>(std::numeric_limits<size_t>::max() /
+                                         2)));
+}
+
+/************************************************************************/
+/*                    GDALWarpTransformCacheGetKey()                    */
+/************************************************************************/
+
+/** Return the key identifying the parameters of a transformer in the cache
+ * of transformed coordinates.
+ *
+ * The key is the serialization of the transformer. An empty string is
+ * returned if the cache is disabled or if the transformer cannot be
+ * serialized. Callers append to it a description of the transformed points.
+ */
+std::string GDALWarpTransformCacheGetKey(GDALTransformerFunc pfnTransformer,
+                                         void *pTransformerArg)
+{
+    std::string osKey;
+    if (pfnTransformer == nullptr || pTransformerArg == nullptr ||
+        GDALWarpTransformCacheGetMaxSize() == 0)
+    {
+        return osKey;
+    }
+
+    CPLXMLNode *psTree = nullptr;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        psTree = GDALSerializeTransformer(pfnTransformer, pTransformerArg);
+    }
+    if (psTree)
+    {
+        char *pszXML = CPLSerializeXMLTree(psTree);
+        if (pszXML)
+            osKey = pszXML;
+        CPLFree(pszXML);
+        CPLDestroyXMLNode(psTree);
+    }
+    return osKey;
+}
+
+/************************************************************************/
+/*                     GDALWarpTransformCacheGet()                      */
+/************************************************************************/
+
+/** Return the cached array of transformed coordinates for the key, or
+ * nullptr. */
+std::shared_ptr<const std::vector<double>>
+GDALWarpTransformCacheGet(const std::string &osKey)
+{
+    return GetWarpTransformCache().Get(osKey);
+}
+
+/************************************************************************/
+/*                     GDALWarpTransformCachePut()                      */
+/************************************************************************/
+
+/** Insert an array of transformed coordinates in the cache, evicting the
+ * least recently used ones if needed. */
+void GDALWarpTransformCachePut(
+    const std::string &osKey,
+    std::shared_ptr<const std::vector<double>> poValues)
+{
+    const size_t nMaxSize = GDALWarpTransformCacheGetMaxSize();
+    if (nMaxSize > 0)
+        GetWarpTransformCache().Put(osKey, std::move(poValues), nMaxSize);
+}
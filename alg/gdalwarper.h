@@ -330,6 +330,8 @@ CPL_C_END
 
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
 
+#include <memory>
+#include <string>
 #include <vector>
 #include <utility>
 
@@ -470,6 +472,16 @@ class CPL_DLL GDALWarpKernel
 
     bool bWarnedAboutDstNoDataReplacement = false;
 
+    // Source coordinates of the centers of the destination pixels, taken
+    // from the GDAL_WARP_TRANSFORM_CACHE_SIZE cache: X values of all the
+    // pixels, then Y, Z and success flags.
+    std::shared_ptr<const std::vector<double>> m_poCachedDstToSrcCoords{};
+
+    // Same layout, filled by PerformWarp() to be inserted in the cache
+    // under m_osTransformCacheKey.
+    std::vector<double> m_adfDstToSrcCoordsToCache{};
+    std::string m_osTransformCacheKey{};
+
     /*! @endcond */
 
     GDALWarpKernel();
@@ -543,6 +555,8 @@ class CPL_DLL GDALWarpOperation final
 
     CPLMutex *hIOMutex = nullptr;
     CPLMutex *hWarpMutex = nullptr;
+    // Whether source reads may be done without holding hIOMutex.
+    bool m_bSrcThreadSafe = false;
 
     int nChunkListCount = 0;
     int nChunkListMax = 0;
@@ -440,6 +440,96 @@ static void ThreadFuncAdapter(void *pData)
     }
 }
 
+/************************************************************************/
+/*                       GWKInitTransformCache()                        */
+/************************************************************************/
+
+// Look up the source coordinates of the centers of the destination pixels in
+// the GDAL_WARP_TRANSFORM_CACHE_SIZE cache, or prepare the array in which
+// they will be collected while warping.
+static void GWKInitTransformCache(GDALWarpKernel *poWK)
+{
+    poWK->m_poCachedDstToSrcCoords.reset();
+    poWK->m_adfDstToSrcCoordsToCache.clear();
+    poWK->m_osTransformCacheKey.clear();
+
+    // Those methods transform the corners of the destination pixels, and
+    // not their centers.
+    switch (poWK->eResample)
+    {
+        case GRA_Average:
+        case GRA_RMS:
+        case GRA_Mode:
+        case GRA_Max:
+        case GRA_Min:
+        case GRA_Med:
+        case GRA_Q1:
+        case GRA_Q3:
+        case GRA_Sum:
+            return;
+        default:
+            break;
+    }
+
+    std::string osKey = GDALWarpTransformCacheGetKey(poWK->pfnTransformer,
+                                                     poWK->pTransformerArg);
+    if (osKey.empty())
+        return;
+    osKey += CPLSPrintf("|dst_pixel_centers|%d,%d,%d,%d", poWK->nDstXOff,
+                        poWK->nDstYOff, poWK->nDstXSize, poWK->nDstYSize);
+
+    const size_t nPixels =
+        static_cast<size_t>(poWK->nDstXSize) * poWK->nDstYSize;
+    poWK->m_poCachedDstToSrcCoords = GDALWarpTransformCacheGet(osKey);
+    if (poWK->m_poCachedDstToSrcCoords)
+    {
+        CPLAssert(poWK->m_poCachedDstToSrcCoords->size() == 4 * nPixels);
+        CPLDebug("WARP", "Using cached source coordinates of the destination "
+                         "pixel centers");
+        return;
+    }
+
+    if (nPixels > GDALWarpTransformCacheGetMaxSize() / (4 * sizeof(double)))
+        return;
+    try
+    {
+        // Success flags are initialized to NaN, so that we can check that
+        // all rows have been transformed.
+        poWK->m_adfDstToSrcCoordsToCache.assign(
+            4 * nPixels, std::numeric_limits<double>::quiet_NaN());
+    }
+    catch (const std::bad_alloc &)
+    {
+        return;
+    }
+    poWK->m_osTransformCacheKey = std::move(osKey);
+}
+
+/************************************************************************/
+/*                      GWKPutInTransformCache()                        */
+/************************************************************************/
+
+static void GWKPutInTransformCache(GDALWarpKernel *poWK)
+{
+    if (poWK->m_osTransformCacheKey.empty())
+        return;
+
+    const size_t nPixels =
+        static_cast<size_t>(poWK->nDstXSize) * poWK->nDstYSize;
+    const double *padfSuccess =
+        poWK->m_adfDstToSrcCoordsToCache.data() + 3 * nPixels;
+    if (std::none_of(padfSuccess, padfSuccess + nPixels,
+                     [](double dfVal) { return std::isnan(dfVal); }))
+    {
+        GDALWarpTransformCachePut(
+            poWK->m_osTransformCacheKey,
+            std::make_shared<const std::vector<double>>(
+                std::move(poWK->m_adfDstToSrcCoordsToCache)));
+    }
+    poWK->m_adfDstToSrcCoordsToCache.clear();
+    poWK->m_osTransformCacheKey.clear();
+}
+
 /************************************************************************/
 /*                                GWKRun()                              */
 /************************************************************************/
@@ -467,7 +557,10 @@ static CPLErr GWKRun(GDALWarpKernel *poWK, const char *pszFuncName,
         static_cast<GWKThreadData *>(poWK->psThreadData);
     if (psThreadData == nullptr || psThreadData->poJobQueue == nullptr)
     {
-        return GWKGenericMonoThread(poWK, pfnFunc);
+        const CPLErr eErr = GWKGenericMonoThread(poWK, pfnFunc);
+        if (eErr == CE_None)
+            GWKPutInTransformCache(poWK);
+        return eErr;
     }
 
     int nThreads = std::min(psThreadData->nMaxThreads, nDstYSize / 2);
@@ -550,7 +643,10 @@ static CPLErr GWKRun(GDALWarpKernel *poWK, const char *pszFuncName,
     /* -------------------------------------------------------------------- */
     psThreadData->poJobQueue->WaitCompletion();
 
-    return bStopFlag ? CE_Failure : CE_None;
+    if (bStopFlag)
+        return CE_Failure;
+    GWKPutInTransformCache(poWK);
+    return CE_None;
 }
 
 /************************************************************************/
@@ -1195,6 +1291,8 @@ CPLErr GDALWarpKernel::PerformWarp()
     dfMultFactorVerticalShift = CPLAtof(CSLFetchNameValueDef(
         papszWarpOptions, "MULT_FACTOR_VERTICAL_SHIFT", "1.0"));
 
+    GWKInitTransformCache(this);
+
     /* -------------------------------------------------------------------- */
     /*      Set up resampling functions.                                    */
     /* -------------------------------------------------------------------- */
@@ -2278,6 +2376,72 @@ static bool GWKGetPixelValueReal(const GDALWarpKernel *poWK, int iBand,
     return *pdfDensity != 0.0;
 }
 
+/************************************************************************/
+/*                          GWKGetPixelRowT()                           */
+/************************************************************************/
+
+// Specialization of GWKGetPixelRow() for non-complex data types, used by the
+// kernel based resamplings when source validity masks or a source density are
+// involved. The pixel values are fetched with a type-specialized loop, and the
+// validity masks and the source density are combined in a single pass over
+// the row. The computed densities and the return value are the same as the
+// ones of the generic code path. The unmasked cases do not go through this
+// function, and use the SSE2 kernels, such as GWKResampleNoMasks_SSE2_T().
+
+template <class T>
+static bool GWKGetPixelRowT(const GDALWarpKernel *poWK, int iBand,
+                            GPtrDiff_t iSrcOffset, int nSrcLen,
+                            double *padfDensity, double adfReal[])
+{
+    const T *pSrc =
+        reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]) + iSrcOffset;
+    for (int i = 0; i < nSrcLen; ++i)
+        adfReal[i] = static_cast<double>(pSrc[i]);
+
+    if (padfDensity == nullptr)
+        return true;
+
+    GUInt32 *panUnifiedSrcValid = poWK->panUnifiedSrcValid;
+    GUInt32 *panBandSrcValid = poWK->papanBandSrcValid != nullptr
+                                   ? poWK->papanBandSrcValid[iBand]
+                                   : nullptr;
+    const float *pafSrcDensity = poWK->pafUnifiedSrcDensity != nullptr
+                                     ? poWK->pafUnifiedSrcDensity + iSrcOffset
+                                     : nullptr;
+
+    // Each mask must have at least one valid pixel in the row, as in
+    // GWKGetPixelRow().
+    bool bHasUnifiedValid = panUnifiedSrcValid == nullptr;
+    bool bHasBandValid = panBandSrcValid == nullptr;
+    bool bHasValid = false;
+
+    for (int i = 0; i < nSrcLen; ++i)
+    {
+        double dfDensity = 1.0;
+        if (panUnifiedSrcValid != nullptr)
+        {
+            if (CPLMaskGet(panUnifiedSrcValid, iSrcOffset + i))
+                bHasUnifiedValid = true;
+            else
+                dfDensity = 0.0;
+        }
+        if (panBandSrcValid != nullptr)
+        {
+            if (CPLMaskGet(panBandSrcValid, iSrcOffset + i))
+                bHasBandValid = true;
+            else
+                dfDensity = 0.0;
+        }
+        if (pafSrcDensity != nullptr && dfDensity > SRC_DENSITY_THRESHOLD)
+            dfDensity = pafSrcDensity[i];
+        if (dfDensity > SRC_DENSITY_THRESHOLD)
+            bHasValid = true;
+        padfDensity[i] = dfDensity;
+    }
+
+    return bHasUnifiedValid && bHasBandValid && bHasValid;
+}
+
 /************************************************************************/
 /*                          GWKGetPixelRow()                            */
 /************************************************************************/
@@ -2292,6 +2456,47 @@ static bool GWKGetPixelRow(const GDALWarpKernel *poWK, int iBand,
 {
     // We know that nSrcLen is even, so we can *always* unroll loops 2x.
     const int nSrcLen = nHalfSrcLen * 2;
+
+    switch (poWK->eWorkingDataType)
+    {
+        case GDT_Byte:
+            return GWKGetPixelRowT<GByte>(poWK, iBand, iSrcOffset, nSrcLen,
+                                          padfDensity, adfReal);
+        case GDT_Int8:
+            return GWKGetPixelRowT<GInt8>(poWK, iBand, iSrcOffset, nSrcLen,
+                                          padfDensity, adfReal);
+        case GDT_Int16:
+            return GWKGetPixelRowT<GInt16>(poWK, iBand, iSrcOffset, nSrcLen,
+                                           padfDensity, adfReal);
+        case GDT_UInt16:
+            return GWKGetPixelRowT<GUInt16>(poWK, iBand, iSrcOffset, nSrcLen,
+                                            padfDensity, adfReal);
+        case GDT_Int32:
+            return GWKGetPixelRowT<GInt32>(poWK, iBand, iSrcOffset, nSrcLen,
+                                           padfDensity, adfReal);
+        case GDT_UInt32:
+            return GWKGetPixelRowT<GUInt32>(poWK, iBand, iSrcOffset, nSrcLen,
+                                            padfDensity, adfReal);
+        case GDT_Int64:
+            return GWKGetPixelRowT<std::int64_t>(
+                poWK, iBand, iSrcOffset, nSrcLen, padfDensity, adfReal);
+        case GDT_UInt64:
+            return GWKGetPixelRowT<std::uint64_t>(
+                poWK, iBand, iSrcOffset, nSrcLen, padfDensity, adfReal);
+        case GDT_Float16:
+            return GWKGetPixelRowT<GFloat16>(poWK, iBand, iSrcOffset, nSrcLen,
+                                             padfDensity, adfReal);
+        case GDT_Float32:
+            return GWKGetPixelRowT<float>(poWK, iBand, iSrcOffset, nSrcLen,
+                                          padfDensity, adfReal);
+        case GDT_Float64:
+            return GWKGetPixelRowT<double>(poWK, iBand, iSrcOffset, nSrcLen,
+                                           padfDensity, adfReal);
+        default:
+            // Complex data types are handled below
+            break;
+    }
+
     bool bHasValid = false;
 
     if (padfDensity != nullptr)
@@ -2354,149 +2559,6 @@ static bool GWKGetPixelRow(const GDALWarpKernel *poWK, int iBand,
     // Fetch data.
     switch (poWK->eWorkingDataType)
     {
-        case GDT_Byte:
-        {
-            GByte *pSrc =
-                reinterpret_cast<GByte *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = pSrc[i];
-                adfReal[i + 1] = pSrc[i + 1];
-            }
-            break;
-        }
-
-        case GDT_Int8:
-        {
-            GInt8 *pSrc =
-                reinterpret_cast<GInt8 *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = pSrc[i];
-                adfReal[i + 1] = pSrc[i + 1];
-            }
-            break;
-        }
-
-        case GDT_Int16:
-        {
-            GInt16 *pSrc =
-                reinterpret_cast<GInt16 *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = pSrc[i];
-                adfReal[i + 1] = pSrc[i + 1];
-            }
-            break;
-        }
-
-        case GDT_UInt16:
-        {
-            GUInt16 *pSrc =
-                reinterpret_cast<GUInt16 *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = pSrc[i];
-                adfReal[i + 1] = pSrc[i + 1];
-            }
-            break;
-        }
-
-        case GDT_Int32:
-        {
-            GInt32 *pSrc =
-                reinterpret_cast<GInt32 *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = pSrc[i];
-                adfReal[i + 1] = pSrc[i + 1];
-            }
-            break;
-        }
-
-        case GDT_UInt32:
-        {
-            GUInt32 *pSrc =
-                reinterpret_cast<GUInt32 *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = pSrc[i];
-                adfReal[i + 1] = pSrc[i + 1];
-            }
-            break;
-        }
-
-        case GDT_Int64:
-        {
-            auto pSrc =
-                reinterpret_cast<std::int64_t *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = static_cast<double>(pSrc[i]);
-                adfReal[i + 1] = static_cast<double>(pSrc[i + 1]);
-            }
-            break;
-        }
-
-        case GDT_UInt64:
-        {
-            auto pSrc =
-                reinterpret_cast<std::uint64_t *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = static_cast<double>(pSrc[i]);
-                adfReal[i + 1] = static_cast<double>(pSrc[i + 1]);
-            }
-            break;
-        }
-
-        case GDT_Float16:
-        {
-            GFloat16 *pSrc =
-                reinterpret_cast<GFloat16 *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = pSrc[i];
-                adfReal[i + 1] = pSrc[i + 1];
-            }
-            break;
-        }
-
-        case GDT_Float32:
-        {
-            float *pSrc =
-                reinterpret_cast<float *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = pSrc[i];
-                adfReal[i + 1] = pSrc[i + 1];
-            }
-            break;
-        }
-
-        case GDT_Float64:
-        {
-            double *pSrc =
-                reinterpret_cast<double *>(poWK->papabySrcImage[iBand]);
-            pSrc += iSrcOffset;
-            for (int i = 0; i < nSrcLen; i += 2)
-            {
-                adfReal[i] = pSrc[i];
-                adfReal[i + 1] = pSrc[i + 1];
-            }
-            break;
-        }
-
         case GDT_CInt16:
         {
             GInt16 *pSrc =
@@ -2577,8 +2639,8 @@ static bool GWKGetPixelRow(const GDALWarpKernel *poWK, int iBand,
             break;
         }
 
-        case GDT_Unknown:
-        case GDT_TypeCount:
+        default:
+            // Non-complex types are handled by GWKGetPixelRowT()
             CPLAssert(false);
             if (padfDensity)
                 memset(padfDensity, 0, nSrcLen * sizeof(double));
@@ -4884,6 +4946,50 @@ bool GWKResampleNoMasksT<double>(const GDALWarpKernel *poWK, int iBand,
 
 #endif /* defined(USE_SSE2) */
 
+/************************************************************************/
+/*                        GWKTransformDstRow()                          */
+/************************************************************************/
+
+// Transform the centers of the destination pixels of row iDstY, set in
+// padfX, padfY and padfZ by the caller, to source pixel coordinates, using
+// the GDAL_WARP_TRANSFORM_CACHE_SIZE cache when possible.
+static void GWKTransformDstRow(const GWKJobStruct *psJob, int iDstY,
+                               double *padfX, double *padfY, double *padfZ,
+                               int *pabSuccess)
+{
+    GDALWarpKernel *poWK = psJob->poWK;
+    const int nDstXSize = poWK->nDstXSize;
+    const size_t nPixels = static_cast<size_t>(nDstXSize) * poWK->nDstYSize;
+    const size_t nRowOffset = static_cast<size_t>(iDstY) * nDstXSize;
+
+    if (poWK->m_poCachedDstToSrcCoords)
+    {
+        const double *padfCached =
+            poWK->m_poCachedDstToSrcCoords->data() + nRowOffset;
+        memcpy(padfX, padfCached, sizeof(double) * nDstXSize);
+        memcpy(padfY, padfCached + nPixels, sizeof(double) * nDstXSize);
+        memcpy(padfZ, padfCached + 2 * nPixels, sizeof(double) * nDstXSize);
+        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+            pabSuccess[iDstX] = padfCached[3 * nPixels + iDstX] != 0;
+        return;
+    }
+
+    poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize, padfX, padfY,
+                         padfZ, pabSuccess);
+
+    if (!poWK->m_adfDstToSrcCoordsToCache.empty())
+    {
+        // Each job fills its own rows.
+        double *padfToCache =
+            poWK->m_adfDstToSrcCoordsToCache.data() + nRowOffset;
+        memcpy(padfToCache, padfX, sizeof(double) * nDstXSize);
+        memcpy(padfToCache + nPixels, padfY, sizeof(double) * nDstXSize);
+        memcpy(padfToCache + 2 * nPixels, padfZ, sizeof(double) * nDstXSize);
+        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+            padfToCache[3 * nPixels + iDstX] = pabSuccess[iDstX] ? 1.0 : 0.0;
+    }
+}
+
 /************************************************************************/
 /*                     GWKRoundSourceCoordinates()                      */
 /************************************************************************/
@@ -5306,8 +5412,7 @@ static void GWKGeneralCaseThread(void *pData)
         /*      to source pixel/line coordinates. */
         /* --------------------------------------------------------------------
          */
-        poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize, padfX,
-                             padfY, padfZ, pabSuccess);
+        GWKTransformDstRow(psJob, iDstY, padfX, padfY, padfZ, pabSuccess);
         if (dfSrcCoordPrecision > 0.0)
         {
             GWKRoundSourceCoordinates(
@@ -5582,8 +5687,7 @@ static void GWKRealCaseThread(void *pData)
         /*      to source pixel/line coordinates. */
         /* --------------------------------------------------------------------
          */
-        poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize, padfX,
-                             padfY, padfZ, pabSuccess);
+        GWKTransformDstRow(psJob, iDstY, padfX, padfY, padfZ, pabSuccess);
         if (dfSrcCoordPrecision > 0.0)
         {
             GWKRoundSourceCoordinates(
@@ -6011,8 +6115,7 @@ static void GWKResampleNoMasksOrDstDensityOnlyThreadInternal(void *pData)
         /*      to source pixel/line coordinates. */
         /* --------------------------------------------------------------------
          */
-        poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize, padfX,
-                             padfY, padfZ, pabSuccess);
+        GWKTransformDstRow(psJob, iDstY, padfX, padfY, padfZ, pabSuccess);
         if (dfSrcCoordPrecision > 0.0)
         {
             GWKRoundSourceCoordinates(
@@ -6270,8 +6373,7 @@ template <class T> static void GWKNearestThread(void *pData)
         /*      to source pixel/line coordinates. */
         /* --------------------------------------------------------------------
          */
-        poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize, padfX,
-                             padfY, padfZ, pabSuccess);
+        GWKTransformDstRow(psJob, iDstY, padfX, padfY, padfZ, pabSuccess);
         if (dfSrcCoordPrecision > 0.0)
         {
             GWKRoundSourceCoordinates(
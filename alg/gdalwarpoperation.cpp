@@ -22,10 +22,12 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -1096,68 +1098,152 @@ CPLErr GDALChunkAndWarpImage(GDALWarpOperationH hOperation, int nDstXOff,
 /*                          ChunkThreadMain()                           */
 /************************************************************************/
 
+struct ChunkThreadData;
+
+// State shared by the threads of ChunkAndWarpMulti()
+struct ChunkMultiContext
+{
+    const GDALWarpChunk *pasChunkList = nullptr;
+    int nChunkListCount = 0;
+    CPLMutex *hIOMutex = nullptr;
+
+    std::atomic<int> nNextChunk{0};
+    std::atomic<bool> bStop{false};
+
+    // Progress is aggregated over the completed chunks and the chunks
+    // being processed, so that it is monotonic whatever the order in which
+    // chunks complete.
+    std::mutex oProgressMutex{};
+    GDALProgressFunc pfnProgress = nullptr;
+    void *pProgressArg = nullptr;
+    double dfTotalPixels = 0;
+    double dfPixelsProcessed = 0;  // of completed chunks
+    std::vector<ChunkThreadData> *pasThreadData = nullptr;
+
+    CPLErrorAccumulator oErrorAccumulator{};
+};
+
 struct ChunkThreadData
 {
+    ChunkMultiContext *psContext = nullptr;
+
+    // Operation used by this thread. Either a clone of the main operation
+    // with its own transformer, or the main operation itself.
     GDALWarpOperation *poOperation = nullptr;
-    GDALWarpChunk *pasChunkInfo = nullptr;
+    std::unique_ptr<GDALWarpOperation> poOwnedOperation{};
+
     CPLJoinableThread *hThreadHandle = nullptr;
     CPLErr eErr = CE_None;
-    double dfProgressBase = 0;
-    double dfProgressScale = 0;
-    CPLMutex *hIOMutex = nullptr;
 
-    CPLMutex *hCondMutex = nullptr;
-    volatile int bIOMutexTaken = 0;
-    CPLCond *hCond = nullptr;
-
-    CPLErrorAccumulator *poErrorAccumulator = nullptr;
+    // Protected by ChunkMultiContext::oProgressMutex
+    double dfChunkPixels = 0;
+    double dfChunkRatio = 0;
 };
 
+// Thread data of the calling thread, when it is a ChunkAndWarpMulti() one
+static thread_local ChunkThreadData *tl_psChunkThreadData = nullptr;
+
+static int CPL_STDCALL ChunkProgress(double dfComplete, const char *,
+                                     void *pProgressArg)
+{
+    ChunkThreadData *psData = static_cast<ChunkThreadData *>(pProgressArg);
+    ChunkMultiContext *psContext = psData->psContext;
+
+    std::lock_guard<std::mutex> oLock(psContext->oProgressMutex);
+    psData->dfChunkRatio = dfComplete;
+    double dfPixelsProcessed = psContext->dfPixelsProcessed;
+    for (const auto &sData : *(psContext->pasThreadData))
+        dfPixelsProcessed += sData.dfChunkPixels * sData.dfChunkRatio;
+    if (!psContext->pfnProgress(
+            std::min(1.0, dfPixelsProcessed / psContext->dfTotalPixels), "",
+            psContext->pProgressArg))
+    {
+        psContext->bStop = true;
+        return FALSE;
+    }
+    return TRUE;
+}
+
+// Progress function of the main operation when it is shared by all threads.
+// It forwards to ChunkProgress() with the data of the calling thread.
+static int CPL_STDCALL ChunkSharedProgress(double dfComplete,
+                                           const char *pszMessage, void *)
+{
+    if (tl_psChunkThreadData == nullptr)
+        return TRUE;
+    return ChunkProgress(dfComplete, pszMessage, tl_psChunkThreadData);
+}
+
 static void ChunkThreadMain(void *pThreadData)
 
 {
-    volatile ChunkThreadData *psData =
-        static_cast<volatile ChunkThreadData *>(pThreadData);
+    ChunkThreadData *psData = static_cast<ChunkThreadData *>(pThreadData);
+    ChunkMultiContext *psContext = psData->psContext;
+    tl_psChunkThreadData = psData;
 
-    GDALWarpChunk *pasChunkInfo = psData->pasChunkInfo;
+    auto oAccumulator = psContext->oErrorAccumulator.InstallForCurrentScope();
+    CPL_IGNORE_RET_VAL(oAccumulator);
 
-    /* -------------------------------------------------------------------- */
-    /*      Acquire IO mutex.                                               */
-    /* -------------------------------------------------------------------- */
-    if (!CPLAcquireMutex(psData->hIOMutex, 600.0))
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Failed to acquire IOMutex in WarpRegion().");
-        psData->eErr = CE_Failure;
-    }
-    else
+    // Chunks are picked dynamically, so that a thread that is done with a
+    // small chunk immediately proceeds with the next pending one.
+    while (!psContext->bStop)
     {
-        if (psData->hCond != nullptr)
+        const int iChunk = psContext->nNextChunk++;
+        if (iChunk >= psContext->nChunkListCount)
+            break;
+        const GDALWarpChunk *pasChunkInfo = psContext->pasChunkList + iChunk;
+
+        {
+            std::lock_guard<std::mutex> oLock(psContext->oProgressMutex);
+            psData->dfChunkPixels =
+                pasChunkInfo->dsx * static_cast<double>(pasChunkInfo->dsy);
+            psData->dfChunkRatio = 0;
+        }
+
+        CPLDebug("GDAL", "Start chunk %d / %d.", iChunk,
+                 psContext->nChunkListCount);
+
+        /* ---------------------------------------------------------------- */
+        /*      Acquire IO mutex. It is released by WarpRegion() while      */
+        /*      the warp kernel runs, and while a thread-safe source is     */
+        /*      read.                                                       */
+        /* ---------------------------------------------------------------- */
+        if (!CPLAcquireMutex(psContext->hIOMutex, 600.0))
         {
-            CPLAcquireMutex(psData->hCondMutex, 1.0);
-            psData->bIOMutexTaken = TRUE;
-            CPLCondSignal(psData->hCond);
-            CPLReleaseMutex(psData->hCondMutex);
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failed to acquire IOMutex in WarpRegion().");
+            psData->eErr = CE_Failure;
         }
+        else
+        {
+            // Progress is reported as the ratio of this chunk, and
+            // aggregated by ChunkProgress()
+            psData->eErr = psData->poOperation->WarpRegion(
+                pasChunkInfo->dx, pasChunkInfo->dy, pasChunkInfo->dsx,
+                pasChunkInfo->dsy, pasChunkInfo->sx, pasChunkInfo->sy,
+                pasChunkInfo->ssx, pasChunkInfo->ssy, pasChunkInfo->sExtraSx,
+                pasChunkInfo->sExtraSy, 0.0, 1.0);
 
-        auto oAccumulator =
-            psData->poErrorAccumulator->InstallForCurrentScope();
-        CPL_IGNORE_RET_VAL(oAccumulator);
+            CPLReleaseMutex(psContext->hIOMutex);
+        }
 
-        psData->eErr = psData->poOperation->WarpRegion(
-            pasChunkInfo->dx, pasChunkInfo->dy, pasChunkInfo->dsx,
-            pasChunkInfo->dsy, pasChunkInfo->sx, pasChunkInfo->sy,
-            pasChunkInfo->ssx, pasChunkInfo->ssy, pasChunkInfo->sExtraSx,
-            pasChunkInfo->sExtraSy, psData->dfProgressBase,
-            psData->dfProgressScale);
+        {
+            std::lock_guard<std::mutex> oLock(psContext->oProgressMutex);
+            psContext->dfPixelsProcessed += psData->dfChunkPixels;
+            psData->dfChunkPixels = 0;
+        }
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Release the IO mutex. */
-        /* --------------------------------------------------------------------
-         */
-        CPLReleaseMutex(psData->hIOMutex);
+        if (psData->eErr != CE_None)
+        {
+            psContext->bStop = true;
+            break;
+        }
+
+        CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk,
+                 psContext->nChunkListCount);
     }
+
+    tl_psChunkThreadData = nullptr;
 }
 
 /************************************************************************/
@@ -1174,7 +1260,16 @@ static void ChunkThreadMain(void *pThreadData)
  *
  * Externally this method operates the same as ChunkAndWarpImage(), but
  * internally this method uses multiple threads to interleave input/output
- * for one region while the processing is being done for another.
+ * for some regions while the processing is being done for others.
+ *
+ * The number of chunks processed concurrently is set by the
+ * MULTI_CHUNK_THREADS warping option (2 by default). Each of them uses up to
+ * GDALWarpOptions::dfWarpMemoryLimit bytes of working memory, and the number
+ * of threads is reduced, possibly down to one, if their total memory would
+ * exceed half of the usable physical RAM. Input/output operations are
+ * serialized, except reads of a source dataset whose IsThreadSafe() method
+ * returns true. Warp kernels of different chunks run concurrently when the
+ * transformer can be cloned and no warp chunk processor is set.
  *
  * @param nDstXOff X offset to window of destination data to be produced.
  * @param nDstYOff Y offset to window of destination data to be produced.
@@ -1188,15 +1283,19 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
                                             int nDstXSize, int nDstYSize)
 
 {
+    CPLAssert(hIOMutex == nullptr);
     hIOMutex = CPLCreateMutex();
     hWarpMutex = CPLCreateMutex();
 
     CPLReleaseMutex(hIOMutex);
     CPLReleaseMutex(hWarpMutex);
 
-    CPLCond *hCond = CPLCreateCond();
-    CPLMutex *hCondMutex = CPLCreateMutex();
-    CPLReleaseMutex(hCondMutex);
+    // Chunks can read a thread-safe source concurrently. Accesses to the
+    // destination dataset are still serialized by the IO mutex.
+    m_bSrcThreadSafe =
+        psOptions->hSrcDS != nullptr &&
+        GDALDataset::FromHandle(psOptions->hSrcDS)
+            ->IsThreadSafe(GDAL_OF_RASTER);
 
     /* -------------------------------------------------------------------- */
     /*      Collect the list of chunks to operate on.                       */
@@ -1204,121 +1303,181 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
 
     /* -------------------------------------------------------------------- */
-    /*      Process them one at a time, updating the progress               */
-    /*      information for each region.                                    */
-    /* -------------------------------------------------------------------- */
-    ChunkThreadData volatile asThreadData[2] = {};
-    CPLErrorAccumulator oErrorAccumulator;
-    for (int i = 0; i < 2; ++i)
-    {
-        asThreadData[i].poOperation = this;
-        asThreadData[i].hIOMutex = hIOMutex;
-        asThreadData[i].poErrorAccumulator = &oErrorAccumulator;
-    }
-
-    double dfPixelsProcessed = 0.0;
-    double dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
+    /*      Determine the number of chunks to process concurrently.         */
+    /* -------------------------------------------------------------------- */
+    const char *pszChunkThreads = CSLFetchNameValueDef(
+        psOptions->papszWarpOptions, "MULTI_CHUNK_THREADS", "2");
+    int nThreads = EQUAL(pszChunkThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                      : atoi(pszChunkThreads);
+    nThreads = std::max(2, std::min(128, nThreads));
+    const GIntBig nUsableRAM = CPLGetUsablePhysicalRAM();
+    if (nUsableRAM > 0)
+    {
+        const int nMaxThreadsForRAM =
+            static_cast<int>(std::min<double>(
+                128.0, static_cast<double>(nUsableRAM) / 2 /
+                           psOptions->dfWarpMemoryLimit));
+        // Fall back to processing chunks one at a time if there is not
+        // enough RAM for two of them.
+        nThreads = std::min(nThreads, std::max(1, nMaxThreadsForRAM));
+    }
+    nThreads = std::max(1, std::min(nThreads, nChunkListCount));
+
+    /* -------------------------------------------------------------------- */
+    /*      Create an operation per thread, with its own transformer so     */
+    /*      that their warp kernels can run concurrently. If the            */
+    /*      transformer cannot be cloned, or if application provided        */
+    /*      chunk processors are set, as they and their arguments are       */
+    /*      shared by all operations, all threads share this operation,     */
+    /*      and the warp kernels are serialized.                            */
+    /* -------------------------------------------------------------------- */
+    std::vector<ChunkThreadData> asThreadData(nThreads);
+    ChunkMultiContext sContext;
+    sContext.pasChunkList = pasChunkList;
+    sContext.nChunkListCount = nChunkListCount;
+    sContext.hIOMutex = hIOMutex;
+    sContext.pfnProgress = psOptions->pfnProgress;
+    sContext.pProgressArg = psOptions->pProgressArg;
+    sContext.dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
+    sContext.pasThreadData = &asThreadData;
 
     CPLErr eErr = CE_None;
-    for (int iChunk = 0; iChunk < nChunkListCount + 1; iChunk++)
+    for (auto &sData : asThreadData)
     {
-        int iThread = iChunk % 2;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Launch thread for this chunk. */
-        /* --------------------------------------------------------------------
-         */
-        if (pasChunkList != nullptr && iChunk < nChunkListCount)
+        sData.psContext = &sContext;
+        sData.poOperation = this;
+    }
+    const bool bHasChunkProcessor =
+        psOptions->pfnPreWarpChunkProcessor != nullptr ||
+        psOptions->pfnPostWarpChunkProcessor != nullptr;
+    if (nThreads > 1 && bHasChunkProcessor)
+    {
+        CPLDebug("GDAL", "ChunkAndWarpMulti(): warp chunk processors are set. "
+                         "Warp kernels will be serialized");
+    }
+    else if (nThreads > 1 && psOptions->pTransformerArg != nullptr)
+    {
+        for (auto &sData : asThreadData)
         {
-            GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
-            const double dfChunkPixels =
-                pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
-
-            asThreadData[iThread].dfProgressBase =
-                dfPixelsProcessed / dfTotalPixels;
-            asThreadData[iThread].dfProgressScale =
-                dfChunkPixels / dfTotalPixels;
-
-            dfPixelsProcessed += dfChunkPixels;
-
-            asThreadData[iThread].pasChunkInfo = pasThisChunk;
+            void *pClonedTransformerArg = nullptr;
+            {
+                CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+                pClonedTransformerArg =
+                    GDALCloneTransformer(psOptions->pTransformerArg);
+            }
+            if (pClonedTransformerArg == nullptr)
+            {
+                CPLDebug("GDAL", "ChunkAndWarpMulti(): cannot clone the "
+                                 "transformer. Warp kernels will be "
+                                 "serialized");
+                break;
+            }
 
-            if (iChunk == 0)
+            GDALWarpOptions *psThreadOptions = GDALCloneWarpOptions(psOptions);
+            GDALTransformerFunc pfnTransformer =
+                psThreadOptions->pfnTransformer;
+            psThreadOptions->pfnTransformer = nullptr;
+            psThreadOptions->pTransformerArg = nullptr;
+            psThreadOptions->pfnProgress = ChunkProgress;
+            psThreadOptions->pProgressArg = &sData;
+            auto poOperation = std::make_unique<GDALWarpOperation>();
+            const CPLErr eInitErr = poOperation->Initialize(
+                psThreadOptions, pfnTransformer,
+                GDALTransformerArgUniquePtr(pClonedTransformerArg));
+            GDALDestroyWarpOptions(psThreadOptions);
+            if (eInitErr != CE_None)
             {
-                asThreadData[iThread].hCond = hCond;
-                asThreadData[iThread].hCondMutex = hCondMutex;
+                eErr = eInitErr;
+                break;
             }
-            else
+
+            // Share the IO mutex, but use a per-operation warp mutex.
+            poOperation->hIOMutex = hIOMutex;
+            poOperation->hWarpMutex = CPLCreateMutex();
+            CPLReleaseMutex(poOperation->hWarpMutex);
+            poOperation->m_bSrcThreadSafe = m_bSrcThreadSafe;
+            sData.poOperation = poOperation.get();
+            sData.poOwnedOperation = std::move(poOperation);
+        }
+
+        if (eErr == CE_None && !asThreadData.back().poOwnedOperation)
+        {
+            for (auto &sData : asThreadData)
             {
-                asThreadData[iThread].hCond = nullptr;
-                asThreadData[iThread].hCondMutex = nullptr;
+                sData.poOperation = this;
+                sData.poOwnedOperation.reset();
             }
-            asThreadData[iThread].bIOMutexTaken = FALSE;
+        }
+    }
 
-            CPLDebug("GDAL", "Start chunk %d / %d.", iChunk, nChunkListCount);
-            asThreadData[iThread].hThreadHandle = CPLCreateJoinableThread(
-                ChunkThreadMain,
-                const_cast<ChunkThreadData *>(&asThreadData[iThread]));
-            if (asThreadData[iThread].hThreadHandle == nullptr)
+    // When this operation is shared by the threads, temporarily redirect its
+    // progress function, so that progress is aggregated as for the cloned
+    // operations.
+    const bool bSharedOperation = !asThreadData.front().poOwnedOperation;
+    if (bSharedOperation)
+    {
+        psOptions->pfnProgress = ChunkSharedProgress;
+        psOptions->pProgressArg = nullptr;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Launch the threads, and wait for them to complete.              */
+    /* -------------------------------------------------------------------- */
+    if (eErr == CE_None)
+    {
+        CPLDebug("GDAL", "ChunkAndWarpMulti(): %d chunks, %d threads%s",
+                 nChunkListCount, nThreads,
+                 m_bSrcThreadSafe ? ", concurrent source reads" : "");
+        for (auto &sData : asThreadData)
+        {
+            sData.hThreadHandle =
+                CPLCreateJoinableThread(ChunkThreadMain, &sData);
+            if (sData.hThreadHandle == nullptr)
             {
                 CPLError(
                     CE_Failure, CPLE_AppDefined,
                     "CPLCreateJoinableThread() failed in ChunkAndWarpMulti()");
+                sContext.bStop = true;
                 eErr = CE_Failure;
                 break;
             }
-
-            // Wait that the first thread has acquired the IO mutex before
-            // proceeding.  This will ensure that the first thread will run
-            // before the second one.
-            if (iChunk == 0)
-            {
-                CPLAcquireMutex(hCondMutex, 1.0);
-                while (asThreadData[iThread].bIOMutexTaken == FALSE)
-                    CPLCondWait(hCond, hCondMutex);
-                CPLReleaseMutex(hCondMutex);
-            }
         }
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Wait for previous chunks thread to complete. */
-        /* --------------------------------------------------------------------
-         */
-        if (iChunk > 0)
+        for (auto &sData : asThreadData)
         {
-            iThread = (iChunk - 1) % 2;
-
-            // Wait for thread to finish.
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
-            asThreadData[iThread].hThreadHandle = nullptr;
-
-            CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk - 1,
-                     nChunkListCount);
-
-            eErr = asThreadData[iThread].eErr;
-
-            if (eErr != CE_None)
-                break;
+            if (sData.hThreadHandle)
+                CPLJoinThread(sData.hThreadHandle);
+            if (eErr == CE_None)
+                eErr = sData.eErr;
         }
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Wait for all threads to complete.                               */
-    /* -------------------------------------------------------------------- */
-    for (int iThread = 0; iThread < 2; iThread++)
+    if (bSharedOperation)
+    {
+        psOptions->pfnProgress = sContext.pfnProgress;
+        psOptions->pProgressArg = sContext.pProgressArg;
+    }
+
+    for (auto &sData : asThreadData)
     {
-        if (asThreadData[iThread].hThreadHandle)
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
+        if (sData.poOwnedOperation)
+        {
+            CPLDestroyMutex(sData.poOwnedOperation->hWarpMutex);
+            sData.poOwnedOperation->hIOMutex = nullptr;
+            sData.poOwnedOperation->hWarpMutex = nullptr;
+        }
     }
 
-    CPLDestroyCond(hCond);
-    CPLDestroyMutex(hCondMutex);
+    // Revert to the single-threaded operating mode of WarpRegion()
+    CPLDestroyMutex(hIOMutex);
+    CPLDestroyMutex(hWarpMutex);
+    hIOMutex = nullptr;
+    hWarpMutex = nullptr;
+    m_bSrcThreadSafe = false;
 
     WipeChunkList();
 
-    oErrorAccumulator.ReplayErrors();
+    sContext.oErrorAccumulator.ReplayErrors();
 
     psOptions->pfnProgress(1.0, "", psOptions->pProgressArg);
 
@@ -1996,6 +2155,15 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     }
 #endif
 
+    /* -------------------------------------------------------------------- */
+    /*      If the source dataset is thread-safe, release the IO mutex      */
+    /*      while reading from it. It is only re-acquired around the        */
+    /*      accesses to the destination dataset.                            */
+    /* -------------------------------------------------------------------- */
+    const bool bUnlockedSrcRead = hIOMutex != nullptr && m_bSrcThreadSafe;
+    if (bUnlockedSrcRead)
+        CPLReleaseMutex(hIOMutex);
+
     oWK.papabySrcImage = static_cast<GByte **>(
         CPLCalloc(sizeof(GByte *), psOptions->nBandCount));
     oWK.papabySrcImage[0] =
@@ -2144,11 +2312,22 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
 
         eErr = CreateKernelMask(&oWK, 0 /* not used */, "DstDensity");
 
-        if (eErr == CE_None)
+        if (eErr == CE_None && bUnlockedSrcRead &&
+            !CPLAcquireMutex(hIOMutex, 600.0))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failed to acquire IOMutex in WarpRegion().");
+            eErr = CE_Failure;
+        }
+        else if (eErr == CE_None)
+        {
             eErr = GDALWarpDstAlphaMasker(
                 psOptions, psOptions->nBandCount, psOptions->eWorkingDataType,
                 oWK.nDstXOff, oWK.nDstYOff, oWK.nDstXSize, oWK.nDstYSize,
                 oWK.papabyDstImage, TRUE, oWK.pafDstDensity);
+            if (bUnlockedSrcRead)
+                CPLReleaseMutex(hIOMutex);
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -2359,7 +2538,8 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     if (hIOMutex != nullptr)
     {
-        CPLReleaseMutex(hIOMutex);
+        if (!bUnlockedSrcRead)
+            CPLReleaseMutex(hIOMutex);
         if (!CPLAcquireMutex(hWarpMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -2724,6 +2904,32 @@ bool GDALWarpOperation::ComputeSourceWindowTransformPoints(
     nSamplePoints = 0;
     nFailedCount = 0;
 
+    // Look up the result in the GDAL_WARP_TRANSFORM_CACHE_SIZE cache of
+    // transformed coordinates.
+    std::string osCacheKey = GDALWarpTransformCacheGetKey(
+        psOptions->pfnTransformer, psOptions->pTransformerArg);
+    if (!osCacheKey.empty())
+    {
+        osCacheKey += CPLSPrintf("|src_window|%d,%d,%d,%d,%d,%d,%d,%d",
+                                 nDstXOff, nDstYOff, nDstXSize, nDstYSize,
+                                 bUseGrid, bAll, nStepCount,
+                                 bTryWithCheckWithInvertProj);
+        const auto poCached = GDALWarpTransformCacheGet(osCacheKey);
+        if (poCached)
+        {
+            CPLAssert(poCached->size() == 6);
+            CPLDebug("WARP", "Using cached source window sample points");
+            const auto &adfCached = *poCached;
+            dfMinXOut = std::min(dfMinXOut, adfCached[0]);
+            dfMinYOut = std::min(dfMinYOut, adfCached[1]);
+            dfMaxXOut = std::max(dfMaxXOut, adfCached[2]);
+            dfMaxYOut = std::max(dfMaxYOut, adfCached[3]);
+            nSamplePoints = static_cast<int>(adfCached[4]);
+            nFailedCount = static_cast<int>(adfCached[5]);
+            return true;
+        }
+    }
+
     const double dfStepSize = bAll ? 0 : 1.0 / (nStepCount - 1);
     constexpr int knIntMax = std::numeric_limits<int>::max();
     int nSampleMax = 0;
@@ -2922,6 +3128,10 @@ bool GDALWarpOperation::ComputeSourceWindowTransformPoints(
     /* -------------------------------------------------------------------- */
     /*      Collect the bounds, ignoring any failed points.                 */
     /* -------------------------------------------------------------------- */
+    double dfMinX = std::numeric_limits<double>::infinity();
+    double dfMinY = std::numeric_limits<double>::infinity();
+    double dfMaxX = -std::numeric_limits<double>::infinity();
+    double dfMaxY = -std::numeric_limits<double>::infinity();
     for (int i = 0; i < nSamplePoints; i++)
     {
         if (!pabSuccess[i])
@@ -2946,10 +3156,25 @@ bool GDALWarpOperation::ComputeSourceWindowTransformPoints(
             continue;
         }
 
-        dfMinXOut = std::min(dfMinXOut, padfX[i]);
-        dfMinYOut = std::min(dfMinYOut, padfY[i]);
-        dfMaxXOut = std::max(dfMaxXOut, padfX[i]);
-        dfMaxYOut = std::max(dfMaxYOut, padfY[i]);
+        dfMinX = std::min(dfMinX, padfX[i]);
+        dfMinY = std::min(dfMinY, padfY[i]);
+        dfMaxX = std::max(dfMaxX, padfX[i]);
+        dfMaxY = std::max(dfMaxY, padfY[i]);
+    }
+
+    dfMinXOut = std::min(dfMinXOut, dfMinX);
+    dfMinYOut = std::min(dfMinYOut, dfMinY);
+    dfMaxXOut = std::max(dfMaxXOut, dfMaxX);
+    dfMaxYOut = std::max(dfMaxYOut, dfMaxY);
+
+    if (!osCacheKey.empty())
+    {
+        GDALWarpTransformCachePut(
+            osCacheKey, std::make_shared<const std::vector<double>>(
+                            std::vector<double>{
+                                dfMinX, dfMinY, dfMaxX, dfMaxY,
+                                static_cast<double>(nSamplePoints),
+                                static_cast<double>(nFailedCount)}));
     }
 
     CPLFree(padfX);
@@ -42,15 +42,20 @@
 #include "gdalalg_raster_viewshed.h"
 
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
+#include "memdataset.h"
 
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <mutex>
+#include <utility>
 
 //! @cond Doxygen_Suppress
 
@@ -801,4 +806,490 @@ GDALRasterPipelineNonNativelyStreamingAlgorithm::CreateTemporaryCopy(
     return poOutDS;
 }
 
+/************************************************************************/
+/*                       IsTiledStreamingEnabled()                      */
+/************************************************************************/
+
+/* static */
+bool GDALRasterPipelineNonNativelyStreamingAlgorithm::IsTiledStreamingEnabled()
+{
+    return CPLTestBool(
+        CPLGetConfigOption("GDAL_RASTER_PIPELINE_TILED_STREAMING", "NO"));
+}
+
+/************************************************************************/
+/*                   GDALRasterPipelineTiledDataset                     */
+/************************************************************************/
+
+namespace
+{
+
+/** Dataset whose blocks are computed on demand by running a
+ * WindowProcessingFunc on the corresponding window of the source dataset,
+ * extended by a halo of nHalo pixels on each side.
+ */
+class GDALRasterPipelineTiledDataset final : public GDALDataset
+{
+  public:
+    using WindowProcessingFunc =
+        GDALRasterPipelineNonNativelyStreamingAlgorithm::WindowProcessingFunc;
+
+    GDALRasterPipelineTiledDataset(GDALDataset *poSrcDS,
+                                   const std::vector<int> &anSrcBands,
+                                   int nDstBands, GDALDataType eDstDT,
+                                   int nHalo, WindowProcessingFunc pfnFunc);
+    ~GDALRasterPipelineTiledDataset() override;
+
+    const OGRSpatialReference *GetSpatialRef() const override
+    {
+        return m_oSRS.IsEmpty() ? nullptr : &m_oSRS;
+    }
+
+    CPLErr GetGeoTransform(double *padfGT) override
+    {
+        memcpy(padfGT, m_adfGT, sizeof(m_adfGT));
+        return m_bHasGT ? CE_None : CE_Failure;
+    }
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
+  private:
+    friend class GDALRasterPipelineTiledBand;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALRasterPipelineTiledDataset)
+
+    GDALDataset *const m_poSrcDS;
+    const std::vector<int> m_anSrcBands;
+    const GDALDataType m_eDstDT;
+    const int m_nHalo;
+    const int m_nBlockSize;
+    const WindowProcessingFunc m_pfnFunc;
+
+    //! Properties of m_poSrcDS, cached so that ComputeBlock() does not need
+    //! to query them from worker threads.
+    GDALDataType m_eSrcDT = GDT_Unknown;
+    bool m_bHasGT = false;
+    double m_adfGT[6] = {0, 1, 0, 0, 0, 1};
+    OGRSpatialReference m_oSRS{};
+
+    //! Serializes accesses to m_poSrcDS, which is not assumed to be
+    //! thread-safe.
+    std::mutex m_oSrcMutex{};
+
+    size_t GetBlockSizeBytes() const
+    {
+        return static_cast<size_t>(m_nBlockSize) * m_nBlockSize *
+               GDALGetDataTypeSizeBytes(m_eDstDT);
+    }
+
+    bool ComputeBlock(int nBlockXOff, int nBlockYOff,
+                      std::vector<GByte> &abyBlocks);
+    void CacheBlocks(int nBlockXOff, int nBlockYOff,
+                     const std::vector<GByte> &abyBlocks, int nSkipBand);
+    bool PrefetchBlocks(int nXOff, int nYOff, int nXSize, int nYSize);
+};
+
+/************************************************************************/
+/*                     GDALRasterPipelineTiledBand                      */
+/************************************************************************/
+
+class GDALRasterPipelineTiledBand final : public GDALRasterBand
+{
+  public:
+    GDALRasterPipelineTiledBand(GDALRasterPipelineTiledDataset *poDSIn,
+                                int nBandIn);
+
+    double GetNoDataValue(int *pbSuccess) override
+    {
+        if (pbSuccess)
+            *pbSuccess = m_bHasNoData;
+        return m_dfNoData;
+    }
+
+    CPLErr SetNoDataValue(double dfNoData) override
+    {
+        m_bHasNoData = true;
+        m_dfNoData = dfNoData;
+        return CE_None;
+    }
+
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage) override;
+
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
+  private:
+    friend class GDALRasterPipelineTiledDataset;
+
+    bool m_bHasNoData = false;
+    double m_dfNoData = 0;
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                   GDALRasterPipelineTiledDataset()                   */
+/************************************************************************/
+
+GDALRasterPipelineTiledDataset::GDALRasterPipelineTiledDataset(
+    GDALDataset *poSrcDS, const std::vector<int> &anSrcBands, int nDstBands,
+    GDALDataType eDstDT, int nHalo, WindowProcessingFunc pfnFunc)
+    : m_poSrcDS(poSrcDS), m_anSrcBands(anSrcBands), m_eDstDT(eDstDT),
+      m_nHalo(nHalo), m_nBlockSize(std::max(256, 2 * nHalo)),
+      m_pfnFunc(std::move(pfnFunc))
+{
+    m_poSrcDS->Reference();
+    nRasterXSize = m_poSrcDS->GetRasterXSize();
+    nRasterYSize = m_poSrcDS->GetRasterYSize();
+    for (const int nSrcBand : m_anSrcBands)
+    {
+        m_eSrcDT = GDALDataTypeUnion(
+            m_eSrcDT, m_poSrcDS->GetRasterBand(nSrcBand)->GetRasterDataType());
+    }
+    m_bHasGT = m_poSrcDS->GetGeoTransform(m_adfGT) == CE_None;
+    if (const auto poSRS = m_poSrcDS->GetSpatialRef())
+        m_oSRS = *poSRS;
+    for (int i = 0; i < nDstBands; ++i)
+        SetBand(i + 1, new GDALRasterPipelineTiledBand(this, i + 1));
+    SetDescription(m_poSrcDS->GetDescription());
+}
+
+/************************************************************************/
+/*                  ~GDALRasterPipelineTiledDataset()                   */
+/************************************************************************/
+
+GDALRasterPipelineTiledDataset::~GDALRasterPipelineTiledDataset()
+{
+    GDALRasterPipelineTiledDataset::FlushCache(true);
+    m_poSrcDS->ReleaseRef();
+}
+
+/************************************************************************/
+/*                            ComputeBlock()                            */
+/************************************************************************/
+
+/** Computes the block (nBlockXOff, nBlockYOff) of all bands into
+ * abyBlocks, as a band-sequential array of full blocks.
+ *
+ * May be called from a worker thread.
+ */
+bool GDALRasterPipelineTiledDataset::ComputeBlock(int nBlockXOff,
+                                                  int nBlockYOff,
+                                                  std::vector<GByte> &abyBlocks)
+{
+    const int nXOff = nBlockXOff * m_nBlockSize;
+    const int nYOff = nBlockYOff * m_nBlockSize;
+    const int nReqXSize = std::min(m_nBlockSize, nRasterXSize - nXOff);
+    const int nReqYSize = std::min(m_nBlockSize, nRasterYSize - nYOff);
+
+    const int nWinXOff = std::max(0, nXOff - m_nHalo);
+    const int nWinYOff = std::max(0, nYOff - m_nHalo);
+    const int nWinXSize =
+        static_cast<int>(std::min<int64_t>(
+            nRasterXSize, static_cast<int64_t>(nXOff) + nReqXSize + m_nHalo)) -
+        nWinXOff;
+    const int nWinYSize =
+        static_cast<int>(std::min<int64_t>(
+            nRasterYSize, static_cast<int64_t>(nYOff) + nReqYSize + m_nHalo)) -
+        nWinYOff;
+
+    const GDALDataType eSrcDT = m_eSrcDT;
+
+    std::unique_ptr<GDALDataset> poSrcWindowDS(MEMDataset::Create(
+        "", nWinXSize, nWinYSize, static_cast<int>(m_anSrcBands.size()),
+        eSrcDT, nullptr));
+    std::unique_ptr<GDALDataset> poDstWindowDS(MEMDataset::Create(
+        "", nWinXSize, nWinYSize, nBands, m_eDstDT, nullptr));
+    if (!poSrcWindowDS || !poDstWindowDS)
+        return false;
+
+    double adfGT[6];
+    memcpy(adfGT, m_adfGT, sizeof(adfGT));
+    if (m_bHasGT)
+    {
+        adfGT[0] += nWinXOff * adfGT[1] + nWinYOff * adfGT[2];
+        adfGT[3] += nWinXOff * adfGT[4] + nWinYOff * adfGT[5];
+    }
+    for (GDALDataset *poWindowDS : {poSrcWindowDS.get(), poDstWindowDS.get()})
+    {
+        if (m_bHasGT)
+            poWindowDS->SetGeoTransform(adfGT);
+        poWindowDS->SetSpatialRef(GetSpatialRef());
+    }
+
+    {
+        std::lock_guard oLock(m_oSrcMutex);
+        for (int i = 0; i < static_cast<int>(m_anSrcBands.size()); ++i)
+        {
+            auto poSrcBand = m_poSrcDS->GetRasterBand(m_anSrcBands[i]);
+            auto poWindowBand = cpl::down_cast<MEMRasterBand *>(
+                poSrcWindowDS->GetRasterBand(i + 1));
+            int bHasNoData = FALSE;
+            const double dfNoData = poSrcBand->GetNoDataValue(&bHasNoData);
+            if (bHasNoData)
+                poWindowBand->SetNoDataValue(dfNoData);
+            if (poSrcBand->RasterIO(GF_Read, nWinXOff, nWinYOff, nWinXSize,
+                                    nWinYSize, poWindowBand->GetData(),
+                                    nWinXSize, nWinYSize, eSrcDT, 0, 0,
+                                    nullptr) != CE_None)
+            {
+                return false;
+            }
+        }
+    }
+
+    for (int i = 1; i <= nBands; ++i)
+    {
+        auto poBand =
+            cpl::down_cast<GDALRasterPipelineTiledBand *>(GetRasterBand(i));
+        if (poBand->m_bHasNoData)
+            poDstWindowDS->GetRasterBand(i)->SetNoDataValue(
+                poBand->m_dfNoData);
+    }
+
+    if (!m_pfnFunc(poSrcWindowDS.get(), poDstWindowDS.get()))
+        return false;
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(m_eDstDT);
+    abyBlocks.clear();
+    abyBlocks.resize(GetBlockSizeBytes() * nBands);
+    for (int i = 0; i < nBands; ++i)
+    {
+        if (poDstWindowDS->GetRasterBand(i + 1)->RasterIO(
+                GF_Read, nXOff - nWinXOff, nYOff - nWinYOff, nReqXSize,
+                nReqYSize, abyBlocks.data() + i * GetBlockSizeBytes(),
+                nReqXSize, nReqYSize, m_eDstDT, nDTSize,
+                static_cast<GSpacing>(nDTSize) * m_nBlockSize,
+                nullptr) != CE_None)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                             CacheBlocks()                            */
+/************************************************************************/
+
+/** Installs in the block cache the blocks computed by ComputeBlock(),
+ * except the one of band nSkipBand (1-based), and the ones that are already
+ * cached.
+ */
+void GDALRasterPipelineTiledDataset::CacheBlocks(
+    int nBlockXOff, int nBlockYOff, const std::vector<GByte> &abyBlocks,
+    int nSkipBand)
+{
+    for (int i = 1; i <= nBands; ++i)
+    {
+        if (i == nSkipBand)
+            continue;
+        auto poBand = GetRasterBand(i);
+        GDALRasterBlock *poBlock =
+            poBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+        if (!poBlock)
+        {
+            poBlock = poBand->GetLockedBlockRef(nBlockXOff, nBlockYOff,
+                                                /* bJustInitialize = */ TRUE);
+            if (!poBlock)
+                continue;
+            memcpy(poBlock->GetDataRef(),
+                   abyBlocks.data() + (i - 1) * GetBlockSizeBytes(),
+                   GetBlockSizeBytes());
+        }
+        poBlock->DropLock();
+    }
+}
+
+/************************************************************************/
+/*                           PrefetchBlocks()                           */
+/************************************************************************/
+
+/** Computes in parallel the blocks intersecting the specified window that
+ * are not yet cached, when GDAL_NUM_THREADS is set.
+ */
+bool GDALRasterPipelineTiledDataset::PrefetchBlocks(int nXOff, int nYOff,
+                                                    int nXSize, int nYSize)
+{
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = std::max(
+        1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads)));
+    if (nThreads <= 1)
+        return true;
+
+    std::vector<std::pair<int, int>> anMissingBlocks;
+    auto poFirstBand = GetRasterBand(1);
+    for (int nBlockYOff = nYOff / m_nBlockSize;
+         nBlockYOff <= (nYOff + nYSize - 1) / m_nBlockSize; ++nBlockYOff)
+    {
+        for (int nBlockXOff = nXOff / m_nBlockSize;
+             nBlockXOff <= (nXOff + nXSize - 1) / m_nBlockSize; ++nBlockXOff)
+        {
+            GDALRasterBlock *poBlock =
+                poFirstBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+                poBlock->DropLock();
+            else
+                anMissingBlocks.emplace_back(nBlockXOff, nBlockYOff);
+        }
+    }
+    if (anMissingBlocks.size() < 2)
+        return true;
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poPool)
+        return true;
+
+    // Process the blocks by batches so that the temporary buffers are
+    // bounded in size. Computed blocks are installed in the block cache from
+    // this thread.
+    const size_t nBatchSize = static_cast<size_t>(nThreads) * 2;
+    std::vector<std::vector<GByte>> aabyBlocks(
+        std::min(nBatchSize, anMissingBlocks.size()));
+    bool bRet = true;
+    for (size_t iStart = 0; bRet && iStart < anMissingBlocks.size();
+         iStart += nBatchSize)
+    {
+        const size_t nCount =
+            std::min(nBatchSize, anMissingBlocks.size() - iStart);
+        // One accumulator per batch, since ReplayErrors() does not clear it
+        CPLErrorAccumulator oErrorAccumulator;
+        std::vector<int> abSuccess(nCount, FALSE);
+        auto poQueue = poPool->CreateJobQueue();
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            poQueue->SubmitJob(
+                [this, &anMissingBlocks, &aabyBlocks, &abSuccess,
+                 &oErrorAccumulator, iStart, i]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    const auto &oBlock = anMissingBlocks[iStart + i];
+                    abSuccess[i] = ComputeBlock(oBlock.first, oBlock.second,
+                                                aabyBlocks[i]);
+                });
+        }
+        poQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            if (!abSuccess[i])
+            {
+                bRet = false;
+                break;
+            }
+            const auto &oBlock = anMissingBlocks[iStart + i];
+            CacheBlocks(oBlock.first, oBlock.second, aabyBlocks[i], 0);
+        }
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                              IRasterIO()                             */
+/************************************************************************/
+
+CPLErr GDALRasterPipelineTiledDataset::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && !PrefetchBlocks(nXOff, nYOff, nXSize, nYSize))
+        return CE_Failure;
+    return GDALDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pData,
+                                  nBufXSize, nBufYSize, eBufType, nBandCount,
+                                  panBandMap, nPixelSpace, nLineSpace,
+                                  nBandSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                    GDALRasterPipelineTiledBand()                     */
+/************************************************************************/
+
+GDALRasterPipelineTiledBand::GDALRasterPipelineTiledBand(
+    GDALRasterPipelineTiledDataset *poDSIn, int nBandIn)
+{
+    poDS = poDSIn;
+    nBand = nBandIn;
+    nRasterXSize = poDSIn->GetRasterXSize();
+    nRasterYSize = poDSIn->GetRasterYSize();
+    eDataType = poDSIn->m_eDstDT;
+    nBlockXSize = poDSIn->m_nBlockSize;
+    nBlockYSize = poDSIn->m_nBlockSize;
+}
+
+/************************************************************************/
+/*                             IReadBlock()                             */
+/************************************************************************/
+
+CPLErr GDALRasterPipelineTiledBand::IReadBlock(int nBlockXOff, int nBlockYOff,
+                                               void *pImage)
+{
+    auto poGDS = cpl::down_cast<GDALRasterPipelineTiledDataset *>(poDS);
+    std::vector<GByte> abyBlocks;
+    if (!poGDS->ComputeBlock(nBlockXOff, nBlockYOff, abyBlocks))
+        return CE_Failure;
+    memcpy(pImage, abyBlocks.data() + (nBand - 1) * poGDS->GetBlockSizeBytes(),
+           poGDS->GetBlockSizeBytes());
+    poGDS->CacheBlocks(nBlockXOff, nBlockYOff, abyBlocks, nBand);
+    return CE_None;
+}
+
+/************************************************************************/
+/*                              IRasterIO()                             */
+/************************************************************************/
+
+CPLErr GDALRasterPipelineTiledBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    auto poGDS = cpl::down_cast<GDALRasterPipelineTiledDataset *>(poDS);
+    if (eRWFlag == GF_Read &&
+        !poGDS->PrefetchBlocks(nXOff, nYOff, nXSize, nYSize))
+        return CE_Failure;
+    return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nPixelSpace, nLineSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                     CreateTiledStreamingDataset()                    */
+/************************************************************************/
+
+/** Returns a dataset whose content is computed lazily, block by block, by
+ * calling pfnFunc on the window of poSrcDS corresponding to each block,
+ * extended by nHalo pixels on each side. This is only valid for processings
+ * where the value of an output pixel only depends on the input pixels at a
+ * distance of at most nHalo pixels.
+ *
+ * Blocks are computed in parallel when GDAL_NUM_THREADS is set and a
+ * RasterIO() request covers several blocks not yet cached.
+ */
+/* static */
+std::unique_ptr<GDALDataset>
+GDALRasterPipelineNonNativelyStreamingAlgorithm::CreateTiledStreamingDataset(
+    GDALDataset *poSrcDS, const std::vector<int> &anSrcBands, int nDstBands,
+    GDALDataType eDstDT, int nHalo, WindowProcessingFunc pfnFunc)
+{
+    CPLAssert(!anSrcBands.empty());
+    CPLAssert(nDstBands > 0);
+    CPLAssert(nHalo >= 0);
+    return std::make_unique<GDALRasterPipelineTiledDataset>(
+        poSrcDS, anSrcBands, nDstBands, eDstDT, nHalo, std::move(pfnFunc));
+}
+
 //! @endcond
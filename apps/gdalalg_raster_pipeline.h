@@ -16,6 +16,8 @@
 #include "gdalalgorithm.h"
 #include "gdalalg_abstract_pipeline.h"
 
+#include <functional>
+
 //! @cond Doxygen_Suppress
 
 /************************************************************************/
@@ -63,6 +65,17 @@ class GDALRasterPipelineStepAlgorithm /* non final */
 class GDALRasterPipelineNonNativelyStreamingAlgorithm /* non-final */
     : public GDALRasterPipelineStepAlgorithm
 {
+  public:
+    /** Function called by the dataset returned by
+     * CreateTiledStreamingDataset() to compute a window of the output.
+     * poSrcWindowDS contains the selected source bands over the window
+     * extended by the halo (clipped to the source extent), with the
+     * geotransform, SRS and nodata values of the source. poDstWindowDS has
+     * the same dimensions and must be filled by the function.
+     */
+    using WindowProcessingFunc = std::function<bool(
+        GDALDataset *poSrcWindowDS, GDALDataset *poDstWindowDS)>;
+
   protected:
     GDALRasterPipelineNonNativelyStreamingAlgorithm(
         const std::string &name, const std::string &description,
@@ -79,6 +92,13 @@ class GDALRasterPipelineNonNativelyStreamingAlgorithm /* non-final */
     CreateTemporaryCopy(GDALAlgorithm *poAlg, GDALDataset *poSrcDS,
                         int nSingleBand, bool bTiledIfPossible,
                         GDALProgressFunc pfnProgress, void *pProgressData);
+
+    static bool IsTiledStreamingEnabled();
+
+    static std::unique_ptr<GDALDataset> CreateTiledStreamingDataset(
+        GDALDataset *poSrcDS, const std::vector<int> &anSrcBands,
+        int nDstBands, GDALDataType eDstDT, int nHalo,
+        WindowProcessingFunc pfnFunc);
 };
 
 /************************************************************************/
@@ -17,6 +17,8 @@
 #include "gdal_alg.h"
 #include "gdal_priv.h"
 
+#include <cmath>
+
 //! @cond Doxygen_Suppress
 
 #ifndef _
@@ -57,6 +59,45 @@ GDALRasterProximityAlgorithm::GDALRasterProximityAlgorithm(bool standaloneStep)
            &m_noDataValue);
 }
 
+/************************************************************************/
+/*     GDALRasterProximityAlgorithm::IsNativelyStreamingCompatible()    */
+/************************************************************************/
+
+bool GDALRasterProximityAlgorithm::IsNativelyStreamingCompatible() const
+{
+    return IsTiledStreamingEnabled() &&
+           GetArg("max-distance")->IsExplicitlySet();
+}
+
+/************************************************************************/
+/*         GDALRasterProximityAlgorithm::GetTiledStreamingHalo()        */
+/************************************************************************/
+
+/** Returns the halo, in pixels, to use to compute the output by blocks,
+ * or -1 if the output must be computed in a single pass.
+ */
+int GDALRasterProximityAlgorithm::GetTiledStreamingHalo(
+    GDALDataset *poSrcDS) const
+{
+    if (!IsNativelyStreamingCompatible())
+        return -1;
+
+    double dfMaxDistPixels = m_maxDistance;
+    if (EQUAL(m_distanceUnits.c_str(), "geo"))
+    {
+        // Same logic as GDALComputeProximity()
+        double adfGT[6];
+        poSrcDS->GetGeoTransform(adfGT);
+        dfMaxDistPixels /= std::abs(adfGT[1]);
+    }
+
+    // Beyond that, the overhead of the halo is not worth it.
+    constexpr double MAX_HALO = 1024;
+    if (!(dfMaxDistPixels >= 0 && dfMaxDistPixels < MAX_HALO))
+        return -1;
+    return static_cast<int>(std::ceil(dfMaxDistPixels)) + 1;
+}
+
 /************************************************************************/
 /*                 GDALRasterProximityAlgorithm::RunStep()              */
 /************************************************************************/
@@ -75,18 +116,6 @@ bool GDALRasterProximityAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         outputType = GDALGetDataTypeByName(m_outputDataType.c_str());
     }
 
-    auto poTmpDS = CreateTemporaryDataset(
-        poSrcDS->GetRasterXSize(), poSrcDS->GetRasterYSize(), 1, outputType,
-        /* bTiledIfPossible = */ true, poSrcDS, /* bCopyMetadata = */ false);
-    if (!poTmpDS)
-        return false;
-
-    const auto srcBand = poSrcDS->GetRasterBand(m_inputBand);
-    CPLAssert(srcBand);
-
-    const auto dstBand = poTmpDS->GetRasterBand(1);
-    CPLAssert(dstBand);
-
     // Build options for GDALComputeProximity
     CPLStringList proximityOptions;
 
@@ -110,7 +139,6 @@ bool GDALRasterProximityAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     if (GetArg("nodata")->IsExplicitlySet())
     {
         proximityOptions.AddString(CPLSPrintf("NODATA=%.17g", m_noDataValue));
-        dstBand->SetNoDataValue(m_noDataValue);
     }
 
     // Always set this to YES. Note that this was NOT the
@@ -130,6 +158,43 @@ bool GDALRasterProximityAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
             CPLSPrintf("VALUES=%s", targetPixelValues.c_str()));
     }
 
+    const int nHalo = GetTiledStreamingHalo(poSrcDS);
+    if (nHalo >= 0)
+    {
+        // Output pixels only depend on the input pixels at a distance of at
+        // most MAXDIST, so the output can be computed block by block.
+        auto poTiledDS = CreateTiledStreamingDataset(
+            poSrcDS, {m_inputBand}, 1, outputType, nHalo,
+            [proximityOptions](GDALDataset *poSrcWindowDS,
+                               GDALDataset *poDstWindowDS)
+            {
+                return GDALComputeProximity(
+                           poSrcWindowDS->GetRasterBand(1),
+                           poDstWindowDS->GetRasterBand(1),
+                           const_cast<char **>(proximityOptions.List()),
+                           nullptr, nullptr) == CE_None;
+            });
+        if (GetArg("nodata")->IsExplicitlySet())
+            poTiledDS->GetRasterBand(1)->SetNoDataValue(m_noDataValue);
+        m_outputDataset.Set(std::move(poTiledDS));
+        return true;
+    }
+
+    auto poTmpDS = CreateTemporaryDataset(
+        poSrcDS->GetRasterXSize(), poSrcDS->GetRasterYSize(), 1, outputType,
+        /* bTiledIfPossible = */ true, poSrcDS, /* bCopyMetadata = */ false);
+    if (!poTmpDS)
+        return false;
+
+    const auto srcBand = poSrcDS->GetRasterBand(m_inputBand);
+    CPLAssert(srcBand);
+
+    const auto dstBand = poTmpDS->GetRasterBand(1);
+    CPLAssert(dstBand);
+
+    if (GetArg("nodata")->IsExplicitlySet())
+        dstBand->SetNoDataValue(m_noDataValue);
+
     const auto error = GDALComputeProximity(srcBand, dstBand, proximityOptions,
                                             pfnProgress, pProgressData);
     if (error == CE_None)
@@ -33,9 +33,13 @@ class GDALRasterProximityAlgorithm /* non final */
 
     explicit GDALRasterProximityAlgorithm(bool standaloneStep = false);
 
+    bool IsNativelyStreamingCompatible() const override;
+
   private:
     bool RunStep(GDALPipelineStepRunContext &ctxt) override;
 
+    int GetTiledStreamingHalo(GDALDataset *poSrcDS) const;
+
     double m_noDataValue = 0.0;
     int m_inputBand = 1;
     std::string m_outputDataType =
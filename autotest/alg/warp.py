@@ -2037,6 +2037,116 @@ def test_warp_multi_threaded_errors(tmp_vsimem):
             gdal.Warp("", ds, format="MEM", multithread=True)
 
 
+###############################################################################
+# Test GDAL_WARP_TRANSFORM_CACHE_SIZE
+
+
+@pytest.mark.parametrize("resampling", ["near", "bilinear", "cubic", "average"])
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_warp_transform_cache(resampling, num_threads):
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    # Same georeferencing, different pixel values
+    other_src_ds = gdal.GetDriverByName("MEM").CreateCopy("", src_ds)
+    other_src_ds.WriteRaster(0, 0, 20, 20, bytes(reversed(src_ds.ReadRaster())))
+
+    options = f"-of MEM -t_srs EPSG:4326 -r {resampling} -wo NUM_THREADS={num_threads}"
+    ref_cs = gdal.Warp("", src_ds, options=options).GetRasterBand(1).Checksum()
+    other_ref_cs = (
+        gdal.Warp("", other_src_ds, options=options).GetRasterBand(1).Checksum()
+    )
+    assert other_ref_cs != ref_cs
+
+    def warp(ds):
+        debug_msgs = []
+
+        def handler(err_class, err_no, msg):
+            if err_class == gdal.CE_Debug:
+                debug_msgs.append(msg)
+
+        with gdaltest.error_handler(handler):
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            with gdal.config_options(
+                {
+                    "GDAL_WARP_TRANSFORM_CACHE_SIZE": "10MB",
+                    "WARP_THREAD_CHUNK_SIZE": "0",
+                    "CPL_DEBUG": "WARP",
+                }
+            ):
+                cs = gdal.Warp("", ds, options=options).GetRasterBand(1).Checksum()
+        return cs, debug_msgs
+
+    kernel_hit_msg = (
+        "WARP: Using cached source coordinates of the destination pixel centers"
+    )
+    window_hit_msg = "WARP: Using cached source window sample points"
+
+    # The first run populates the cache (unless a previous parametrization of
+    # this test already did it), the next ones use it
+    for i, (ds, expected_cs) in enumerate(
+        [
+            (src_ds, ref_cs),
+            (src_ds, ref_cs),
+            (other_src_ds, other_ref_cs),
+        ]
+    ):
+        cs, debug_msgs = warp(ds)
+        assert cs == expected_cs
+        if i > 0:
+            assert window_hit_msg in debug_msgs
+            # Those methods do not transform the destination pixel centers
+            if resampling == "average":
+                assert kernel_hit_msg not in debug_msgs
+            else:
+                assert kernel_hit_msg in debug_msgs
+
+
+###############################################################################
+# Test the row fetching of the resampling kernels with a source validity mask
+# and a source density. Non-complex data types use a specialized code path,
+# which must give the same result as the generic one used for complex types.
+
+
+@pytest.mark.parametrize("resampling", ["bilinear", "cubic", "lanczos"])
+def test_warp_row_fetch_validity_mask_and_density(resampling):
+
+    size = 32
+    values = [
+        255.0 if (i * 7) % 11 == 0 else float(i % 200) for i in range(size * size)
+    ]
+    alpha = [float((i * 13) % 256) for i in range(size * size)]
+
+    def warp(dt):
+        src_ds = gdal.GetDriverByName("MEM").Create("", size, size, 2, dt)
+        src_ds.SetGeoTransform([0, 1, 0, size, 0, -1])
+        for i, band_values in enumerate([values, alpha]):
+            src_ds.GetRasterBand(i + 1).WriteRaster(
+                0,
+                0,
+                size,
+                size,
+                struct.pack("f" * (size * size), *band_values),
+                buf_type=gdal.GDT_Float32,
+            )
+        out_ds = gdal.Warp(
+            "",
+            src_ds,
+            format="MEM",
+            xRes=0.7,
+            yRes=0.7,
+            resampleAlg=resampling,
+            srcNodata=255,
+            srcAlpha=True,
+        )
+        assert out_ds.RasterCount == 1
+        data = out_ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Float32)
+        return struct.unpack("f" * (len(data) // 4), data)
+
+    got = warp(gdal.GDT_Float32)
+    assert any(v != 0 for v in got)
+    assert got == pytest.approx(warp(gdal.GDT_CFloat32), rel=1e-6)
+
+
 ###############################################################################
 
 
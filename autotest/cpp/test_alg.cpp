@@ -11,6 +11,8 @@
  ****************************************************************************/
 
 #include <array>
+#include <cmath>
+#include <vector>
 
 #include "gdal_unit_test.h"
 
@@ -506,4 +508,60 @@ TEST_F(test_alg, GDALIsLineOfSightVisible_through_mountain)
                                          nullptr, nullptr, nullptr));
 }
 
+// Test GDALApproxTransform() with a non-linear base transformer
+TEST_F(test_alg, GDALApproxTransform)
+{
+    struct BaseTransformer
+    {
+        int nCalls = 0;
+
+        static int Transform(void *pCBData, int /* bDstToSrc */,
+                             int nPointCount, double *x, double *y,
+                             double * /* z */, int *panSuccess)
+        {
+            static_cast<BaseTransformer *>(pCBData)->nCalls++;
+            for (int i = 0; i < nPointCount; ++i)
+            {
+                const double dfX = x[i];
+                x[i] = dfX + 30 * sin(dfX * 1e-2) + y[i] * 0.1;
+                y[i] = y[i] + 50 * cos(dfX * 3e-3);
+                panSuccess[i] = TRUE;
+            }
+            return TRUE;
+        }
+    };
+
+    BaseTransformer oBase;
+    constexpr double MAX_ERROR = 0.125;
+    void *hTransformArg = GDALCreateApproxTransformer(
+        BaseTransformer::Transform, &oBase, MAX_ERROR);
+    ASSERT_TRUE(hTransformArg != nullptr);
+
+    constexpr int N = 10000;
+    std::vector<double> adfX(N), adfY(N, 10.5), adfZ(N);
+    for (int i = 0; i < N; ++i)
+        adfX[i] = i + 0.5;
+    std::vector<double> adfXRef(adfX), adfYRef(adfY), adfZRef(adfZ);
+    std::vector<int> anSuccess(N), anSuccessRef(N);
+
+    EXPECT_TRUE(GDALApproxTransform(hTransformArg, TRUE, N, adfX.data(),
+                                    adfY.data(), adfZ.data(),
+                                    anSuccess.data()));
+    // The subdivisions of the row are transformed in batches, with one
+    // call to the base transformer per subdivision level.
+    EXPECT_LE(oBase.nCalls, 20);
+
+    EXPECT_TRUE(BaseTransformer::Transform(&oBase, TRUE, N, adfXRef.data(),
+                                           adfYRef.data(), adfZRef.data(),
+                                           anSuccessRef.data()));
+    for (int i = 0; i < N; ++i)
+    {
+        EXPECT_TRUE(anSuccess[i]);
+        EXPECT_NEAR(adfX[i], adfXRef[i], 4 * MAX_ERROR);
+        EXPECT_NEAR(adfY[i], adfYRef[i], 4 * MAX_ERROR);
+    }
+
+    GDALDestroyApproxTransformer(hTransformArg);
+}
+
 }  // namespace
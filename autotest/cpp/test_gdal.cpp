@@ -5873,4 +5873,428 @@ TEST_F(test_gdal, GDALRasterBand_arithmetic_operators)
         std::runtime_error);
 }
 
+// Test that chains of the same operation are fused into a single pixel
+// function evaluation
+TEST_F(test_gdal, GDALRasterBand_arithmetic_operators_fused)
+{
+    auto poMemDrv = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poMemDrv)
+    {
+        GTEST_SKIP() << "MEM driver missing";
+    }
+    constexpr int WIDTH = 3;
+    constexpr int HEIGHT = 2;
+    auto poDS = std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>(
+        poMemDrv->Create("", WIDTH, HEIGHT, 4, GDT_Float64, nullptr));
+    auto &firstBand = *(poDS->GetRasterBand(1));
+    auto &secondBand = *(poDS->GetRasterBand(2));
+    auto &thirdBand = *(poDS->GetRasterBand(3));
+    auto &fourthBand = *(poDS->GetRasterBand(4));
+    constexpr double FIRST = 0.1;
+    firstBand.Fill(FIRST);
+    constexpr double SECOND = 0.2;
+    secondBand.Fill(SECOND);
+    constexpr double THIRD = 0.3;
+    thirdBand.Fill(THIRD);
+    constexpr double FOURTH = 0.7;
+    fourthBand.Fill(FOURTH);
+
+    // Count sources, including the ones of nested computed bands, which are
+    // serialized inline
+    const auto CountSources = [](GDALComputedRasterBand &band)
+    {
+        char **papszXML = band.GetDataset()->GetMetadata("xml:VRT");
+        EXPECT_NE(papszXML, nullptr);
+        int nCount = 0;
+        for (const char *pszIter = papszXML ? papszXML[0] : "";
+             (pszIter = strstr(pszIter, "<SourceBand>")) != nullptr;
+             ++pszIter)
+        {
+            ++nCount;
+        }
+        return nCount;
+    };
+
+    {
+        auto sum = firstBand + secondBand + thirdBand + fourthBand;
+        EXPECT_EQ(sum.GetRasterDataType(), GDT_Float64);
+        EXPECT_EQ(CountSources(sum), 4);
+        std::vector<double> adfResults(WIDTH * HEIGHT);
+        EXPECT_EQ(sum.RasterIO(GF_Read, 0, 0, WIDTH, HEIGHT, adfResults.data(),
+                               WIDTH, HEIGHT, GDT_Float64, 0, 0, nullptr),
+                  CE_None);
+        for (double dfVal : adfResults)
+            EXPECT_EQ(dfVal, ((FIRST + SECOND) + THIRD) + FOURTH);
+    }
+
+    {
+        auto prod = firstBand * secondBand * thirdBand;
+        EXPECT_EQ(CountSources(prod), 3);
+        double dfVal = 0;
+        EXPECT_EQ(prod.RasterIO(GF_Read, 1, 1, 1, 1, &dfVal, 1, 1, GDT_Float64,
+                                0, 0, nullptr),
+                  CE_None);
+        EXPECT_EQ(dfVal, (FIRST * SECOND) * THIRD);
+    }
+
+    {
+        auto maxVal = gdal::max(gdal::max(firstBand, fourthBand), secondBand);
+        EXPECT_EQ(CountSources(maxVal), 3);
+        double adfMinMax[2] = {0};
+        EXPECT_EQ(maxVal.ComputeRasterMinMax(false, adfMinMax), CE_None);
+        EXPECT_EQ(adfMinMax[0], FOURTH);
+    }
+
+    // Sources of fused bands are read as Float64, as the intermediate
+    // result, even if the requested buffer is Float32
+    {
+        auto poInt32DS =
+            std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>(
+                poMemDrv->Create("", WIDTH, HEIGHT, 3, GDT_Int32, nullptr));
+        poInt32DS->GetRasterBand(1)->Fill((1 << 24) + 1);
+        poInt32DS->GetRasterBand(2)->Fill(1);
+        poInt32DS->GetRasterBand(3)->Fill(0);
+        auto sum = *(poInt32DS->GetRasterBand(1)) +
+                   *(poInt32DS->GetRasterBand(2)) +
+                   *(poInt32DS->GetRasterBand(3));
+        EXPECT_EQ(sum.GetRasterDataType(), GDT_Float64);
+        EXPECT_EQ(CountSources(sum), 3);
+        std::vector<float> afResults(WIDTH * HEIGHT);
+        EXPECT_EQ(sum.RasterIO(GF_Read, 0, 0, WIDTH, HEIGHT, afResults.data(),
+                               WIDTH, HEIGHT, GDT_Float32, 0, 0, nullptr),
+                  CE_None);
+        for (float fVal : afResults)
+            EXPECT_EQ(fVal, 16777218.0f);
+    }
+
+    // Non left-most operands of min and max are not fused, as the result
+    // would depend on the position of NaN values
+    {
+        auto poNaNDS =
+            std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>(
+                poMemDrv->Create("", WIDTH, HEIGHT, 3, GDT_Float64, nullptr));
+        poNaNDS->GetRasterBand(1)->Fill(0);
+        poNaNDS->GetRasterBand(2)->Fill(
+            std::numeric_limits<double>::quiet_NaN());
+        poNaNDS->GetRasterBand(3)->Fill(1);
+        auto minVal = gdal::min(*(poNaNDS->GetRasterBand(1)),
+                                gdal::min(*(poNaNDS->GetRasterBand(2)),
+                                          *(poNaNDS->GetRasterBand(3))));
+        EXPECT_EQ(CountSources(minVal), 4);
+        std::vector<double> adfResults(WIDTH * HEIGHT);
+        EXPECT_EQ(minVal.RasterIO(GF_Read, 0, 0, WIDTH, HEIGHT,
+                                  adfResults.data(), WIDTH, HEIGHT,
+                                  GDT_Float64, 0, 0, nullptr),
+                  CE_None);
+        for (double dfVal : adfResults)
+            EXPECT_EQ(dfVal, 0);
+    }
+
+    // Non left-most operands of additions are not fused
+    {
+        auto sum = firstBand + (secondBand + thirdBand);
+        EXPECT_EQ(CountSources(sum), 4);
+        double dfVal = 0;
+        EXPECT_EQ(sum.RasterIO(GF_Read, 0, 0, 1, 1, &dfVal, 1, 1, GDT_Float64,
+                               0, 0, nullptr),
+                  CE_None);
+        EXPECT_EQ(dfVal, FIRST + (SECOND + THIRD));
+    }
+
+    // Operations with a constant, or different operations, are not fused
+    {
+        auto sum = firstBand + secondBand + 1;
+        EXPECT_EQ(CountSources(sum), 3);
+    }
+    {
+        auto sum = (firstBand + 1) + secondBand;
+        EXPECT_EQ(CountSources(sum), 3);
+    }
+    {
+        auto val = firstBand * secondBand + thirdBand;
+        EXPECT_EQ(CountSources(val), 4);
+    }
+
+    // Non-Float64 intermediate results are not fused
+    {
+        auto poByteDS =
+            std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>(
+                poMemDrv->Create("", WIDTH, HEIGHT, 3, GDT_Byte, nullptr));
+        auto sum = *(poByteDS->GetRasterBand(1)) +
+                   *(poByteDS->GetRasterBand(2)) +
+                   *(poByteDS->GetRasterBand(3));
+        EXPECT_EQ(CountSources(sum), 4);
+    }
+
+    // Bands with nodata are not fused
+    {
+        firstBand.SetNoDataValue(FIRST);
+        auto sum = firstBand + secondBand + thirdBand;
+        EXPECT_EQ(CountSources(sum), 4);
+        firstBand.DeleteNoDataValue();
+    }
+}
+
+// Test GDALDatasetCopyWholeRaster() with NUM_THREADS
+TEST_F(test_gdal, GDALDatasetCopyWholeRaster_multithreaded)
+{
+    constexpr int WIDTH = 37;
+    constexpr int HEIGHT = 53;
+    constexpr int BANDS = 3;
+    auto poDrv = GDALDriver::FromHandle(GDALGetDriverByName("MEM"));
+    GDALDatasetUniquePtr poSrcDS(
+        poDrv->Create("", WIDTH, HEIGHT, BANDS, GDT_UInt16, nullptr));
+    std::vector<GUInt16> anValues(WIDTH * HEIGHT * BANDS);
+    for (size_t i = 0; i < anValues.size(); ++i)
+        anValues[i] = static_cast<GUInt16>(i);
+    ASSERT_EQ(poSrcDS->RasterIO(GF_Write, 0, 0, WIDTH, HEIGHT, anValues.data(),
+                                WIDTH, HEIGHT, GDT_UInt16, BANDS, nullptr, 0,
+                                0, 0, nullptr),
+              CE_None);
+
+    // Force many swaths
+    CPLConfigOptionSetter oSetter("GDAL_SWATH_SIZE", "100", false);
+    for (const char *pszInterleave : {"BAND", "PIXEL"})
+    {
+        GDALDatasetUniquePtr poDstDS(
+            poDrv->Create("", WIDTH, HEIGHT, BANDS, GDT_UInt16, nullptr));
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("NUM_THREADS", "4");
+        aosOptions.SetNameValue("INTERLEAVE", pszInterleave);
+        // Set to INT_MAX if progress goes backwards
+        int nLastPct = -1;
+        const auto Progress = [](double dfComplete, const char *, void *pData)
+        {
+            auto pnLastPct = static_cast<int *>(pData);
+            const int nPct = static_cast<int>(dfComplete * 100);
+            const bool bOK = nPct >= *pnLastPct;
+            *pnLastPct = bOK ? nPct : INT_MAX;
+            return TRUE;
+        };
+        EXPECT_EQ(GDALDatasetCopyWholeRaster(
+                      GDALDataset::ToHandle(poSrcDS.get()),
+                      GDALDataset::ToHandle(poDstDS.get()), aosOptions.List(),
+                      Progress, &nLastPct),
+                  CE_None);
+        EXPECT_EQ(nLastPct, 100);
+
+        std::vector<GUInt16> anGot(anValues.size());
+        EXPECT_EQ(poDstDS->RasterIO(GF_Read, 0, 0, WIDTH, HEIGHT, anGot.data(),
+                                    WIDTH, HEIGHT, GDT_UInt16, BANDS, nullptr,
+                                    0, 0, 0, nullptr),
+                  CE_None);
+        EXPECT_EQ(anGot, anValues);
+    }
+
+    // Test fallback to the single-threaded path when two swaths do not fit
+    // in the block cache
+    {
+        const GIntBig nOldCacheMax = GDALGetCacheMax64();
+        GDALSetCacheMax64(100);
+        GDALDatasetUniquePtr poDstDS(
+            poDrv->Create("", WIDTH, HEIGHT, BANDS, GDT_UInt16, nullptr));
+        const char *const apszOptions[] = {"NUM_THREADS=4", nullptr};
+        EXPECT_EQ(GDALDatasetCopyWholeRaster(
+                      GDALDataset::ToHandle(poSrcDS.get()),
+                      GDALDataset::ToHandle(poDstDS.get()), apszOptions,
+                      nullptr, nullptr),
+                  CE_None);
+        GDALSetCacheMax64(nOldCacheMax);
+
+        std::vector<GUInt16> anGot(anValues.size());
+        EXPECT_EQ(poDstDS->RasterIO(GF_Read, 0, 0, WIDTH, HEIGHT, anGot.data(),
+                                    WIDTH, HEIGHT, GDT_UInt16, BANDS, nullptr,
+                                    0, 0, 0, nullptr),
+                  CE_None);
+        EXPECT_EQ(anGot, anValues);
+    }
+
+    // Test interruption
+    {
+        GDALDatasetUniquePtr poDstDS(
+            poDrv->Create("", WIDTH, HEIGHT, BANDS, GDT_UInt16, nullptr));
+        const char *const apszOptions[] = {"NUM_THREADS=4", nullptr};
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_EQ(GDALDatasetCopyWholeRaster(
+                      GDALDataset::ToHandle(poSrcDS.get()),
+                      GDALDataset::ToHandle(poDstDS.get()), apszOptions,
+                      [](double dfComplete, const char *, void *)
+                      { return dfComplete < 0.5 ? TRUE : FALSE; },
+                      nullptr),
+                  CE_Failure);
+        EXPECT_EQ(CPLGetLastErrorNo(), CPLE_UserInterrupt);
+    }
+}
+
+// Test GDALDriver::DecodeImage() / EncodeImage()
+TEST_F(test_gdal, GDALDriver_EncodeImage_DecodeImage)
+{
+    auto poPNGDriver = GetGDALDriverManager()->GetDriverByName("PNG");
+    if (!poPNGDriver)
+        GTEST_SKIP() << "PNG driver missing";
+    ASSERT_NE(poPNGDriver->GetEncodeImageCallback(), nullptr);
+    ASSERT_NE(poPNGDriver->GetDecodeImageCallback(), nullptr);
+
+    constexpr int WIDTH = 7;
+    constexpr int HEIGHT = 5;
+    constexpr int PIXELS = WIDTH * HEIGHT;
+
+    // PNG round trip, for all supported band counts and data types
+    for (const GDALDataType eDT : {GDT_Byte, GDT_UInt16})
+    {
+        for (int nBands = 1; nBands <= 4; ++nBands)
+        {
+            std::vector<GUInt16> anValues(PIXELS * nBands);
+            for (size_t i = 0; i < anValues.size(); ++i)
+                anValues[i] = static_cast<GUInt16>(
+                    eDT == GDT_Byte ? (i * 7) % 256 : i * 1013);
+            const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+            std::vector<GByte> abySrc(anValues.size() * nDTSize);
+            GDALCopyWords64(anValues.data(), GDT_UInt16, 2, abySrc.data(), eDT,
+                            nDTSize, anValues.size());
+            std::vector<const void *> apBandData;
+            for (int i = 0; i < nBands; ++i)
+                apBandData.push_back(abySrc.data() + i * PIXELS * nDTSize);
+
+            std::vector<GByte> abyEncoded;
+            ASSERT_TRUE(poPNGDriver->EncodeImage(WIDTH, HEIGHT, nBands, eDT,
+                                                 apBandData.data(), nullptr,
+                                                 nullptr, abyEncoded));
+
+            GDALDecodedImage sImage;
+            ASSERT_TRUE(poPNGDriver->DecodeImage(
+                abyEncoded.data(), abyEncoded.size(), nullptr, sImage));
+            EXPECT_EQ(sImage.nXSize, WIDTH);
+            EXPECT_EQ(sImage.nYSize, HEIGHT);
+            EXPECT_EQ(sImage.nBands, nBands);
+            EXPECT_EQ(sImage.eDT, eDT);
+            EXPECT_EQ(sImage.poColorTable, nullptr);
+            EXPECT_EQ(sImage.abyData, abySrc);
+        }
+    }
+
+    // PNG round trip with a color table
+    {
+        GDALColorTable oCT;
+        for (int i = 0; i < 4; ++i)
+        {
+            const GDALColorEntry sEntry = {static_cast<short>(i * 10),
+                                           static_cast<short>(i * 20),
+                                           static_cast<short>(i * 30),
+                                           static_cast<short>(i ? 255 : 0)};
+            oCT.SetColorEntry(i, &sEntry);
+        }
+        std::vector<GByte> abySrc(PIXELS);
+        for (int i = 0; i < PIXELS; ++i)
+            abySrc[i] = static_cast<GByte>(i % 4);
+        const void *pBandData = abySrc.data();
+        std::vector<GByte> abyEncoded;
+        ASSERT_TRUE(poPNGDriver->EncodeImage(WIDTH, HEIGHT, 1, GDT_Byte,
+                                             &pBandData, &oCT, nullptr,
+                                             abyEncoded));
+        GDALDecodedImage sImage;
+        ASSERT_TRUE(poPNGDriver->DecodeImage(
+            abyEncoded.data(), abyEncoded.size(), nullptr, sImage));
+        EXPECT_EQ(sImage.nBands, 1);
+        EXPECT_EQ(sImage.abyData, abySrc);
+        ASSERT_NE(sImage.poColorTable, nullptr);
+        EXPECT_TRUE(sImage.poColorTable->IsSame(&oCT));
+    }
+
+    // MAX_XSIZE / MAX_YSIZE options
+    {
+        std::vector<GByte> abySrc(PIXELS);
+        const void *pBandData = abySrc.data();
+        std::vector<GByte> abyEncoded;
+        ASSERT_TRUE(poPNGDriver->EncodeImage(WIDTH, HEIGHT, 1, GDT_Byte,
+                                             &pBandData, nullptr, nullptr,
+                                             abyEncoded));
+        GDALDecodedImage sImage;
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("MAX_XSIZE", CPLSPrintf("%d", WIDTH));
+        aosOptions.SetNameValue("MAX_YSIZE", CPLSPrintf("%d", HEIGHT));
+        EXPECT_TRUE(poPNGDriver->DecodeImage(abyEncoded.data(),
+                                             abyEncoded.size(),
+                                             aosOptions.List(), sImage));
+        for (const char *pszOption : {"MAX_XSIZE", "MAX_YSIZE"})
+        {
+            CPLStringList aosTooSmall(aosOptions);
+            aosTooSmall.SetNameValue(pszOption, "1");
+            GDALDecodedImage sImageTooLarge;
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            CPLErrorReset();
+            EXPECT_FALSE(poPNGDriver->DecodeImage(abyEncoded.data(),
+                                                  abyEncoded.size(),
+                                                  aosTooSmall.List(),
+                                                  sImageTooLarge));
+            EXPECT_EQ(CPLGetLastErrorType(), CE_Failure);
+            EXPECT_TRUE(sImageTooLarge.abyData.empty());
+        }
+    }
+
+    // Content not recognized by the driver: no error emitted
+    {
+        const GByte abyNotPNG[] = {0xFF, 0xD8, 0xFF, 0xE0, 0, 0, 0, 0, 0};
+        GDALDecodedImage sImage;
+        CPLErrorReset();
+        EXPECT_FALSE(poPNGDriver->DecodeImage(abyNotPNG, sizeof(abyNotPNG),
+                                              nullptr, sImage));
+        EXPECT_EQ(CPLGetLastErrorType(), CE_None);
+    }
+
+    // Unsupported data type
+    {
+        const float afValues[1] = {0};
+        const void *pBandData = afValues;
+        std::vector<GByte> abyEncoded;
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_FALSE(poPNGDriver->EncodeImage(1, 1, 1, GDT_Float32, &pBandData,
+                                              nullptr, nullptr, abyEncoded));
+    }
+
+    // JPEG round trip (lossy, so only check the image characteristics)
+    auto poJPEGDriver = GetGDALDriverManager()->GetDriverByName("JPEG");
+    if (poJPEGDriver && poJPEGDriver->GetEncodeImageCallback())
+    {
+        for (const int nBands : {1, 3})
+        {
+            std::vector<GByte> abySrc(PIXELS * nBands, 128);
+            std::vector<const void *> apBandData;
+            for (int i = 0; i < nBands; ++i)
+                apBandData.push_back(abySrc.data() + i * PIXELS);
+            const char *const apszOptions[] = {"QUALITY=95", nullptr};
+            std::vector<GByte> abyEncoded;
+            ASSERT_TRUE(poJPEGDriver->EncodeImage(
+                WIDTH, HEIGHT, nBands, GDT_Byte, apBandData.data(), nullptr,
+                apszOptions, abyEncoded));
+
+            GDALDecodedImage sImage;
+            ASSERT_TRUE(poJPEGDriver->DecodeImage(
+                abyEncoded.data(), abyEncoded.size(), nullptr, sImage));
+            EXPECT_EQ(sImage.nXSize, WIDTH);
+            EXPECT_EQ(sImage.nYSize, HEIGHT);
+            EXPECT_EQ(sImage.nBands, nBands);
+            EXPECT_EQ(sImage.eDT, GDT_Byte);
+            ASSERT_EQ(sImage.abyData.size(), abySrc.size());
+            for (size_t i = 0; i < abySrc.size(); ++i)
+                EXPECT_NEAR(sImage.abyData[i], abySrc[i], 2);
+
+            // Truncated stream
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            EXPECT_FALSE(poJPEGDriver->DecodeImage(
+                abyEncoded.data(), abyEncoded.size() / 2, nullptr, sImage));
+        }
+    }
+
+    // Driver without codec callbacks
+    auto poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (poMEMDriver)
+    {
+        GDALDecodedImage sImage;
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_FALSE(poMEMDriver->DecodeImage("", 0, nullptr, sImage));
+        EXPECT_EQ(CPLGetLastErrorNo(), CPLE_NotSupported);
+    }
+}
+
 }  // namespace
@@ -4614,4 +4614,90 @@ TEST_F(test_ogr, OGRPolygon_two_vertex_constructor)
     CPLFree(outWKT);
 }
 
+TEST_F(test_ogr, OGRSimpleCurve_envelope_length_area_swapXY)
+{
+    // Test various number of points to exercise both the vectorized
+    // loops and their remainder
+    for (int nPoints = 1; nPoints <= 10; ++nPoints)
+    {
+        OGRLinearRing oRing;
+        double dfExpectedLength = 0;
+        for (int i = 0; i < nPoints; ++i)
+        {
+            const double dfAngle = 2 * M_PI * i / std::max(1, nPoints - 1);
+            oRing.addPoint(10 + 3 * cos(dfAngle), 20 + 2 * sin(dfAngle),
+                           -i * 1.5);
+            if (i > 0)
+            {
+                const double dfDX = oRing.getX(i) - oRing.getX(i - 1);
+                const double dfDY = oRing.getY(i) - oRing.getY(i - 1);
+                dfExpectedLength += sqrt(dfDX * dfDX + dfDY * dfDY);
+            }
+        }
+        if (nPoints > 1)
+            oRing.setPoint(nPoints - 1, oRing.getX(0), oRing.getY(0),
+                           oRing.getZ(nPoints - 1));
+
+        OGREnvelope3D sEnvelope;
+        oRing.getEnvelope(&sEnvelope);
+        double dfMinX = oRing.getX(0);
+        double dfMaxX = dfMinX;
+        double dfMinY = oRing.getY(0);
+        double dfMaxY = dfMinY;
+        for (int i = 1; i < nPoints; ++i)
+        {
+            dfMinX = std::min(dfMinX, oRing.getX(i));
+            dfMaxX = std::max(dfMaxX, oRing.getX(i));
+            dfMinY = std::min(dfMinY, oRing.getY(i));
+            dfMaxY = std::max(dfMaxY, oRing.getY(i));
+        }
+        EXPECT_EQ(sEnvelope.MinX, dfMinX) << nPoints;
+        EXPECT_EQ(sEnvelope.MaxX, dfMaxX) << nPoints;
+        EXPECT_EQ(sEnvelope.MinY, dfMinY) << nPoints;
+        EXPECT_EQ(sEnvelope.MaxY, dfMaxY) << nPoints;
+        EXPECT_EQ(sEnvelope.MinZ, -(nPoints - 1) * 1.5) << nPoints;
+        EXPECT_EQ(sEnvelope.MaxZ, 0) << nPoints;
+
+        EXPECT_NEAR(oRing.get_Length(), dfExpectedLength, 1e-10) << nPoints;
+
+        double dfExpectedArea = 0;
+        for (int i = 0; i + 1 < nPoints; ++i)
+        {
+            dfExpectedArea += oRing.getX(i) * oRing.getY(i + 1) -
+                              oRing.getX(i + 1) * oRing.getY(i);
+        }
+        dfExpectedArea = fabs(dfExpectedArea) / 2;
+        EXPECT_NEAR(oRing.get_Area(), dfExpectedArea, 1e-10) << nPoints;
+
+        OGRLinearRing oRingSwapped(oRing);
+        oRingSwapped.swapXY();
+        for (int i = 0; i < nPoints; ++i)
+        {
+            EXPECT_EQ(oRingSwapped.getX(i), oRing.getY(i));
+            EXPECT_EQ(oRingSwapped.getY(i), oRing.getX(i));
+            EXPECT_EQ(oRingSwapped.getZ(i), oRing.getZ(i));
+        }
+    }
+
+    // NaN values other than in the first point are ignored
+    {
+        OGRLineString oLS;
+        oLS.addPoint(1, 2, 3);
+        oLS.addPoint(std::numeric_limits<double>::quiet_NaN(),
+                     std::numeric_limits<double>::quiet_NaN(),
+                     std::numeric_limits<double>::quiet_NaN());
+        oLS.addPoint(-1, 5, 0);
+        oLS.addPoint(std::numeric_limits<double>::quiet_NaN(), 0,
+                     std::numeric_limits<double>::quiet_NaN());
+        OGREnvelope3D sEnvelope;
+        oLS.getEnvelope(&sEnvelope);
+        EXPECT_EQ(sEnvelope.MinX, -1);
+        EXPECT_EQ(sEnvelope.MaxX, 1);
+        EXPECT_EQ(sEnvelope.MinY, 0);
+        EXPECT_EQ(sEnvelope.MaxY, 5);
+        EXPECT_EQ(sEnvelope.MinZ, 0);
+        EXPECT_EQ(sEnvelope.MaxZ, 3);
+    }
+}
+
 }  // namespace
@@ -1936,6 +1936,37 @@ def test_cog_mask_band_overviews(tmp_vsimem):
     assert ds.GetRasterBand(1).GetOverview(1).IsMaskBand()
 
 
+###############################################################################
+# Test TEMPORARY_FILES creation option
+
+
+@pytest.mark.parametrize("temporary_files", ["MEMORY", "AUTO"])
+def test_cog_temporary_files(tmp_path, temporary_files):
+
+    options = "-co RESAMPLING=LANCZOS -co OVERVIEW_COUNT=3 -of COG -outsize 1024 0 -b 1 -b 2 -b 3 -mask 4"
+
+    ref_filename = str(tmp_path / "ref.tif")
+    gdal.Translate(ref_filename, "data/stefan_full_rgba.tif", options=options)
+
+    out_dir = tmp_path / "out"
+    out_dir.mkdir()
+    filename = str(out_dir / "out.tif")
+    with gdal.config_option("COG_DELETE_TEMP_FILES", "NO"):
+        gdal.Translate(
+            filename,
+            "data/stefan_full_rgba.tif",
+            options=options + f" -co TEMPORARY_FILES={temporary_files}",
+        )
+
+    # No temporary file should have been created on disk
+    assert gdal.ReadDir(str(out_dir)) == ["out.tif"]
+
+    with open(ref_filename, "rb") as f:
+        ref_data = f.read()
+    with open(filename, "rb") as f:
+        assert f.read() == ref_data
+
+
 ###############################################################################
 # Verify that we can generate an output that is byte-identical to the expected golden file.
 
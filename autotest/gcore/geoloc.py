@@ -600,3 +600,58 @@ def test_geoloc_warnings_inconsistent_size(
         else:
             assert gdal.GetLastErrorMsg() == ""
         assert tr
+
+
+###############################################################################
+# Test that multi-threaded backmap generation gives the same result as the
+# single-threaded one
+
+
+def test_geoloc_backmap_multithreaded(tmp_vsimem):
+
+    xsize = 600
+    ysize = 300
+    geoloc_filename = str(tmp_vsimem / "geoloc.tif")
+    geoloc_ds = gdal.GetDriverByName("GTiff").Create(
+        geoloc_filename, xsize, ysize, 2, gdal.GDT_Float64
+    )
+    for y in range(ysize):
+        lon = array.array(
+            "d",
+            [-80 + 0.01 * x + 0.002 * y + 1e-5 * (x - 300) ** 2 for x in range(xsize)],
+        )
+        lat = array.array(
+            "d",
+            [50 - 0.01 * y + 0.002 * x + 1e-5 * (y - 150) ** 2 for x in range(xsize)],
+        )
+        geoloc_ds.GetRasterBand(1).WriteRaster(0, y, xsize, 1, lon)
+        geoloc_ds.GetRasterBand(2).WriteRaster(0, y, xsize, 1, lat)
+    geoloc_ds = None
+
+    ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize)
+    md = {
+        "LINE_OFFSET": "0",
+        "LINE_STEP": "1",
+        "PIXEL_OFFSET": "0",
+        "PIXEL_STEP": "1",
+        "X_DATASET": geoloc_filename,
+        "X_BAND": "1",
+        "Y_DATASET": geoloc_filename,
+        "Y_BAND": "2",
+        "SRS": "EPSG:4326",
+    }
+    ds.SetMetadata(md, "GEOLOCATION")
+
+    points = [
+        (-80 + 7.0 * i / 20, 50 - 4.0 * j / 20 + 1.2 * i / 20)
+        for i in range(21)
+        for j in range(21)
+    ]
+
+    def get_inverse_transformed_points(num_threads):
+        tr = gdal.Transformer(ds, None, [f"NUM_THREADS={num_threads}"])
+        return [tr.TransformPoint(True, x, y) for (x, y) in points]
+
+    expected = get_inverse_transformed_points(1)
+    assert [success for (success, _) in expected].count(1) > 200
+    assert get_inverse_transformed_points(4) == expected
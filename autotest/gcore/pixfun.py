@@ -1488,3 +1488,75 @@ def test_pixfun_max_no_nodata():
 
 
 ###############################################################################
+# Test the type-specialized code paths of real-valued pixel functions,
+# with nodata propagation
+
+
+@pytest.mark.parametrize(
+    "src_type", ["Byte", "UInt16", "Int16", "Int32", "Float32", "Float64"]
+)
+@pytest.mark.parametrize("buf_type", ["Float32", "Float64", "Int16"])
+@pytest.mark.parametrize("pixfn", ["diff", "mul", "div", "norm_diff"])
+def test_pixfun_real_kernels(tmp_vsimem, src_type, buf_type, pixfn):
+
+    width = 300  # larger than the internal chunk size
+    height = 3
+    nodata = 7
+
+    ar1 = (numpy.arange(width * height) % 100 + 1).reshape((height, width))
+    ar2 = (numpy.arange(width * height) % 17 + 2).reshape((height, width))
+    ar1[0][5] = nodata
+    ar2[1][299] = nodata
+
+    for i, ar in enumerate((ar1, ar2)):
+        with gdal.GetDriverByName("GTiff").Create(
+            tmp_vsimem / f"src{i}.tif",
+            width,
+            height,
+            1,
+            gdal.GetDataTypeByName(src_type),
+        ) as ds:
+            ds.GetRasterBand(1).WriteArray(ar)
+
+    vrt_ds = gdal.Open(f"""
+<VRTDataset rasterXSize="{width}" rasterYSize="{height}">
+  <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+    <PixelFunctionType>{pixfn}</PixelFunctionType>
+    <NoDataValue>{nodata}</NoDataValue>
+    <SimpleSource>
+      <SourceFilename>{tmp_vsimem / "src0.tif"}</SourceFilename>
+      <SourceBand>1</SourceBand>
+    </SimpleSource>
+    <SimpleSource>
+      <SourceFilename>{tmp_vsimem / "src1.tif"}</SourceFilename>
+      <SourceBand>1</SourceBand>
+    </SimpleSource>
+  </VRTRasterBand>
+</VRTDataset>""")
+
+    a = ar1.astype(numpy.float64)
+    b = ar2.astype(numpy.float64)
+    if pixfn == "diff":
+        expected = a - b
+    elif pixfn == "mul":
+        # without propagateNoData, nodata sources are ignored
+        expected = numpy.where(a == nodata, 1, a)
+        expected *= numpy.where(b == nodata, 1, b)
+    elif pixfn == "div":
+        expected = a / b
+    else:
+        expected = (a - b) / (a + b)
+    if pixfn != "mul":
+        expected[(a == nodata) | (b == nodata)] = nodata
+
+    # Use GDAL to convert the expected values to the buffer data type
+    expected_ds = gdal.GetDriverByName("MEM").Create(
+        "", width, height, 1, gdal.GDT_Float64
+    )
+    expected_ds.GetRasterBand(1).WriteArray(expected)
+    buf_type = gdal.GetDataTypeByName(buf_type)
+
+    numpy.testing.assert_array_equal(
+        vrt_ds.GetRasterBand(1).ReadAsArray(buf_type=buf_type),
+        expected_ds.GetRasterBand(1).ReadAsArray(buf_type=buf_type),
+    )
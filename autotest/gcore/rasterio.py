@@ -3686,3 +3686,72 @@ def test_rasterio_gdt_unknown():
         # Caught at the SWIG level
         with pytest.raises(Exception, match="Illegal value for data type"):
             ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Unknown)
+
+
+###############################################################################
+# Test multi-threaded resampled RasterIO (several chunks are needed)
+
+
+@pytest.mark.parametrize("nodata", [None, 0])
+@pytest.mark.parametrize(
+    "resample_alg", [gdal.GRIORA_Average, gdal.GRIORA_Cubic, gdal.GRIORA_Mode]
+)
+def test_rasterio_resampled_multithreaded(nodata, resample_alg):
+
+    width = 2000
+    height = 1500
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, 2)
+    data = (bytes(range(251)) * (width * height // 251 + 1))[0 : width * height]
+    ds.WriteRaster(0, 0, width, height, data, band_list=[1, 2])
+    if nodata is not None:
+        for i in range(2):
+            ds.GetRasterBand(i + 1).SetNoDataValue(nodata)
+
+    def read():
+        return (
+            ds.ReadRaster(
+                1, 2, width - 3, height - 5, 301, 203, resample_alg=resample_alg
+            ),
+            ds.GetRasterBand(2).ReadRaster(
+                1, 2, width - 3, height - 5, 301, 203, resample_alg=resample_alg
+            ),
+        )
+
+    expected = read()
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        got = read()
+    assert got == expected
+
+    tab_pct = [0]
+
+    def callback(pct, message, user_data):
+        assert pct >= tab_pct[0]
+        tab_pct[0] = pct
+        return 1
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        got = ds.GetRasterBand(1).ReadRaster(
+            0, 0, width, height, 100, 100, resample_alg=resample_alg, callback=callback
+        )
+    assert tab_pct[0] == 1.0
+    assert got == ds.GetRasterBand(1).ReadRaster(
+        0, 0, width, height, 100, 100, resample_alg=resample_alg
+    )
+
+    def callback_interrupt(pct, message, user_data):
+        return pct < 0.5
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        assert (
+            ds.GetRasterBand(1).ReadRaster(
+                0,
+                0,
+                width,
+                height,
+                100,
+                100,
+                resample_alg=resample_alg,
+                callback=callback_interrupt,
+            )
+            is None
+        )
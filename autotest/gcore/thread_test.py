@@ -12,6 +12,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import ctypes
 import shutil
 import threading
 
@@ -594,3 +595,247 @@ def test_thread_safe_GetGCPs():
         for t in threads:
             t.join()
         assert res[0]
+
+
+def test_thread_safe_native_mem_ds():
+
+    with gdal.Open("data/byte.tif") as src_ds:
+        # Only MEM datasets opened in read-only mode are thread-safe
+        buffer = ctypes.create_string_buffer(
+            src_ds.ReadRaster(), src_ds.RasterXSize * src_ds.RasterYSize
+        )
+        with gdal.config_option("GDAL_MEM_ENABLE_OPEN", "YES"):
+            ds = gdal.Open(
+                "MEM:::DATAPOINTER=0x%X,PIXELS=%d,LINES=%d,DATATYPE=Byte"
+                % (ctypes.addressof(buffer), src_ds.RasterXSize, src_ds.RasterYSize)
+            )
+        # Expected results of the generic block based nearest neighbour
+        # resampling
+        expected = [
+            src_ds.GetRasterBand(1).ReadRaster(
+                buf_xsize=buf_xsize, buf_ysize=buf_ysize
+            )
+            for (buf_xsize, buf_ysize) in [(7, 6), (10, 10), (33, 47)]
+        ]
+        expected.append(
+            src_ds.GetRasterBand(1).ReadRaster(
+                1.5, 2.25, 10.5, 11.75, buf_xsize=4, buf_ysize=5
+            )
+        )
+
+    # MEM datasets are natively thread-safe for raster reads
+    assert ds.IsThreadSafe(gdal.OF_RASTER)
+    assert not ds.IsThreadSafe(gdal.OF_RASTER | gdal.OF_UPDATE)
+    ref_count_before = ds.GetRefCount()
+    thread_safe_ds = ds.GetThreadSafeDataset(gdal.OF_RASTER)
+    assert ds.GetRefCount() == ref_count_before + 1
+    del thread_safe_ds
+    assert ds.GetRefCount() == ref_count_before
+
+    band = ds.GetRasterBand(1)
+
+    def get_band():
+        return band
+
+    launch_threads(get_band, 4672)
+
+    res = [True]
+
+    def check():
+        for i in range(100):
+            got = [
+                band.ReadRaster(buf_xsize=buf_xsize, buf_ysize=buf_ysize)
+                for (buf_xsize, buf_ysize) in [(7, 6), (10, 10), (33, 47)]
+            ]
+            got.append(
+                band.ReadRaster(1.5, 2.25, 10.5, 11.75, buf_xsize=4, buf_ysize=5)
+            )
+            if got != expected:
+                res[0] = False
+
+    threads = [threading.Thread(target=check) for i in range(2)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert res[0]
+
+
+def test_thread_safe_mem_ds_concurrent_read_write():
+
+    ds = gdal.GetDriverByName("MEM").Create("", 100, 100)
+    # Writable MEM datasets are not natively thread-safe, so that the
+    # read/write mutex of GDALDataset is used.
+    assert not ds.IsThreadSafe(gdal.OF_RASTER)
+    assert not ds.IsThreadSafe(gdal.OF_RASTER | gdal.OF_UPDATE)
+
+    band = ds.GetRasterBand(1)
+    band.Fill(1)
+    values = [b"\x01" * (100 * 100), b"\x02" * (100 * 100)]
+
+    res = [True]
+
+    def write():
+        for i in range(200):
+            band.WriteRaster(0, 0, 100, 100, values[i % 2])
+
+    def read():
+        for i in range(200):
+            data = band.ReadRaster()
+            if data.count(b"\x01") + data.count(b"\x02") != len(data):
+                res[0] = False
+            data = band.ReadRaster(buf_xsize=33, buf_ysize=47)
+            if data.count(b"\x01") + data.count(b"\x02") != len(data):
+                res[0] = False
+
+    threads = [threading.Thread(target=write)] + [
+        threading.Thread(target=read) for i in range(2)
+    ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert res[0]
+    assert band.ReadRaster() == values[1]
+
+
+@pytest.mark.require_driver("ENVI")
+def test_thread_safe_native_raw_ds(tmp_path):
+
+    tmpfilename = str(tmp_path / "test.bin")
+    gdal.Translate(
+        tmpfilename,
+        "data/rgbsmall.tif",
+        format="ENVI",
+        creationOptions=["INTERLEAVE=BIP"],
+    )
+    with gdal.Open("data/rgbsmall.tif") as src_ds:
+        expected_cs = [src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+        expected_data = src_ds.ReadRaster()
+        expected_data_pixel = src_ds.ReadRaster(interleave="pixel")
+
+    with gdal.Open(tmpfilename) as ds:
+        assert ds.IsThreadSafe(gdal.OF_RASTER)
+        assert not ds.IsThreadSafe(gdal.OF_RASTER | gdal.OF_UPDATE)
+
+    with gdal.Open(tmpfilename, gdal.GA_Update) as ds:
+        assert not ds.IsThreadSafe(gdal.OF_RASTER)
+
+    with gdal.OpenEx(tmpfilename, gdal.OF_RASTER | gdal.OF_THREAD_SAFE) as ds:
+        assert ds.IsThreadSafe(gdal.OF_RASTER)
+
+        for i in range(3):
+            band = ds.GetRasterBand(i + 1)
+
+            def get_band():
+                return band
+
+            launch_threads(get_band, expected_cs[i])
+
+        res = [True]
+
+        def check():
+            for i in range(100):
+                if ds.ReadRaster(interleave="pixel") != expected_data_pixel:
+                    res[0] = False
+                if ds.ReadRaster() != expected_data:
+                    res[0] = False
+
+        threads = [threading.Thread(target=check) for i in range(2)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        assert res[0]
+
+
+@pytest.mark.require_driver("ENVI")
+def test_thread_safe_native_raw_ds_with_overviews(tmp_path):
+
+    tmpfilename = str(tmp_path / "test.bin")
+    gdal.Translate(tmpfilename, "data/byte.tif", format="ENVI")
+    with gdal.Open(tmpfilename) as ds:
+        ds.BuildOverviews("NEAR", [2])
+
+    # Overviews are served by the GTiff driver, so cloning is needed
+    with gdal.Open(tmpfilename) as ds:
+        assert not ds.IsThreadSafe(gdal.OF_RASTER)
+
+
+def _check_concurrent_reads(requests):
+
+    expected = [request() for request in requests]
+    res = [True]
+
+    def check():
+        for i in range(50):
+            for request, expected_data in zip(requests, expected):
+                if request() != expected_data:
+                    res[0] = False
+
+    threads = [threading.Thread(target=check) for i in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert res[0]
+
+
+@pytest.mark.require_driver("ENVI")
+@pytest.mark.parametrize("interleave", ["BSQ", "BIP"])
+def test_thread_safe_native_raw_ds_subsampled_reads(tmp_path, interleave):
+
+    tmpfilename = str(tmp_path / "test.bin")
+    gdal.Translate(
+        tmpfilename,
+        "data/rgbsmall.tif",
+        format="ENVI",
+        creationOptions=["INTERLEAVE=" + interleave],
+    )
+
+    with gdal.Open(tmpfilename) as ds:
+        assert ds.IsThreadSafe(gdal.OF_RASTER)
+        band = ds.GetRasterBand(2)
+
+        # Those requests go through the block cache
+        _check_concurrent_reads(
+            [
+                lambda: ds.ReadRaster(buf_xsize=17, buf_ysize=23),
+                lambda: ds.ReadRaster(
+                    3, 5, 40, 41, buf_xsize=13, buf_ysize=11, resample_alg="bilinear"
+                ),
+                lambda: ds.ReadRaster(interleave="pixel", buf_xsize=25, buf_ysize=25),
+                lambda: band.ReadRaster(buf_xsize=17, buf_ysize=23),
+                lambda: band.ReadRaster(
+                    1, 2, 45, 43, buf_xsize=20, buf_ysize=21, resample_alg="cubic"
+                ),
+                lambda: band.ReadRaster(),
+            ]
+        )
+
+
+@pytest.mark.require_driver("ENVI")
+def test_thread_safe_native_raw_ds_build_overviews(tmp_path):
+
+    tmpfilename = str(tmp_path / "test.bin")
+    gdal.Translate(tmpfilename, "data/rgbsmall.tif", format="ENVI")
+
+    with gdal.Open(tmpfilename) as ds:
+        assert ds.IsThreadSafe(gdal.OF_RASTER)
+        ds.BuildOverviews("AVERAGE", [2, 4])
+        # Overviews are served by the GTiff driver
+        assert not ds.IsThreadSafe(gdal.OF_RASTER)
+
+    with gdal.OpenEx(tmpfilename, gdal.OF_RASTER | gdal.OF_THREAD_SAFE) as ds:
+        assert ds.GetRasterBand(1).GetOverviewCount() == 2
+        band = ds.GetRasterBand(1)
+        ovr_band = band.GetOverview(0)
+
+        _check_concurrent_reads(
+            [
+                lambda: ds.ReadRaster(buf_xsize=12, buf_ysize=12),
+                lambda: band.ReadRaster(buf_xsize=25, buf_ysize=25),
+                lambda: ovr_band.ReadRaster(),
+                lambda: band.ReadRaster(),
+            ]
+        )
@@ -4407,3 +4407,82 @@ def test_gpkg_copy_using_get_data_coverage_status(tmp_vsimem):
         == (gdal.GDAL_DATA_COVERAGE_STATUS_DATA | gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY)
         and pct == 25.0
     )
+
+
+###############################################################################
+# Test multi-threaded decoding of tiles
+
+
+@pytest.mark.parametrize(
+    "dt,tile_format",
+    [
+        (gdal.GDT_Byte, "PNG"),
+        (gdal.GDT_Byte, "JPEG"),
+        (gdal.GDT_Float32, "PNG"),
+        (gdal.GDT_Float32, "TIFF"),
+    ],
+)
+def test_gpkg_read_multithreaded(tmp_vsimem, dt, tile_format):
+
+    if gdal.GetDriverByName(tile_format if tile_format != "TIFF" else "GTiff") is None:
+        pytest.skip(f"{tile_format} driver missing")
+
+    nbands = 3 if dt == gdal.GDT_Byte else 1
+    src_ds = gdal.GetDriverByName("MEM").Create("", 600, 500, nbands, dt)
+    src_ds.SetGeoTransform([2, 0.001, 0, 49, 0, -0.001])
+    for i in range(nbands):
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0, 0, 600, 500, bytes((x * (i + 1)) % 253 for x in range(600 * 500)),
+            buf_type=gdal.GDT_Byte,
+        )
+    if dt != gdal.GDT_Byte:
+        src_ds.GetRasterBand(1).SetNoDataValue(255)
+
+    filename = str(tmp_vsimem / "test_gpkg_read_multithreaded.gpkg")
+    gdal.Translate(
+        filename,
+        src_ds,
+        format="GPKG",
+        creationOptions=["TILE_FORMAT=" + tile_format, "BLOCKSIZE=128"],
+    )
+
+    def read(num_threads):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.Open(filename)
+            return (
+                ds.ReadRaster(),
+                ds.ReadRaster(100, 50, 300, 200, band_list=[nbands]),
+                ds.GetRasterBand(1).ReadRaster(30, 20, 500, 400),
+            )
+
+    assert read("4") == read("1")
+
+
+###############################################################################
+# Test that tiles are still written through CreateCopy() when the in-memory
+# encoder cannot be used
+
+
+@pytest.mark.parametrize("tile_format", ["PNG", "JPEG", "WEBP"])
+def test_gpkg_write_tile_encode_image_fallback(tmp_vsimem, tile_format):
+
+    if gdal.GetDriverByName(tile_format) is None:
+        pytest.skip(f"{tile_format} driver missing")
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+
+    def write(simul_failure):
+        filename = str(tmp_vsimem / f"fallback_{simul_failure}.gpkg")
+        with gdal.config_option("GPKG_SIMUL_ENCODE_IMAGE_FAILURE", simul_failure):
+            gdal.Translate(
+                filename,
+                src_ds,
+                format="GPKG",
+                creationOptions=["TILE_FORMAT=" + tile_format, "BLOCKSIZE=16"],
+            )
+        ds = gdal.Open(filename)
+        return [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+
+    got_cs = write("YES")
+    assert got_cs == write("NO")
+    assert got_cs[0] != 0
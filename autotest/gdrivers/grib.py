@@ -2444,3 +2444,57 @@ def test_grib_grib2_tmerc_negative_false_easting_false_northing(tmp_vsimem):
             "+proj=tmerc +lat_0=-1 +lon_0=-2 +k=1 +x_0=-300000 +y_0=-400000"
             in ds.GetSpatialRef().ExportToProj4()
         )
+
+
+###############################################################################
+# Test decoding of messages in parallel in dataset RasterIO
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/grib/gfs.t06z.pgrb2.10p0.f010.grib2",
+        "data/grib/subgrids.grib2",
+        "data/grib/Sample_QuikSCAT.grb",
+    ],
+)
+def test_grib_read_multithreaded(filename):
+
+    ds = gdal.Open(filename)
+    assert ds.RasterCount > 1
+    expected = ds.ReadRaster()
+    ds = None
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster() == expected
+        # Read again from the band cache
+        assert ds.ReadRaster() == expected
+        # Reversed and repeated band order
+        band_list = list(range(ds.RasterCount, 0, -1)) + [1]
+        ds_ref = gdal.Open(filename)
+        assert ds.ReadRaster(band_list=band_list) == ds_ref.ReadRaster(
+            band_list=band_list
+        )
+
+
+###############################################################################
+# Test that GRIB_CACHEMAX evicts least recently used bands
+
+
+def test_grib_cachemax_lru():
+
+    filename = "data/grib/gfs.t06z.pgrb2.10p0.f010.grib2"
+    ds = gdal.Open(filename)
+    expected = [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+    ds = None
+
+    # Less than one band worth of cache: only the last decoded band is kept
+    with gdaltest.config_options({"GRIB_CACHEMAX": "0", "GDAL_NUM_THREADS": "4"}):
+        ds = gdal.Open(filename)
+        for _ in range(2):
+            got = [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+            assert got == expected
+            gdal.ErrorReset()
+            ds.ReadRaster()
+            assert gdal.GetLastErrorMsg() == ""
@@ -563,6 +563,65 @@ def test_hdf5_single_dim():
     assert b.Checksum() == 231
 
 
+###############################################################################
+# Test that the chunk cache sizing does not affect the result of reads
+
+
+@pytest.mark.parametrize("cache_max_size", ["0", "1"])
+@pytest.mark.parametrize(
+    "filename", ["byte_chunked_multiple.nc", "byte_chunked_not_multiple.nc"]
+)
+def test_hdf5_chunk_cache_max_size(filename, cache_max_size):
+
+    ref_ds = gdal.Open(f"HDF5:data/netcdf/{filename}://Band1")
+    with gdal.config_option("HDF5_CHUNK_CACHE_MAX_SIZE", cache_max_size):
+        ds = gdal.Open(f"HDF5:data/netcdf/{filename}://Band1")
+        assert ds.ReadRaster() == ref_ds.ReadRaster()
+        assert ds.ReadRaster(3, 4, 11, 9) == ref_ds.ReadRaster(3, 4, 11, 9)
+        # Band1 is bottom-up, and the HDF5 driver does not flip it
+        assert ds.GetRasterBand(1).Checksum() == 4855
+
+
+###############################################################################
+# Test that the chunk cache is enlarged to hold the chunks of a RasterIO()
+# window, beyond the 1 MB default of libhdf5
+
+
+@pytest.mark.require_driver("netCDF")
+def test_hdf5_chunk_cache_enlarged(tmp_path):
+
+    filename = str(tmp_path / "test.nc")
+    with gdal.config_options({"BLOCKXSIZE": "256", "BLOCKYSIZE": "256"}):
+        gdal.GetDriverByName("netCDF").Create(
+            filename,
+            2048,
+            2048,
+            1,
+            gdal.GDT_Byte,
+            options=["FORMAT=NC4", "COMPRESS=DEFLATE"],
+        ).Close()
+
+    ds = gdal.Open(f"HDF5:{filename}://Band1")
+    assert ds.GetRasterBand(1).GetBlockSize() == [256, 256]
+
+    debug_msgs = []
+
+    def handler(err_class, err_no, msg):
+        if err_class == gdal.CE_Debug and "Setting chunk cache size" in msg:
+            debug_msgs.append(msg)
+
+    with gdaltest.error_handler(handler):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        with gdal.config_option("CPL_DEBUG", "ON"):
+            # 64 chunks of 64 KB
+            ds.GetRasterBand(1).ReadRaster()
+            # The cache is already large enough
+            ds.GetRasterBand(1).ReadRaster(0, 0, 512, 512)
+    assert len(debug_msgs) == 1, debug_msgs
+    assert debug_msgs[0].startswith("HDF5: Setting chunk cache size of ")
+    assert debug_msgs[0].endswith(" to 4194304 bytes")
+
+
 ###############################################################################
 # Test opening a file whose HDF5 signature is not at the beginning
 
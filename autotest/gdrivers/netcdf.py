@@ -5607,6 +5607,65 @@ def test_netcdf_chunked_not_multiple():
     assert ds.GetRasterBand(1).Checksum() == 4672
 
 
+###############################################################################
+# Test that the chunk cache sizing does not affect the result of reads
+
+
+@pytest.mark.parametrize("cache_max_size", ["0", "1"])
+@pytest.mark.parametrize(
+    "filename", ["byte_chunked_multiple.nc", "byte_chunked_not_multiple.nc"]
+)
+def test_netcdf_chunked_chunk_cache_max_size(filename, cache_max_size):
+
+    ref_ds = gdal.Open("data/netcdf/" + filename)
+    with gdal.config_option("GDAL_NETCDF_CHUNK_CACHE_MAX_SIZE", cache_max_size):
+        ds = gdal.Open("data/netcdf/" + filename)
+        assert ds.ReadRaster() == ref_ds.ReadRaster()
+        assert ds.ReadRaster(3, 4, 11, 9) == ref_ds.ReadRaster(3, 4, 11, 9)
+        assert ds.GetRasterBand(1).Checksum() == 4672
+
+
+###############################################################################
+# Test that the chunk cache is enlarged to hold the chunks of a RasterIO()
+# window, and bounded by GDAL_NETCDF_CHUNK_CACHE_MAX_SIZE
+
+
+def test_netcdf_chunked_chunk_cache_enlarged(tmp_path):
+
+    filename = str(tmp_path / "test.nc")
+    with gdal.config_options({"BLOCKXSIZE": "256", "BLOCKYSIZE": "256"}):
+        gdaltest.netcdf_drv.Create(
+            filename,
+            16384,
+            16384,
+            1,
+            gdal.GDT_Byte,
+            options=["FORMAT=NC4", "COMPRESS=DEFLATE"],
+        ).Close()
+
+    ds = gdal.Open(filename)
+    assert ds.GetRasterBand(1).GetBlockSize() == [256, 256]
+
+    debug_msgs = []
+
+    def handler(err_class, err_no, msg):
+        if err_class == gdal.CE_Debug and "Setting chunk cache size" in msg:
+            debug_msgs.append(msg)
+
+    with gdaltest.error_handler(handler):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        with gdal.config_options(
+            {"CPL_DEBUG": "ON", "GDAL_NETCDF_CHUNK_CACHE_MAX_SIZE": "100"}
+        ):
+            # The cache is sized from the window (4096 chunks of 64 KB),
+            # even if only one chunk is actually read by this subsampled
+            # request.
+            ds.GetRasterBand(1).ReadRaster(buf_xsize=1, buf_ysize=1)
+            # The cache is already large enough
+            ds.GetRasterBand(1).ReadRaster(0, 0, 512, 512)
+    assert debug_msgs == ["GDAL_netCDF: Setting chunk cache size to 104857600 bytes"]
+
+
 def test_netcdf_create(tmp_path):
 
     ofile = str(tmp_path / "out.nc")
@@ -1287,6 +1287,70 @@ def test_vrt_pixelfn_expression_invalid(
     assert exception in "".join(messages)
 
 
+###############################################################################
+# Test evaluation of muparser expressions on rasters with several lines and
+# columns, which uses bulk evaluation
+
+
+@pytest.mark.parametrize(
+    "expression,func",
+    [
+        ("A * 2 + B", lambda np, a, b: a * 2 + b),
+        (
+            "A > B ? A - B : sqrt(B)",
+            lambda np, a, b: np.where(a > b, a - b, np.sqrt(b)),
+        ),
+        ("(A >= 3) * (B != 5)", lambda np, a, b: (a >= 3) * (b != 5)),
+    ],
+)
+def test_vrt_pixelfn_expression_several_lines(tmp_vsimem, expression, func):
+
+    gdaltest.importorskip_gdal_array()
+    np = pytest.importorskip("numpy")
+
+    if not gdaltest.gdal_has_vrt_expression_dialect("muparser"):
+        pytest.skip("Expression dialect muparser is not available")
+
+    nx = 37
+    ny = 5
+    a = (np.arange(nx * ny).reshape(ny, nx) % 11).astype(np.int16)
+    b = (np.arange(nx * ny).reshape(ny, nx) % 7).astype(np.float32)
+
+    src_a = str(tmp_vsimem / "a.tif")
+    with gdal.GetDriverByName("GTiff").Create(
+        src_a, nx, ny, 1, gdal.GDT_Int16
+    ) as ds:
+        ds.GetRasterBand(1).WriteArray(a)
+    src_b = str(tmp_vsimem / "b.tif")
+    with gdal.GetDriverByName("GTiff").Create(
+        src_b, nx, ny, 1, gdal.GDT_Float32
+    ) as ds:
+        ds.GetRasterBand(1).WriteArray(b)
+
+    expression = expression.replace("<", "&lt;").replace(">", "&gt;")
+    xml = f"""<VRTDataset rasterXSize="{nx}" rasterYSize="{ny}">
+              <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+                 <PixelFunctionType>expression</PixelFunctionType>
+                 <PixelFunctionArguments expression="{expression}" />
+                 <SimpleSource name="A">
+                   <SourceFilename>{src_a}</SourceFilename>
+                   <SourceBand>1</SourceBand>
+                 </SimpleSource>
+                 <SimpleSource name="B">
+                   <SourceFilename>{src_b}</SourceFilename>
+                   <SourceBand>1</SourceBand>
+                 </SimpleSource>
+              </VRTRasterBand>
+            </VRTDataset>"""
+
+    expected = func(np, a.astype(np.float64), b.astype(np.float64))
+    with gdal.Open(xml) as ds:
+        np.testing.assert_allclose(ds.ReadAsArray(), expected, rtol=1e-15)
+        np.testing.assert_allclose(
+            ds.ReadAsArray(3, 1, 20, 3), expected[1:4, 3:23], rtol=1e-15
+        )
+
+
 ###############################################################################
 # Test multiplication / summation by a constant factor
 
@@ -2092,3 +2156,92 @@ def test_vrt_split_in_halves(tmp_vsimem):
     with gdal.config_option("VRT_DERIVED_DATASET_ALLOWED_RAM_USAGE", "1000"):
         got = gdal.Open(xml).ReadRaster()
         assert got == b"\x03" * (width * height)
+
+
+###############################################################################
+# Test that the row block splitting of pixel function evaluation gives the
+# same result as the evaluation in a single call
+
+
+@pytest.mark.parametrize(
+    "pixelfn,args",
+    [
+        ("sum", ""),
+        ("expression", '<PixelFunctionArguments expression="B1 * 2 - B2" />'),
+    ],
+)
+def test_vrt_pixelfn_multithreaded(tmp_vsimem, pixelfn, args):
+
+    if pixelfn == "expression" and not gdaltest.gdal_has_vrt_expression_dialect(
+        "muparser"
+    ):
+        pytest.skip("Expression dialect muparser is not available")
+
+    width = 1001
+    height = 517
+
+    for i in range(2):
+        with gdal.GetDriverByName("GTiff").Create(
+            tmp_vsimem / f"src{i + 1}.tif", width, height, 1, gdal.GDT_Byte
+        ) as src:
+            src.WriteRaster(
+                0,
+                0,
+                width,
+                height,
+                bytes((j * (i + 3)) % 251 for j in range(width * height)),
+            )
+
+    xml = f"""
+    <VRTDataset rasterXSize="{width}" rasterYSize="{height}">
+      <VRTRasterBand dataType="Float32" band="1" subclass="VRTDerivedRasterBand">
+        <PixelFunctionType>{pixelfn}</PixelFunctionType>
+        {args}
+        <SimpleSource name="B1">
+          <SourceFilename>{tmp_vsimem / "src1.tif"}</SourceFilename>
+          <SourceBand>1</SourceBand>
+        </SimpleSource>
+        <SimpleSource name="B2">
+          <SourceFilename>{tmp_vsimem / "src2.tif"}</SourceFilename>
+          <SourceBand>1</SourceBand>
+        </SimpleSource>
+      </VRTRasterBand>
+    </VRTDataset>"""
+
+    with gdal.config_option("VRT_NUM_THREADS", "1"):
+        expected = gdal.Open(xml).ReadRaster()
+
+    # The 517517 pixels of the request are split in jobs of at least 65536
+    # pixels, and the number of jobs is capped by the number of CPUs.
+    expected_jobs = min(4, gdal.GetNumCPUs())
+
+    debug_msgs = []
+
+    def handler(err_class, err_no, msg):
+        if err_class == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    with gdal.config_option("VRT_NUM_THREADS", "4"):
+        with gdaltest.error_handler(handler):
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            with gdal.config_option("CPL_DEBUG", "VRT"):
+                got = gdal.Open(xml).ReadRaster()
+        assert got == expected
+        if expected_jobs > 1:
+            assert (
+                f"VRT: IRasterIO(): applying pixel function {pixelfn} with "
+                f"{expected_jobs} jobs" in debug_msgs
+            ), debug_msgs
+
+        # Non-default pixel and line spacing
+        got = gdal.Open(xml).ReadRaster(
+            buf_type=gdal.GDT_Float64, buf_pixel_space=16, buf_line_space=16 * width
+        )
+
+    expected_ds = gdal.GetDriverByName("MEM").Create(
+        "", width, height, 1, gdal.GDT_Float32
+    )
+    expected_ds.WriteRaster(0, 0, width, height, expected)
+    assert got == expected_ds.ReadRaster(
+        buf_type=gdal.GDT_Float64, buf_pixel_space=16, buf_line_space=16 * width
+    )
@@ -1819,6 +1819,70 @@ def test_vrtprocesseddataset_RasterIO(tmp_vsimem):
             ds.ReadAsArray()
 
 
+###############################################################################
+# Test that processing of large regions in parallel row strips gives the same
+# result as single-threaded processing
+
+
+def test_vrtprocesseddataset_multithreaded(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    with gdal.GetDriverByName("GTiff").Create(
+        src_filename, 1000, 1100, 2, gdal.GDT_UInt16, options=["TILED=YES"]
+    ) as src_ds:
+        src_ds.GetRasterBand(1).WriteArray(
+            (np.arange(1000 * 1100) % 1001).reshape(1100, 1000)
+        )
+        src_ds.GetRasterBand(2).WriteArray(
+            (np.arange(1000 * 1100) % 997).reshape(1100, 1000)
+        )
+        src_ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+
+    gain_filename = str(tmp_vsimem / "gain.tif")
+    with gdal.GetDriverByName("GTiff").Create(
+        gain_filename, 10, 11, 2, gdal.GDT_Float32
+    ) as gain_ds:
+        gain_ds.GetRasterBand(1).WriteArray(np.arange(110).reshape(11, 10) / 10)
+        gain_ds.GetRasterBand(2).WriteArray(np.arange(110).reshape(11, 10) / 20)
+        gain_ds.SetGeoTransform([0, 100, 0, 0, 0, -100])
+
+    vrt_content = f"""<VRTDataset subclass='VRTProcessedDataset'>
+    <Input>
+        <SourceFilename>{src_filename}</SourceFilename>
+    </Input>
+    <ProcessingSteps>
+        <Step>
+            <Algorithm>LocalScaleOffset</Algorithm>
+            <Argument name="gain_dataset_filename_1">{gain_filename}</Argument>
+            <Argument name="gain_dataset_band_1">1</Argument>
+            <Argument name="gain_dataset_filename_2">{gain_filename}</Argument>
+            <Argument name="gain_dataset_band_2">2</Argument>
+            <Argument name="offset_dataset_filename_1">{gain_filename}</Argument>
+            <Argument name="offset_dataset_band_1">2</Argument>
+            <Argument name="offset_dataset_filename_2">{gain_filename}</Argument>
+            <Argument name="offset_dataset_band_2">1</Argument>
+        </Step>
+        <Step>
+            <Algorithm>BandAffineCombination</Algorithm>
+            <Argument name="coefficients_1">0,0.5,0.5</Argument>
+            <Argument name="coefficients_2">1,1,-1</Argument>
+        </Step>
+    </ProcessingSteps>
+    </VRTDataset>
+    """
+
+    ds = gdal.OpenEx(vrt_content, open_options=["NUM_THREADS=1"])
+    expected_bsq = ds.ReadAsArray()
+    expected_bip = ds.ReadRaster(buf_pixel_space=4, buf_band_space=2)
+
+    ds = gdal.OpenEx(vrt_content, open_options=["NUM_THREADS=4"])
+    np.testing.assert_equal(ds.ReadAsArray(), expected_bsq)
+    assert ds.ReadRaster(buf_pixel_space=4, buf_band_space=2) == expected_bip
+    np.testing.assert_equal(
+        ds.ReadAsArray(13, 17, 987, 1083), expected_bsq[:, 17:1100, 13:1000]
+    )
+
+
 ###############################################################################
 # Validate processed datasets according to xsd
 
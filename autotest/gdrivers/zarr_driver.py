@@ -3994,8 +3994,10 @@ def test_zarr_cache_tile_presence(tmp_path, format):
 
 
 @pytest.mark.parametrize("compression", ["NONE", "GZIP"])
-@pytest.mark.parametrize("format", ["ZARR_V2", "ZARR_V3"])
-def test_zarr_advise_read(tmp_path, compression, format):
+@pytest.mark.parametrize(
+    "format,sharded", [("ZARR_V2", False), ("ZARR_V3", False), ("ZARR_V3", True)]
+)
+def test_zarr_advise_read(tmp_path, compression, format, sharded):
 
     filename = str(tmp_path / "test.zarr")
 
@@ -4031,7 +4033,12 @@ def test_zarr_advise_read(tmp_path, compression, format):
             [
                 "COMPRESS=" + compression,
                 "BLOCKSIZE=%d,%d" % (dim0_blocksize, dim1_blocksize),
-            ],
+            ]
+            + (
+                ["SHARD_SIZE=%d,%d" % (3 * dim0_blocksize, 4 * dim1_blocksize)]
+                if sharded
+                else []
+            ),
         )
         assert ar
         ar.SetNoDataValueDouble(0)
@@ -4070,6 +4077,236 @@ def test_zarr_advise_read(tmp_path, compression, format):
     read()
 
 
+@pytest.mark.parametrize("compression", ["NONE", "GZIP"])
+@pytest.mark.parametrize("format", ["ZARR_V2", "ZARR_V3"])
+def test_zarr_write_multithreaded(tmp_vsimem, compression, format):
+
+    filename = tmp_vsimem / "test.zarr"
+
+    data = array.array("H", [(i * 7) % 65521 for i in range(101 * 203)])
+
+    # Small write queue size to test waiting for jobs to complete
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "4", "GDAL_ZARR_WRITE_QUEUE_MAX_MEMORY": "1000"}
+    ):
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+            filename, options=["FORMAT=" + format]
+        )
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, 101)
+        dim1 = rg.CreateDimension("dim1", None, None, 203)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+            ["COMPRESS=" + compression, "BLOCKSIZE=10,20"],
+        )
+        assert ar.Write(data) == gdal.CE_None
+        # Read back tiles that may still be in the write queue
+        assert ar.Read() == data.tobytes()
+        # Rewrite tiles that may still be in the write queue
+        assert (
+            ar.Write(array.array("H", [0] * (20 * 40)), count=[20, 40])
+            == gdal.CE_None
+        )
+        ds = None
+
+    for y in range(20):
+        for x in range(40):
+            data[y * 203 + x] = 0
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert ar.Read() == data.tobytes()
+
+
+def _crc32c(data):
+    crc = 0xFFFFFFFF
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = (crc >> 1) ^ (0x82F63B78 if (crc & 1) else 0)
+    return crc ^ 0xFFFFFFFF
+
+
+@pytest.mark.parametrize("compression", ["NONE", "ZSTD"])
+def test_zarr_create_sharded(tmp_vsimem, compression):
+
+    if compression == "ZSTD" and "zstd" not in gdal.GetDriverByName(
+        "Zarr"
+    ).GetMetadataItem("COMPRESSORS"):
+        pytest.skip("compressor zstd not available")
+
+    filename = tmp_vsimem / "test.zarr"
+    data = array.array("B", [(i % 251) + 1 for i in range(11 * 13)])
+
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        filename, options=["FORMAT=ZARR_V3"]
+    )
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 11)
+    dim1 = rg.CreateDimension("dim1", None, None, 13)
+
+    with pytest.raises(Exception, match="SHARD_SIZE"):
+        rg.CreateMDArray(
+            "invalid",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+            ["BLOCKSIZE=2,3", "SHARD_SIZE=4,4"],
+        )
+
+    ar = rg.CreateMDArray(
+        "test",
+        [dim0, dim1],
+        gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+        ["BLOCKSIZE=2,3", "SHARD_SIZE=4,6", "COMPRESS=" + compression],
+    )
+    assert ar.Write(data) == gdal.CE_None
+    # Rewrite an inner chunk of an already written shard, which is only
+    # written back at closing
+    assert (
+        ar.Write(array.array("B", [0] * 6), array_start_idx=[8, 0], count=[2, 3])
+        == gdal.CE_None
+    )
+    ds = None
+
+    f = gdal.VSIFOpenL(filename / "test/zarr.json", "rb")
+    assert f
+    j = json.loads(gdal.VSIFReadL(1, 10000, f))
+    gdal.VSIFCloseL(f)
+    assert j["chunk_grid"]["configuration"]["chunk_shape"] == [4, 6]
+    assert len(j["codecs"]) == 1
+    assert j["codecs"][0]["name"] == "sharding_indexed"
+    config = j["codecs"][0]["configuration"]
+    assert config["chunk_shape"] == [2, 3]
+    assert [c["name"] for c in config["index_codecs"]] == ["bytes", "crc32c"]
+    assert config["index_location"] == "end"
+    if compression == "ZSTD":
+        assert config["codecs"][-1]["name"] == "zstd"
+
+    # 2 x 3 shards
+    assert gdal.VSIStatL(filename / "test/c/2/2") is not None
+    assert gdal.VSIStatL(filename / "test/c/3/0") is None
+
+    expected = array.array("B", data)
+    for y in range(8, 10):
+        for x in range(0, 3):
+            expected[y * 13 + x] = 0
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert ar.GetBlockSize() == [2, 3]
+    if compression == "ZSTD":
+        assert json.loads(ar.GetStructuralInfo()["COMPRESSOR"])["name"] == "zstd"
+    assert ar.Read() == expected.tobytes()
+    assert ar.Read(array_start_idx=[3, 4], count=[5, 6]) == bytes(
+        expected[y * 13 + x] for y in range(3, 8) for x in range(4, 10)
+    )
+
+    # Update a single inner chunk of an existing shard
+    assert (
+        ar.Write(array.array("B", [255] * 6), array_start_idx=[2, 6], count=[2, 3])
+        == gdal.CE_None
+    )
+    # Fully blank a shard
+    assert (
+        ar.Write(array.array("B", [0] * 24), array_start_idx=[0, 0], count=[4, 6])
+        == gdal.CE_None
+    )
+    ds = None
+
+    for y in range(2, 4):
+        for x in range(6, 9):
+            expected[y * 13 + x] = 255
+    for y in range(0, 4):
+        for x in range(0, 6):
+            expected[y * 13 + x] = 0
+
+    assert gdal.VSIStatL(filename / "test/c/0/0") is None
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert ar.Read() == expected.tobytes()
+
+
+def _write_hand_crafted_sharded_array(filename, index_location, corrupt_crc=False):
+
+    j = {
+        "zarr_format": 3,
+        "node_type": "array",
+        "shape": [4, 4],
+        "data_type": "uint8",
+        "chunk_grid": {"name": "regular", "configuration": {"chunk_shape": [4, 4]}},
+        "chunk_key_encoding": {"name": "default"},
+        "fill_value": 0,
+        "codecs": [
+            {
+                "name": "sharding_indexed",
+                "configuration": {
+                    "chunk_shape": [2, 2],
+                    "codecs": [{"name": "bytes"}],
+                    "index_codecs": [
+                        {"name": "bytes", "configuration": {"endian": "little"}},
+                        {"name": "crc32c"},
+                    ],
+                    "index_location": index_location,
+                },
+            }
+        ],
+    }
+    gdal.Mkdir(filename, 0)
+    gdal.FileFromMemBuffer(filename / "zarr.json", json.dumps(j))
+
+    # Inner chunk 1 is missing. Inner chunks are stored in reverse order.
+    chunks = {
+        0: bytes([1, 2, 5, 6]),
+        2: bytes([9, 10, 13, 14]),
+        3: bytes([11, 12, 15, 16]),
+    }
+    index_size = 4 * 16 + 4
+    offset = index_size if index_location == "start" else 0
+    payload = b""
+    index = [(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF)] * 4
+    for idx in (3, 2, 0):
+        index[idx] = (offset + len(payload), len(chunks[idx]))
+        payload += chunks[idx]
+    index_bytes = b"".join(struct.pack("<QQ", *x) for x in index)
+    crc = _crc32c(index_bytes)
+    if corrupt_crc:
+        crc ^= 1
+    index_bytes += struct.pack("<I", crc)
+    if index_location == "start":
+        content = index_bytes + payload
+    else:
+        content = payload + index_bytes
+    gdal.FileFromMemBuffer(filename / "c/0/0", content)
+
+
+@pytest.mark.parametrize("index_location", ["start", "end"])
+def test_zarr_read_sharded(tmp_vsimem, index_location):
+
+    filename = tmp_vsimem / "test.zarr"
+    _write_hand_crafted_sharded_array(filename, index_location)
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert ar.GetBlockSize() == [2, 2]
+    expected = bytes([1, 2, 0, 0, 5, 6, 0, 0, 9, 10, 11, 12, 13, 14, 15, 16])
+    assert ar.Read() == expected
+    assert ar.AdviseRead(options=["NUM_THREADS=2"]) == gdal.CE_None
+    assert ar.Read() == expected
+
+
+def test_zarr_read_sharded_corrupted_index(tmp_vsimem):
+
+    filename = tmp_vsimem / "test.zarr"
+    _write_hand_crafted_sharded_array(filename, "end", corrupt_crc=True)
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    with pytest.raises(Exception, match="Cannot decode index of shard"):
+        ar.Read()
+
+
 def test_zarr_read_invalid_nczarr_dim(tmp_vsimem):
 
     gdal.Mkdir(tmp_vsimem / "test.zarr", 0)
@@ -5947,3 +5947,162 @@ def test_ogr_geojson_sqlite_dialect_id_property():
             f = sql_lyr.GetNextFeature()
             assert f["id"] == 5
             assert f["foo"] == "bar"
+
+
+###############################################################################
+# Test IN_MEMORY_SPATIAL_INDEX open option
+
+
+def test_ogr_geojson_in_memory_spatial_index(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.json")
+
+    features = []
+    for i in range(10):
+        for j in range(10):
+            features.append(
+                {
+                    "type": "Feature",
+                    "properties": {"i": i, "j": j},
+                    "geometry": {"type": "Point", "coordinates": [i, j]},
+                }
+            )
+    features.append({"type": "Feature", "properties": {}, "geometry": None})
+    gdal.FileFromMemBuffer(
+        filename, json.dumps({"type": "FeatureCollection", "features": features})
+    )
+
+    with gdal.OpenEx(filename, open_options=["IN_MEMORY_SPATIAL_INDEX=YES"]) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.TestCapability(ogr.OLCFastSpatialFilter) == 0
+
+        # First filtered read builds the index
+        lyr.SetSpatialFilterRect(1.5, 2.5, 3.5, 4.5)
+        assert [(f["i"], f["j"]) for f in lyr] == [
+            (2, 3),
+            (2, 4),
+            (3, 3),
+            (3, 4),
+        ]
+        assert lyr.TestCapability(ogr.OLCFastSpatialFilter) == 1
+
+        # Subsequent reads use it
+        lyr.SetSpatialFilterRect(8.5, 8.5, 100, 100)
+        assert [(f["i"], f["j"]) for f in lyr] == [(9, 9)]
+        assert lyr.GetFeatureCount() == 1
+
+        lyr.SetAttributeFilter("i = 0")
+        lyr.SetSpatialFilterRect(-1, -1, 0.5, 1.5)
+        assert [(f["i"], f["j"]) for f in lyr] == [(0, 0), (0, 1)]
+
+        lyr.SetSpatialFilterRect(100, 100, 200, 200)
+        assert lyr.GetNextFeature() is None
+
+        lyr.SetAttributeFilter(None)
+        lyr.SetSpatialFilter(None)
+        assert lyr.GetFeatureCount() == 101
+        assert len([f for f in lyr]) == 101
+
+    # Interrupted sequential read does not produce an incomplete index
+    with gdal.OpenEx(filename, open_options=["IN_MEMORY_SPATIAL_INDEX=YES"]) as ds:
+        lyr = ds.GetLayer(0)
+        lyr.GetNextFeature()
+        lyr.ResetReading()
+        assert lyr.TestCapability(ogr.OLCFastSpatialFilter) == 0
+        lyr.SetSpatialFilterRect(8.5, 8.5, 100, 100)
+        assert [(f["i"], f["j"]) for f in lyr] == [(9, 9)]
+        assert lyr.TestCapability(ogr.OLCFastSpatialFilter) == 1
+
+
+###############################################################################
+# Test that geometries decoded directly by the streaming parser, without
+# building json_object for their coordinates, are identical to the ones
+# decoded through json_object
+
+
+_direct_geometry_decoding_geometries = [
+    '{"type":"Point","coordinates":[1,2]}',
+    '{"type":"Point","coordinates":[1.5,2,3]}',
+    '{"coordinates":[[1,2],[3,4]],"type":"LineString"}',
+    '{"type":"MultiPoint","coordinates":[[1,2,3],[4,5,6]]}',
+    '{"type":"Polygon","coordinates":[[[0,0],[0,1],[1,1],[0,0]],[[0.1,0.1],[0.1,0.2],[0.2,0.2],[0.1,0.1]]]}',
+    '{"type":"MultiLineString","coordinates":[[[1,2],[3,4]],[[5,6],[7,8]]]}',
+    '{"type":"MultiPolygon","coordinates":[[[[0,0,1],[0,1,1],[1,1,1],[0,0,1]]]]}',
+    '{"type":"Point","coordinates":[NaN,2]}',
+    # Below cases go through the json_object based code path
+    '{"type":"LineString","coordinates":[]}',
+    '{"type":"LineString","coordinates":[[1,2],[3,4,5]]}',
+    '{"type":"LineString","coordinates":[[1,2,3,4],[3,4,5,6]]}',
+    '{"type":"MultiPolygon","coordinates":[[],[[[0,0,0],[0,1,0],[1,1,0],[0,0,0]]]]}',
+    '{"type":"Point","coordinates":[9007199254740993,2]}',
+    '{"type":"Point","coordinates":[1,"2"]}',
+    '{"type":"Point","coordinates":[1,null]}',
+    '{"type":"Point","coordinates":[[1,2]]}',
+    '{"type":"Point","coordinates":[{"x":1},2]}',
+    '{"type":"Point","coordinates":[1,2],"coordinates":[3,4]}',
+    '{"type":"Point","coordinates":[1,2],"Coordinates":[3,4]}',
+    '{"TYPE":"LineString","type":"Point","coordinates":[1,2]}',
+    '{"type":"Point","crs":{"type":"name","properties":{"name":"urn:ogc:def:crs:EPSG::32631"}},"coordinates":[1,2]}',
+    '{"type":"GeometryCollection","geometries":[{"type":"Point","coordinates":[1,2]}]}',
+    '{"type":"Unknown","coordinates":[1,2]}',
+]
+
+
+def _read_layer_with_direct_geometry_decoding(filename, direct):
+    with gdaltest.config_option("OGR_GEOJSON_DIRECT_GEOMETRY_DECODING", direct):
+        with gdal.quiet_errors():
+            ds = ogr.Open(filename)
+            lyr = ds.GetLayer(0)
+            ret = [lyr.GetGeomType(), lyr.GetExtent3D()]
+            for f in lyr:
+                g = f.GetGeometryRef()
+                if g is None:
+                    ret.append(None)
+                else:
+                    srs = g.GetSpatialReference()
+                    ret.append(
+                        (
+                            g.ExportToIsoWkt(),
+                            srs.GetAuthorityCode(None) if srs else None,
+                        )
+                    )
+    return ret
+
+
+@gdaltest.disable_exceptions()
+@pytest.mark.parametrize("geom", _direct_geometry_decoding_geometries)
+def test_ogr_geojson_direct_geometry_decoding(tmp_vsimem, geom):
+
+    filename = tmp_vsimem / "test.json"
+    gdal.FileFromMemBuffer(
+        filename,
+        '{"type":"FeatureCollection","features":[{"type":"Feature","properties":{},"geometry":%s}]}'
+        % geom,
+    )
+    assert _read_layer_with_direct_geometry_decoding(
+        filename, "YES"
+    ) == _read_layer_with_direct_geometry_decoding(filename, "NO")
+
+
+@gdaltest.disable_exceptions()
+def test_ogr_geojson_direct_geometry_decoding_several_features(tmp_vsimem):
+
+    filename = tmp_vsimem / "test.json"
+    features = [
+        '{"type":"Feature","properties":{"i":%d},"geometry":%s}' % (i, geom)
+        for i, geom in enumerate(_direct_geometry_decoding_geometries)
+    ]
+    # Repeated geometry member
+    features.append(
+        '{"type":"Feature","geometry":{"type":"Point","coordinates":[1,2]},"properties":{},"geometry":{"type":"Point","coordinates":[3,4]}}'
+    )
+    features.append(
+        '{"type":"Feature","geometry":{"type":"Point","coordinates":[1,2]},"properties":{},"Geometry":null}'
+    )
+    gdal.FileFromMemBuffer(
+        filename,
+        '{"type":"FeatureCollection","features":[%s]}' % ",".join(features),
+    )
+    ret = _read_layer_with_direct_geometry_decoding(filename, "YES")
+    assert ret[2] == ("POINT (1 2)", "4326")
+    assert ret == _read_layer_with_direct_geometry_decoding(filename, "NO")
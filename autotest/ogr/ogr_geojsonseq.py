@@ -522,3 +522,114 @@ def test_ogr_geojsonseq_WRITE_BBOX(tmp_vsimem):
     gdal.VSIFCloseL(f)
 
     assert b'"bbox": [ 2.0, 49.0, 3.0, 50.0 ]' in data
+
+
+###############################################################################
+# Test that geometries decoded directly by the streaming parser, without
+# building json_object for their coordinates, are identical to the ones
+# decoded through json_object
+
+
+@gdaltest.disable_exceptions()
+def test_ogr_geojsonseq_direct_geometry_decoding(tmp_vsimem):
+
+    geoms = [
+        '{"type":"Point","coordinates":[1,2]}',
+        '{"coordinates":[[1,2,3],[3,4,5]],"type":"LineString"}',
+        '{"type":"MultiPolygon","coordinates":[[[[0,0],[0,1],[1,1],[0,0]]]]}',
+        '{"type":"LineString","coordinates":[[1,2],[3,4,5]]}',
+        '{"type":"Point","coordinates":[1,"2"]}',
+        '{"type":"GeometryCollection","geometries":[{"type":"Point","coordinates":[1,2]}]}',
+    ]
+    records = [
+        '{"type":"Feature","properties":{"i":%d},"geometry":%s}' % (i, geom)
+        for i, geom in enumerate(geoms)
+    ]
+    # Non Feature records
+    records += geoms[0:2]
+    records.append('{"type":"Feature","properties":{},"geometry":null} trailer')
+
+    filename = str(tmp_vsimem / "test.geojsonl")
+    gdal.FileFromMemBuffer(filename, "\n".join(records))
+
+    def read(direct):
+        with gdaltest.config_option("OGR_GEOJSON_DIRECT_GEOMETRY_DECODING", direct):
+            with gdal.quiet_errors():
+                ds = ogr.Open(filename)
+                lyr = ds.GetLayer(0)
+                ret = [lyr.GetGeomType(), lyr.GetFeatureCount()]
+                for f in lyr:
+                    g = f.GetGeometryRef()
+                    ret.append((f.GetFID(), g.ExportToIsoWkt() if g else None))
+        return ret
+
+    ret = read("YES")
+    assert ret[2] == (0, "POINT (1 2)")
+    assert ret == read("NO")
+
+
+###############################################################################
+# Test multi-threaded reading
+
+
+@pytest.mark.parametrize("rs", [False, True])
+def test_ogr_geojsonseq_multithreaded_reading(tmp_vsimem, rs):
+
+    records = []
+    for i in range(5000):
+        if i % 1000 == 10:
+            records.append("invalid")
+        elif i % 1000 == 20:
+            records.append('{"type":"Point","coordinates":[%d,1]}' % i)
+        elif i % 1000 == 30:
+            records.append('{"type":"Feature","id":%d,"properties":{}}' % (100000 + i))
+        else:
+            records.append(
+                '{"type":"Feature","properties":{"i":%d,"s":"%s"},"geometry":{"type":"Point","coordinates":[%d,2]}}'
+                % (i, "x" * (i % 7), i)
+            )
+    sep = "\x1e" if rs else "\n"
+    filename = str(tmp_vsimem / "test.geojsons")
+    gdal.FileFromMemBuffer(filename, sep + sep.join(records) + "\n")
+
+    def read(num_threads):
+        with gdaltest.config_options(
+            {
+                "OGR_GEOJSONSEQ_NUM_THREADS": num_threads,
+                "OGR_GEOJSONSEQ_CHUNK_SIZE": "1000",
+            }
+        ):
+            gdal.ErrorReset()
+            with gdal.quiet_errors():
+                ds = ogr.Open(filename)
+                lyr = ds.GetLayer(0)
+                ret = [
+                    lyr.GetFeatureCount(),
+                    lyr.GetLayerDefn().GetFieldCount(),
+                    gdal.GetLastErrorMsg(),
+                ]
+                for f in lyr:
+                    g = f.GetGeometryRef()
+                    ret.append(
+                        (
+                            f.GetFID(),
+                            f["i"],
+                            f["s"],
+                            g.ExportToIsoWkt() if g else None,
+                        )
+                    )
+                ret.append(gdal.GetLastErrorMsg())
+
+                # Interrupt reading and restart
+                lyr.ResetReading()
+                for i in range(10):
+                    lyr.GetNextFeature()
+                lyr.ResetReading()
+                ret.append(lyr.GetNextFeature().GetFID())
+        return ret
+
+    ret = read("1")
+    assert ret[0] == 4995
+    assert ret[3] == (0, 0, "", "POINT (0 2)")
+    assert ret[-2] != ""
+    assert ret == read("4")
@@ -939,6 +939,34 @@ def test_ogr_openfilegdb_7():
             1,
         ),
         ("select * from big_layer order by real desc", 86 + 3 * 85, 4 * 85, 1),
+        (
+            "select * from big_layer where real >= 1 and real < 3 order by real",
+            2 * 85,
+            2,
+            1,
+        ),
+        (
+            "select * from big_layer where real > 0 and real <= 2 "
+            "order by real limit 1 offset 85",
+            1,
+            3,
+            1,
+        ),
+        (
+            "select * from big_layer where real between 1 and 2 "
+            "order by real desc limit 3",
+            3,
+            339,
+            1,
+        ),
+        (
+            "select * from big_layer where 2 > real and real > 0 order by real",
+            85,
+            2,
+            1,
+        ),
+        ("select distinct id from point order by id", 5, 0, 1),
+        ("select distinct real from big_layer order by real desc", 4, 0, 1),
         # Invalid :
         ("select foo from", None, None, None),
         ("select foo from bar", None, None, None),
@@ -947,13 +975,14 @@ def test_ogr_openfilegdb_7():
         ("select * from point order by xml", None, None, 0),
         ("select fid from point order by id", None, None, 0),
         ("select cast(id as float) from point order by id", None, None, 0),
-        ("select distinct id from point order by id", None, None, 0),
         ("select 1 from point order by id", None, None, 0),
         ("select count(*) from point order by id", None, None, 0),
         ("select * from point order by nullint", None, None, 0),
         ("select * from point where id = 1 or id = 2 order by id", None, None, 0),
         ("select * from point where id = 1 order by id, float", None, None, 0),
         ("select * from point where float > 0 order by id", None, None, 0),
+        ("select * from point where id <> 1 order by id", None, None, 0),
+        ("select distinct real as r from big_layer", None, None, 0),
     ]
 
     for (sql, feat_count, first_fid, expected_optimized) in tests:
@@ -1003,6 +1032,115 @@ def test_ogr_openfilegdb_7():
                 )
 
 
+###############################################################################
+# Test MIN/MAX/SUM/AVG/COUNT and DISTINCT with a WHERE clause on an indexed
+# field
+
+
+def test_ogr_openfilegdb_indexed_aggregate_and_distinct():
+
+    ds = ogr.Open("data/filegdb/testopenfilegdb.gdb.zip")
+
+    def last_sql_optimized():
+        with ds.ExecuteSQL("GetLastSQLUsedOptimizedImplementation") as sql_lyr:
+            return int(sql_lyr.GetNextFeature().GetField(0))
+
+    with ds.ExecuteSQL(
+        "select min(real), max(real), count(real), sum(real), avg(real) "
+        "from big_layer where real >= 1 and real < 3"
+    ) as sql_lyr:
+        assert [
+            sql_lyr.GetLayerDefn().GetFieldDefn(i).GetName() for i in range(5)
+        ] == ["MIN_real", "MAX_real", "COUNT_real", "SUM_real", "AVG_real"]
+        assert (
+            sql_lyr.GetLayerDefn().GetFieldDefn(2).GetType() == ogr.OFTInteger64
+        )
+        f = sql_lyr.GetNextFeature()
+        assert f["MIN_real"] == 1
+        assert f["MAX_real"] == 2
+        assert f["COUNT_real"] == 2 * 85
+        assert f["SUM_real"] == 3 * 85
+        assert f["AVG_real"] == 1.5
+    assert last_sql_optimized() == 1
+
+    with ds.ExecuteSQL("select count(*) from big_layer where real = 0") as sql_lyr:
+        f = sql_lyr.GetNextFeature()
+        assert f["COUNT_*"] == 86
+    assert last_sql_optimized() == 1
+
+    with ds.ExecuteSQL(
+        "select count(real), avg(real) from big_layer where real > 3"
+    ) as sql_lyr:
+        f = sql_lyr.GetNextFeature()
+        assert f["COUNT_real"] == 0
+        assert f.IsFieldNull("AVG_real")
+    assert last_sql_optimized() == 1
+
+    with ds.ExecuteSQL(
+        "select distinct real from big_layer where real >= 1 order by real"
+    ) as sql_lyr:
+        assert [f["real"] for f in sql_lyr] == [1, 2, 3]
+    assert last_sql_optimized() == 1
+
+    with ds.ExecuteSQL(
+        "select distinct real from big_layer order by real limit 2 offset 1"
+    ) as sql_lyr:
+        assert [f["real"] for f in sql_lyr] == [1, 2]
+    assert last_sql_optimized() == 1
+
+    # Not optimized: the WHERE clause is not on the aggregated field
+    with ds.ExecuteSQL(
+        "select min(id) from point where float > 0 or float <= 0"
+    ) as sql_lyr:
+        pass
+    assert last_sql_optimized() == 0
+
+
+###############################################################################
+# Test ExecuteSQL() with ORDER BY on an indexed field and a spatial filter
+
+
+def test_ogr_openfilegdb_order_by_spatial_filter():
+
+    ds = ogr.Open("data/filegdb/testopenfilegdb.gdb.zip")
+    lyr = ds.GetLayerByName("point")
+    minx, maxx, miny, maxy = lyr.GetExtent()
+    filter_geom = ogr.CreateGeometryFromWkt(
+        "POLYGON((%.17g %.17g,%.17g %.17g,%.17g %.17g,%.17g %.17g,%.17g %.17g))"
+        % (
+            minx,
+            miny,
+            minx,
+            maxy,
+            (minx + maxx) / 2,
+            maxy,
+            (minx + maxx) / 2,
+            miny,
+            minx,
+            miny,
+        )
+    )
+
+    def get_fids(sql):
+        with ds.ExecuteSQL(sql, spatialFilter=filter_geom) as sql_lyr:
+            fids = [f.GetFID() for f in sql_lyr]
+        with ds.ExecuteSQL("GetLastSQLUsedOptimizedImplementation") as sql_lyr:
+            optimized = int(sql_lyr.GetNextFeature().GetField(0))
+        return fids, optimized
+
+    for sql in [
+        "select * from point order by id",
+        "select * from point order by id desc limit 2",
+        "select * from point where id >= 2 order by id",
+    ]:
+        fids, optimized = get_fids(sql)
+        assert optimized == 1, sql
+        with gdal.config_option("OPENFILEGDB_USE_INDEX", "NO"):
+            expected_fids, optimized = get_fids(sql)
+        assert optimized == 0, sql
+        assert fids == expected_fids, sql
+
+
 ###############################################################################
 # Test reading a .gdbtable without .gdbtablx
 
@@ -348,3 +348,47 @@ def test_gdalalg_raster_proximity_cannot_create_temp_file(tmp_path, tmp_vsimem):
     ):
         with pytest.raises(Exception):
             alg.Run()
+
+
+@pytest.mark.require_driver("GTiff")
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("distance_units", ["pixel", "geo"])
+def test_gdalalg_raster_proximity_tiled_streaming(
+    tmp_vsimem, num_threads, distance_units
+):
+
+    # Sparse targets, so that the output is tiled over several blocks
+    input_data = np.zeros((600, 700), dtype=np.uint8)
+    input_data[5::37, 3::41] = 1
+    input_data[300:310, 250:600] = 1
+    input_data[599, 699] = 1
+    input_data[100:110, 100:110] = 255
+    src_filename = tmp_vsimem / "prox_in.tif"
+    create_gtiff_from_array(
+        src_filename, input_data, gt=(0, 2, 0, 0, 0, -2), nodata_val=255
+    )
+
+    def run(tiled_streaming):
+        with gdaltest.config_options(
+            {
+                "GDAL_RASTER_PIPELINE_TILED_STREAMING": tiled_streaming,
+                "GDAL_NUM_THREADS": num_threads,
+            }
+        ):
+            with gdal.Run(
+                "raster",
+                "pipeline",
+                pipeline=f"read {src_filename} ! proximity --max-distance 20 --distance-units {distance_units} --nodata 200 --datatype Float32 ! write --of=stream streamed_dataset",
+            ) as alg:
+                ds = alg.Output()
+                assert ds.RasterXSize == 700
+                assert ds.RasterYSize == 600
+                assert ds.GetGeoTransform() == (0, 2, 0, 0, 0, -2)
+                assert ds.GetRasterBand(1).GetNoDataValue() == 200
+                return ds.ReadAsArray()
+
+    ref = run("NO")
+    got = run("YES")
+    assert np.array_equal(got, ref)
+    assert (ref == 200).any()
+    assert (ref == 0).any()
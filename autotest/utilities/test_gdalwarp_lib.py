@@ -4587,3 +4587,77 @@ def test_gdalwarp_te_srs_check_extent():
     assert out_ds.GetGeoTransform() == pytest.approx(
         (166021, 37108, 0.0, 0.0, 0.0, -36622), abs=1000
     )
+
+
+###############################################################################
+# Test the multithreaded warping implementation with more than 2 chunks
+# processed concurrently
+
+
+@pytest.mark.parametrize("chunk_threads", ["2", "4", "ALL_CPUS"])
+def test_gdalwarp_lib_multi_chunk_threads(chunk_threads):
+
+    options = "-t_srs EPSG:4326 -r bilinear -wm 100000 -f MEM"
+    ref_ds = gdal.Warp("", "../gdrivers/data/small_world.tif", options=options)
+
+    tab_pct = [0]
+
+    def my_progress(pct, msg, user_data):
+        assert pct >= user_data[0]
+        user_data[0] = pct
+        return 1
+
+    out_ds = gdal.Warp(
+        "",
+        "../gdrivers/data/small_world.tif",
+        options=options
+        + f" -multi -wo MULTI_CHUNK_THREADS={chunk_threads} -wo NUM_THREADS=2",
+        callback=my_progress,
+        callback_data=tab_pct,
+    )
+    assert tab_pct[0] == 1.0
+    assert [
+        out_ds.GetRasterBand(i + 1).Checksum() for i in range(out_ds.RasterCount)
+    ] == [ref_ds.GetRasterBand(i + 1).Checksum() for i in range(ref_ds.RasterCount)]
+
+
+###############################################################################
+# Test the multithreaded warping implementation with a thread-safe source,
+# whose reads are not serialized
+
+
+@pytest.mark.parametrize("dstalpha", [False, True])
+def test_gdalwarp_lib_multi_chunk_threads_thread_safe_source(dstalpha):
+
+    options = "-t_srs EPSG:4326 -r bilinear -wm 100000 -f MEM"
+    if dstalpha:
+        options += " -dstalpha"
+    ref_ds = gdal.Warp("", "../gdrivers/data/small_world.tif", options=options)
+
+    src_ds = gdal.OpenEx(
+        "../gdrivers/data/small_world.tif", gdal.OF_RASTER | gdal.OF_THREAD_SAFE
+    )
+    assert src_ds.IsThreadSafe(gdal.OF_RASTER)
+
+    debug_msgs = []
+
+    def handler(err_class, err_no, msg):
+        if err_class == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    with gdaltest.error_handler(handler):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        with gdal.config_option("CPL_DEBUG", "GDAL"):
+            out_ds = gdal.Warp(
+                "",
+                src_ds,
+                options=options + " -multi -wo MULTI_CHUNK_THREADS=4",
+            )
+    assert any(
+        msg.startswith("GDAL: ChunkAndWarpMulti(): ")
+        and msg.endswith(", concurrent source reads")
+        for msg in debug_msgs
+    ), debug_msgs
+    assert [
+        out_ds.GetRasterBand(i + 1).Checksum() for i in range(out_ds.RasterCount)
+    ] == [ref_ds.GetRasterBand(i + 1).Checksum() for i in range(ref_ds.RasterCount)]
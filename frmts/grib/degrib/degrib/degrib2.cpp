@@ -1175,6 +1175,10 @@ int ReadGrib2Record (VSILFILE *fp, sChar f_unit, double **Grib_Data,
 
    /* Loop through the grib message looking for the subgNum grid.  subgNum
     * goes from 0 to n-1. */
+   /* Sub grid state of unpk_g2ncep(), kept here rather than in static
+    * variables so that several messages can be unpacked concurrently. */
+   unsigned int unpkSubgNum = 0;
+   sInt4 unpkNumfields = 1;
    for (j = 0; j <= subgNum; j++) {
       if (j == 0) {
          inew = 1;
@@ -1194,7 +1198,8 @@ int ReadGrib2Record (VSILFILE *fp, sChar f_unit, double **Grib_Data,
                   &(IS->ns[4]), IS->is[5], &(IS->ns[5]), IS->is[6],
                   &(IS->ns[6]), IS->is[7], &(IS->ns[7]), IS->ib, &ibitmap,
                   c_ipack, &(IS->nd5), &xmissp, &xmisss, &inew, &iclean,
-                  &l3264b, f_endMsg, jer, &ndjer, &kjer);
+                  &l3264b, f_endMsg, jer, &ndjer, &kjer,
+                  &unpkSubgNum, &unpkNumfields);
 /*
       unpk_grib2 (&kfildo, (float *) (IS->iain), IS->iain, &(IS->nd2x3),
                   IS->idat, &(IS->nidat), IS->rdat, &(IS->nrdat), IS->is[0],
@@ -1603,6 +1608,10 @@ int ReadGrib2RecordFast (FILE *fp, sChar f_unit, double **Grib_Data,
 
    /* Loop through the grib message looking for the subgNum grid.  subgNum
     * goes from 0 to n-1. */
+   /* Sub grid state of unpk_g2ncep(), kept here rather than in static
+    * variables so that several messages can be unpacked concurrently. */
+   unsigned int unpkSubgNum = 0;
+   sInt4 unpkNumfields = 1;
    for (j = 0; j <= subgNum; j++) {
       if (j == 0) {
          inew = 1;
@@ -1630,7 +1639,8 @@ int ReadGrib2RecordFast (FILE *fp, sChar f_unit, double **Grib_Data,
                   &(IS->ns[4]), IS->is[5], &(IS->ns[5]), IS->is[6],
                   &(IS->ns[6]), IS->is[7], &(IS->ns[7]), IS->ib, &ibitmap,
                   c_ipack, &(IS->nd5), &xmissp, &xmisss, &inew, &iclean,
-                  &l3264b, f_endMsg, jer, &ndjer, &kjer);
+                  &l3264b, f_endMsg, jer, &ndjer, &kjer,
+                  &unpkSubgNum, &unpkNumfields);
 
 
       /*
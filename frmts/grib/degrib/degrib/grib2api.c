@@ -736,6 +736,12 @@ is required for each GRIB2 message.
  * jer(ndjer,2) = error codes along with severity. (Output)
  *   ndjer = 1/2 length of jer. (>= 15) (Input)
  *    kjer = number of error messages stored in jer.
+ * pSubgNum = The sub grid we read most recently.  This is primarily to help
+ *           with the inew option.  Must be preserved by the caller between
+ *           calls for a same message. (Input/Output)
+ * pNumfields = Number of sub Grids in this message.  Set when inew = 1, and
+ *           must be preserved by the caller between calls for a same
+ *           message. (Input/Output)
  *
  * FILES/DATABASES: None
  *
@@ -803,16 +809,13 @@ void unpk_g2ncep(CPL_UNUSED sInt4 *kfildo, float *ain, sInt4 *iain, sInt4 *nd2x3
                  sInt4 *ib, sInt4 *ibitmap, unsigned char *c_ipack,
                  sInt4 *nd5, float *xmissp, float *xmisss,
                  sInt4 *inew, sInt4 *iclean, CPL_UNUSED sInt4 *l3264b,
-                 sInt4 *iendpk, sInt4 *jer, sInt4 *ndjer, sInt4 *kjer)
+                 sInt4 *iendpk, sInt4 *jer, sInt4 *ndjer, sInt4 *kjer,
+                 unsigned int *pSubgNum, sInt4 *pNumfields)
 {
    int i;               /* A counter used for a number of purposes. */
-   static unsigned int subgNum = 0; /* The sub grid we read most recently.
-                                     * This is primarily to help with the
-                                     * inew option. */
    int ierr;            /* Holds the error code from a called routine. */
    sInt4 listsec0[3];
    sInt4 listsec1[13];
-   static sInt4 numfields = 1; /* Number of sub Grids in this message */
    sInt4 numlocal;      /* Number of local sections in this message. */
    int unpack;          /* Tell g2_getfld to unpack the message. */
    int expand;          /* Tell g2_getflt to attempt to expand the bitmap. */
@@ -839,10 +842,10 @@ void unpk_g2ncep(CPL_UNUSED sInt4 *kfildo, float *ain, sInt4 *iain, sInt4 *nd2x3
    *kjer = 8;
 
    /* The first time in, figure out how many grids there are, and store it in
-    * numfields for subsequent calls with inew != 1. */
+    * *pNumfields for subsequent calls with inew != 1. */
    if (*inew == 1) {
-      subgNum = 0;
-      ierr = g2_info(c_ipack, listsec0, listsec1, &numfields, &numlocal);
+      *pSubgNum = 0;
+      ierr = g2_info(c_ipack, listsec0, listsec1, pNumfields, &numlocal);
       if (ierr != 0) {
          switch (ierr) {
             case 1:    /* Beginning characters "GRIB" not found. */
@@ -862,20 +865,20 @@ void unpk_g2ncep(CPL_UNUSED sInt4 *kfildo, float *ain, sInt4 *iain, sInt4 *nd2x3
          return;
       }
    } else {
-      if (subgNum + 1 >= (unsigned int)numfields) {
+      if (*pSubgNum + 1 >= (unsigned int)*pNumfields) {
          /* Field request error. */
          jer[0 + *ndjer] = 2;
          *kjer = 1;
          return;
       }
-      subgNum++;
+      (*pSubgNum)++;
    }
 
    /* Expand the desired subgrid. */
    unpack = ain != NULL || iain != NULL;
    expand = 1;
    /* The size of c_ipack is *nd5 * sizeof(sInt4) */
-   ierr = g2_getfld(c_ipack, *nd5 * sizeof(sInt4), subgNum + 1, unpack, expand, &gfld);
+   ierr = g2_getfld(c_ipack, *nd5 * sizeof(sInt4), *pSubgNum + 1, unpack, expand, &gfld);
    if (ierr != 0) {
       switch (ierr) {
          case 1:       /* Beginning characters "GRIB" not found. */
@@ -967,7 +970,7 @@ void unpk_g2ncep(CPL_UNUSED sInt4 *kfildo, float *ain, sInt4 *iain, sInt4 *nd2x3
    /* Fill out section lengths (separate procedure because of possibility of
     * having multiple grids.  Should combine fillOutSectLen g2_info, and
     * g2_getfld into one procedure to optimize it. */
-   fillOutSectLen(c_ipack + 16 + is1[0], 4 * *nd5 - 15 - is1[0], subgNum,
+   fillOutSectLen(c_ipack + 16 + is1[0], 4 * *nd5 - 15 - is1[0], *pSubgNum,
                   is2, is3, is4, is5, is6, is7);
 
    /* Check if there is section 2 data. */
@@ -1176,7 +1179,7 @@ void unpk_g2ncep(CPL_UNUSED sInt4 *kfildo, float *ain, sInt4 *iain, sInt4 *nd2x3
    is6[5] = gfld->ibmap;
    is7[4] = 7;
 
-   if (subgNum + 1 == (unsigned int)numfields) {
+   if (*pSubgNum + 1 == (unsigned int)*pNumfields) {
       *iendpk = 1;
    } else {
       *iendpk = 0;
@@ -1547,6 +1550,8 @@ void unpk_grib2(sInt4 *kfildo, float *ain, sInt4 *iain, sInt4 *nd2x3,
 {
    unsigned char *c_ipack; /* The compressed data as char instead of sInt4 so
                             * it is easier to work with. */
+   static unsigned int subgNum = 0; /* Sub grid state of unpk_g2ncep() */
+   static sInt4 numfields = 1;
 #if 0
    char f_useMDL = 0;   /* Instructed 3/8/2005 10:30 to not use MDL. */
 #endif
@@ -1565,7 +1570,8 @@ void unpk_grib2(sInt4 *kfildo, float *ain, sInt4 *iain, sInt4 *nd2x3,
    unpk_g2ncep(kfildo, ain, iain, nd2x3, idat, nidat, rdat, nrdat, is0,
                ns0, is1, ns1, is2, ns2, is3, ns3, is4, ns4, is5, ns5,
                is6, ns6, is7, ns7, ib, ibitmap, c_ipack, nd5, xmissp,
-               xmisss, inew, iclean, l3264b, iendpk, jer, ndjer, kjer);
+               xmisss, inew, iclean, l3264b, iendpk, jer, ndjer, kjer,
+               &subgNum, &numfields);
 
 #ifndef WORDS_BIGENDIAN
    /* Swap back because we could be called again for the subgrid data. */
@@ -38,7 +38,8 @@ void unpk_g2ncep(sInt4 *kfildo, float *ain, sInt4 *iain, sInt4 *nd2x3,
                  sInt4 *ib, sInt4 *ibitmap, unsigned char *c_ipack,
                  sInt4 *nd5, float *xmissp, float *xmisss,
                  sInt4 *inew, sInt4 *iclean, sInt4 *l3264b,
-                 sInt4 *iendpk, sInt4 *jer, sInt4 *ndjer, sInt4 *kjer);
+                 sInt4 *iendpk, sInt4 *jer, sInt4 *ndjer, sInt4 *kjer,
+                 unsigned int *pSubgNum, sInt4 *pNumfields);
 int C_pkGrib2 (unsigned char *cgrib, sInt4 *sec0, sInt4 *sec1,
                unsigned char *csec2, sInt4 lcsec2,
                sInt4 *igds, sInt4 *igdstmpl, sInt4 *ideflist,
@@ -29,6 +29,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <mutex>
 #include <set>
 #include <string>
@@ -36,6 +37,7 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
@@ -54,6 +56,7 @@ CPL_C_END
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_spatialref.h"
 #include "memdataset.h"
 
@@ -795,94 +798,114 @@ const char *GRIBRasterBand::GetDescription() const
 CPLErr GRIBRasterBand::LoadData()
 
 {
-    if (!m_Grib_Data)
+    GRIBDataset *poGDS = static_cast<GRIBDataset *>(poDS);
+    if (m_Grib_Data)
     {
-        GRIBDataset *poGDS = static_cast<GRIBDataset *>(poDS);
+        // Mark as most recently used.
+        poGDS->m_oLRUCachedBands.splice(poGDS->m_oLRUCachedBands.begin(),
+                                        poGDS->m_oLRUCachedBands, m_oLRUIter);
+        return CE_None;
+    }
 
-        if (poGDS->bCacheOnlyOneBand)
-        {
-            // In "one-band-at-a-time" strategy, if the last recently used
-            // band is not that one, uncache it. We could use a smarter strategy
-            // based on a LRU, but that's a bit overkill for now.
-            poGDS->poLastUsedBand->UncacheData();
-            poGDS->nCachedBytes = 0;
-        }
-        else
-        {
-            // Once we have cached more than nCachedBytesThreshold bytes, we
-            // will switch to "one-band-at-a-time" strategy, instead of caching
-            // all bands that have been accessed.
-            if (poGDS->nCachedBytes > poGDS->nCachedBytesThreshold)
-            {
-                GUIntBig nMinCacheSize =
-                    1 + static_cast<GUIntBig>(poGDS->nRasterXSize) *
-                            poGDS->nRasterYSize * poGDS->nBands *
-                            GDALGetDataTypeSizeBytes(eDataType) / 1024 / 1024;
-                CPLDebug("GRIB",
-                         "Maximum band cache size reached for this dataset. "
-                         "Caching only one band at a time from now, which can "
-                         "negatively affect performance. Consider "
-                         "increasing GRIB_CACHEMAX to a higher value (in MB), "
-                         "at least " CPL_FRMT_GUIB " in that instance",
-                         nMinCacheSize);
-                for (int i = 0; i < poGDS->nBands; i++)
-                {
-                    reinterpret_cast<GRIBRasterBand *>(
-                        poGDS->GetRasterBand(i + 1))
-                        ->UncacheData();
-                }
-                poGDS->nCachedBytes = 0;
-                poGDS->bCacheOnlyOneBand = TRUE;
-            }
-        }
+    // we don't seem to have any way to detect errors in this!
+    if (m_Grib_MetaData != nullptr)
+    {
+        MetaFree(m_Grib_MetaData);
+        delete m_Grib_MetaData;
+        m_Grib_MetaData = nullptr;
+    }
+    double *padfData = nullptr;
+    grib_MetaData *psMetaData = nullptr;
+    ReadGribData(poGDS->fp, start, subgNum, &padfData, &psMetaData);
+    return SetDecodedData(padfData, psMetaData);
+}
+
+/************************************************************************/
+/*                          SetDecodedData()                            */
+/************************************************************************/
 
-        // we don't seem to have any way to detect errors in this!
+/** Install the result of ReadGribData() as the cached data of this band,
+ * taking ownership of padfData and psMetaData, and evicting the least
+ * recently used bands if GRIB_CACHEMAX would be exceeded.
+ */
+CPLErr GRIBRasterBand::SetDecodedData(double *padfData,
+                                      grib_MetaData *psMetaData)
+{
+    CPLAssert(m_Grib_Data == nullptr);
+
+    if (m_Grib_MetaData != nullptr)
+    {
+        MetaFree(m_Grib_MetaData);
+        delete m_Grib_MetaData;
+    }
+    m_Grib_MetaData = psMetaData;
+
+    if (!padfData)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
         if (m_Grib_MetaData != nullptr)
         {
             MetaFree(m_Grib_MetaData);
             delete m_Grib_MetaData;
             m_Grib_MetaData = nullptr;
         }
-        ReadGribData(poGDS->fp, start, subgNum, &m_Grib_Data, &m_Grib_MetaData);
-        if (!m_Grib_Data)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined, "Out of memory.");
-            if (m_Grib_MetaData != nullptr)
-            {
-                MetaFree(m_Grib_MetaData);
-                delete m_Grib_MetaData;
-                m_Grib_MetaData = nullptr;
-            }
-            return CE_Failure;
-        }
+        return CE_Failure;
+    }
 
-        // Check the band matches the dataset as a whole, size wise. (#3246)
-        nGribDataXSize = m_Grib_MetaData->gds.Nx;
-        nGribDataYSize = m_Grib_MetaData->gds.Ny;
-        if (nGribDataXSize <= 0 || nGribDataYSize <= 0)
+    // Check the band matches the dataset as a whole, size wise. (#3246)
+    nGribDataXSize = m_Grib_MetaData->gds.Nx;
+    nGribDataYSize = m_Grib_MetaData->gds.Ny;
+    if (nGribDataXSize <= 0 || nGribDataYSize <= 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Band %d of GRIB dataset is %dx%d.", nBand, nGribDataXSize,
+                 nGribDataYSize);
+        free(padfData);
+        MetaFree(m_Grib_MetaData);
+        delete m_Grib_MetaData;
+        m_Grib_MetaData = nullptr;
+        return CE_Failure;
+    }
+
+    // Evict least recently used bands until the new one fits in
+    // GRIB_CACHEMAX. The new band is cached even if it does not fit alone.
+    GRIBDataset *poGDS = static_cast<GRIBDataset *>(poDS);
+    const GIntBig nBytes =
+        static_cast<GIntBig>(nGribDataXSize) * nGribDataYSize * sizeof(double);
+    while (!poGDS->m_oLRUCachedBands.empty() &&
+           poGDS->nCachedBytes + nBytes > poGDS->nCachedBytesThreshold)
+    {
+        if (!poGDS->m_bCacheMaxReachedWarned)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Band %d of GRIB dataset is %dx%d.", nBand, nGribDataXSize,
-                     nGribDataYSize);
-            MetaFree(m_Grib_MetaData);
-            delete m_Grib_MetaData;
-            m_Grib_MetaData = nullptr;
-            return CE_Failure;
+            poGDS->m_bCacheMaxReachedWarned = true;
+            GUIntBig nMinCacheSize =
+                1 + static_cast<GUIntBig>(poGDS->nRasterXSize) *
+                        poGDS->nRasterYSize * poGDS->nBands *
+                        GDALGetDataTypeSizeBytes(eDataType) / 1024 / 1024;
+            CPLDebug("GRIB",
+                     "Maximum band cache size reached for this dataset. "
+                     "Evicting least recently used bands from now, which can "
+                     "negatively affect performance. Consider "
+                     "increasing GRIB_CACHEMAX to a higher value (in MB), "
+                     "at least " CPL_FRMT_GUIB " in that instance",
+                     nMinCacheSize);
         }
+        poGDS->m_oLRUCachedBands.back()->UncacheData();
+    }
 
-        poGDS->nCachedBytes += static_cast<GIntBig>(nGribDataXSize) *
-                               nGribDataYSize * sizeof(double);
-        poGDS->poLastUsedBand = this;
+    m_Grib_Data = padfData;
+    poGDS->m_oLRUCachedBands.push_front(this);
+    m_oLRUIter = poGDS->m_oLRUCachedBands.begin();
+    poGDS->nCachedBytes += nBytes;
 
-        if (nGribDataXSize != nRasterXSize || nGribDataYSize != nRasterYSize)
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Band %d of GRIB dataset is %dx%d, while the first band "
-                     "and dataset is %dx%d.  Georeferencing of band %d may "
-                     "be incorrect, and data access may be incomplete.",
-                     nBand, nGribDataXSize, nGribDataYSize, nRasterXSize,
-                     nRasterYSize, nBand);
-        }
+    if (nGribDataXSize != nRasterXSize || nGribDataYSize != nRasterYSize)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Band %d of GRIB dataset is %dx%d, while the first band "
+                 "and dataset is %dx%d.  Georeferencing of band %d may "
+                 "be incorrect, and data access may be incomplete.",
+                 nBand, nGribDataXSize, nGribDataYSize, nRasterXSize,
+                 nRasterYSize, nBand);
     }
 
     return CE_None;
@@ -1175,7 +1198,13 @@ void GRIBRasterBand::ReadGribData(VSILFILE *fp, vsi_l_offset start, int subgNum,
 void GRIBRasterBand::UncacheData()
 {
     if (m_Grib_Data)
+    {
+        GRIBDataset *poGDS = static_cast<GRIBDataset *>(poDS);
+        poGDS->m_oLRUCachedBands.erase(m_oLRUIter);
+        poGDS->nCachedBytes -= static_cast<GIntBig>(nGribDataXSize) *
+                               nGribDataYSize * sizeof(double);
         free(m_Grib_Data);
+    }
     m_Grib_Data = nullptr;
     if (m_Grib_MetaData)
     {
@@ -1345,12 +1374,12 @@ InventoryWrapperSidecar::~InventoryWrapperSidecar()
 
 GRIBDataset::GRIBDataset()
     : fp(nullptr), nCachedBytes(0),
-      // Switch caching strategy once 100 MB threshold is reached.
-      // Why 100 MB? --> Why not.
+      // Start evicting least recently used bands once 100 MB threshold is
+      // reached. Why 100 MB? --> Why not.
       nCachedBytesThreshold(static_cast<GIntBig>(atoi(
                                 CPLGetConfigOption("GRIB_CACHEMAX", "100"))) *
                             1024 * 1024),
-      bCacheOnlyOneBand(FALSE), nSplitAndSwapColumn(0), poLastUsedBand(nullptr)
+      nSplitAndSwapColumn(0)
 {
     adfGeoTransform[0] = 0.0;
     adfGeoTransform[1] = 1.0;
@@ -1368,6 +1397,9 @@ GRIBDataset::~GRIBDataset()
 
 {
     FlushCache(true);
+    // Bands are destroyed after m_oLRUCachedBands, so release their data now
+    while (!m_oLRUCachedBands.empty())
+        m_oLRUCachedBands.front()->UncacheData();
     if (fp != nullptr)
         VSIFCloseL(fp);
 }
@@ -1383,6 +1415,157 @@ CPLErr GRIBDataset::GetGeoTransform(double *padfTransform)
     return CE_None;
 }
 
+/************************************************************************/
+/*                       DecodeBandsInParallel()                        */
+/************************************************************************/
+
+/** Decode in worker threads the messages of the passed bands that are not
+ * cached yet, and install the result in the band cache.
+ *
+ * Bands whose decoding fails are left uncached, so that the error is
+ * reported by the regular LoadData() code path. Only the errors and warnings
+ * of the bands that are decoded successfully are replayed here.
+ */
+void GRIBDataset::DecodeBandsInParallel(int nBandCount, const int *panBandMap,
+                                        int nThreads)
+{
+    std::vector<GRIBRasterBand *> apoBands;
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        auto poBand =
+            cpl::down_cast<GRIBRasterBand *>(GetRasterBand(panBandMap[i]));
+        if (poBand->m_Grib_Data == nullptr &&
+            std::find(apoBands.begin(), apoBands.end(), poBand) ==
+                apoBands.end())
+        {
+            apoBands.push_back(poBand);
+        }
+    }
+    if (apoBands.size() < 2)
+        return;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return;
+    auto poQueue = poThreadPool->CreateJobQueue();
+
+    struct DecodedMessage
+    {
+        double *padfData = nullptr;
+        grib_MetaData *psMetaData = nullptr;
+        CPLErrorAccumulator oErrorAccumulator{};
+    };
+
+    std::vector<DecodedMessage> asDecoded(apoBands.size());
+    std::atomic<size_t> nNextIdx{0};
+    const std::string osFilename(GetDescription());
+    const int nJobs = std::min(nThreads, static_cast<int>(apoBands.size()));
+    for (int iJob = 0; iJob < nJobs; ++iJob)
+    {
+        poQueue->SubmitJob(
+            [&apoBands, &asDecoded, &nNextIdx, &osFilename]()
+            {
+                // Each job needs its own file handle.
+                VSILFILE *fpJob = VSIFOpenL(osFilename.c_str(), "rb");
+                if (!fpJob)
+                    return;
+                while (true)
+                {
+                    const size_t i = nNextIdx++;
+                    if (i >= apoBands.size())
+                        break;
+                    auto oAccumulator =
+                        asDecoded[i].oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    GRIBRasterBand::ReadGribData(
+                        fpJob, apoBands[i]->start, apoBands[i]->subgNum,
+                        &asDecoded[i].padfData, &asDecoded[i].psMetaData);
+                }
+                VSIFCloseL(fpJob);
+            });
+    }
+    poQueue->WaitCompletion();
+
+    for (size_t i = 0; i < apoBands.size(); ++i)
+    {
+        DecodedMessage &sDecoded = asDecoded[i];
+        if (sDecoded.padfData && sDecoded.psMetaData &&
+            sDecoded.psMetaData->gds.Nx > 0 && sDecoded.psMetaData->gds.Ny > 0)
+        {
+            sDecoded.oErrorAccumulator.ReplayErrors();
+            apoBands[i]->SetDecodedData(sDecoded.padfData,
+                                        sDecoded.psMetaData);
+        }
+        else
+        {
+            // Decoded again by LoadData(), which reports the errors.
+            free(sDecoded.padfData);
+            if (sDecoded.psMetaData)
+            {
+                MetaFree(sDecoded.psMetaData);
+                delete sDecoded.psMetaData;
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GRIBDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                              int nXSize, int nYSize, void *pData,
+                              int nBufXSize, int nBufYSize,
+                              GDALDataType eBufType, int nBandCount,
+                              BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                              GSpacing nLineSpace, GSpacing nBandSpace,
+                              GDALRasterIOExtraArg *psExtraArg)
+{
+    // When several bands are requested, decode their messages in parallel,
+    // by batches that fit in GRIB_CACHEMAX, before letting the default
+    // implementation read them from the band cache.
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = std::max(
+        1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads)));
+    const GIntBig nBandBytes = std::max<GIntBig>(
+        1, static_cast<GIntBig>(nRasterXSize) * nRasterYSize * sizeof(double));
+    const int nMaxBatchSize = static_cast<int>(std::min<GIntBig>(
+        nBandCount, nCachedBytesThreshold / nBandBytes));
+    if (eRWFlag != GF_Read || nThreads <= 1 || nMaxBatchSize < 2 ||
+        STARTS_WITH(GetDescription(), "/vsistdin/"))
+    {
+        return GDALPamDataset::IRasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+            nBufYSize, eBufType, nBandCount, panBandMap, nPixelSpace,
+            nLineSpace, nBandSpace, psExtraArg);
+    }
+
+    CPLErr eErr = CE_None;
+    for (int iStart = 0; eErr == CE_None && iStart < nBandCount;
+         iStart += nMaxBatchSize)
+    {
+        const int nBatchSize = std::min(nMaxBatchSize, nBandCount - iStart);
+        DecodeBandsInParallel(nBatchSize, panBandMap + iStart, nThreads);
+
+        GDALRasterIOExtraArg sExtraArg;
+        GDALCopyRasterIOExtraArg(&sExtraArg, psExtraArg);
+        sExtraArg.pfnProgress = GDALScaledProgress;
+        sExtraArg.pProgressData = GDALCreateScaledProgress(
+            static_cast<double>(iStart) / nBandCount,
+            static_cast<double>(iStart + nBatchSize) / nBandCount,
+            psExtraArg->pfnProgress, psExtraArg->pProgressData);
+        eErr = GDALPamDataset::IRasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize,
+            static_cast<GByte *>(pData) + iStart * nBandSpace, nBufXSize,
+            nBufYSize, eBufType, nBatchSize, panBandMap + iStart, nPixelSpace,
+            nLineSpace, nBandSpace, &sExtraArg);
+        GDALDestroyScaledProgress(sExtraArg.pProgressData);
+    }
+    return eErr;
+}
+
 /************************************************************************/
 /*                                Inventory()                           */
 /************************************************************************/
@@ -30,6 +30,7 @@
 #include <time.h>
 
 #include <algorithm>
+#include <list>
 #include <memory>
 #include <string>
 
@@ -90,6 +91,13 @@ class GRIBDataset final : public GDALPamDataset
         return m_poSRS.get();
     }
 
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
     std::shared_ptr<GDALGroup> GetRootGroup() const override
     {
         return m_poRootGroup;
@@ -99,6 +107,8 @@ class GRIBDataset final : public GDALPamDataset
     void SetGribMetaData(grib_MetaData *meta);
     static GDALDataset *OpenMultiDim(GDALOpenInfo *);
     std::unique_ptr<gdal::grib::InventoryWrapper> Inventory(GDALOpenInfo *);
+    void DecodeBandsInParallel(int nBandCount, const int *panBandMap,
+                               int nThreads);
 
     VSILFILE *fp;
     // Calculate and store once as GetGeoTransform may be called multiple times.
@@ -106,14 +116,18 @@ class GRIBDataset final : public GDALPamDataset
 
     GIntBig nCachedBytes;
     GIntBig nCachedBytesThreshold;
-    int bCacheOnlyOneBand;
+    bool m_bCacheMaxReachedWarned = false;
+
+    // Bands whose decoded data is cached, most recently used first. Once
+    // nCachedBytesThreshold is reached, the least recently used ones are
+    // evicted.
+    std::list<GRIBRasterBand *> m_oLRUCachedBands{};
 
     // Split&Swap: transparent rewrap around the prime meridian instead of the
     // antimeridian rows after nSplitAndSwapColumn are placed at the beginning
     // while rows before are placed at the end
     int nSplitAndSwapColumn;
 
-    GRIBRasterBand *poLastUsedBand;
     std::shared_ptr<GDALGroup> m_poRootGroup{};
     std::shared_ptr<OGRSpatialReference> m_poSRS{};
     std::unique_ptr<OGRSpatialReference> m_poLL{};
@@ -159,6 +173,7 @@ class GRIBRasterBand final : public GDALPamRasterBand
 
   private:
     CPLErr LoadData();
+    CPLErr SetDecodedData(double *padfData, grib_MetaData *psMetaData);
     void FindNoDataGrib2(bool bSeekToStart = true);
     void FindMetaData();
     // Heuristic search for the start of the message
@@ -170,6 +185,8 @@ class GRIBRasterBand final : public GDALPamRasterBand
 
     double *m_Grib_Data;
     grib_MetaData *m_Grib_MetaData;
+    // Position in GRIBDataset::m_oLRUCachedBands. Valid iff m_Grib_Data is set
+    std::list<GRIBRasterBand *>::iterator m_oLRUIter{};
 
     int nGribDataXSize;
     int nGribDataYSize;
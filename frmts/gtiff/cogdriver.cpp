@@ -55,13 +55,17 @@ static bool HasZSTDCompression()
 /*                           GetTmpFilename()                           */
 /************************************************************************/
 
-static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt)
+static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt,
+                                bool bInMemory = false)
 {
-    const bool bSupportsRandomWrite =
-        VSISupportsRandomWrite(pszFilename, false);
     CPLString osTmpFilename;
-    if (!bSupportsRandomWrite ||
-        CPLGetConfigOption("CPL_TMPDIR", nullptr) != nullptr)
+    if (bInMemory)
+    {
+        osTmpFilename = VSIMemGenerateHiddenFilename(
+            CPLGetBasenameSafe(pszFilename).c_str());
+    }
+    else if (!VSISupportsRandomWrite(pszFilename, false) ||
+             CPLGetConfigOption("CPL_TMPDIR", nullptr) != nullptr)
     {
         osTmpFilename = CPLGenerateTempFilenameSafe(
             CPLGetBasenameSafe(pszFilename).c_str());
@@ -74,6 +78,41 @@ static CPLString GetTmpFilename(const char *pszFilename, const char *pszExt)
     return osTmpFilename;
 }
 
+/************************************************************************/
+/*                       UseInMemoryTmpFile()                           */
+/************************************************************************/
+
+// Whether a temporary file, whose uncompressed size is estimated to be
+// dfUncompressedSize bytes, should be created in /vsimem/ rather than on disk,
+// according to the TEMPORARY_FILES creation option.
+static bool UseInMemoryTmpFile(const char *const *papszOptions,
+                               double dfUncompressedSize)
+{
+    const char *pszTmpFiles =
+        CSLFetchNameValueDef(papszOptions, "TEMPORARY_FILES", "DISK");
+    if (EQUAL(pszTmpFiles, "MEMORY"))
+        return true;
+    if (EQUAL(pszTmpFiles, "AUTO"))
+    {
+        const GIntBig nUsableRAM = CPLGetUsablePhysicalRAM();
+        const bool bRet =
+            nUsableRAM > 0 &&
+            dfUncompressedSize <= static_cast<double>(nUsableRAM) / 4;
+        CPLDebug("COG",
+                 "Temporary file of %.0f uncompressed bytes will be "
+                 "created %s",
+                 dfUncompressedSize, bRet ? "in memory" : "on disk");
+        return bRet;
+    }
+    if (!EQUAL(pszTmpFiles, "DISK"))
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "Invalid value for TEMPORARY_FILES: %s. Using DISK",
+                 pszTmpFiles);
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                             GetResampling()                          */
 /************************************************************************/
@@ -673,7 +712,12 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     CPLDebug("COG", "Reprojecting source dataset: start");
     GDALWarpAppOptionsSetProgress(psOptions, GDALScaledProgress,
                                   pScaledProgress);
-    CPLString osTmpFile(GetTmpFilename(pszDstFilename, "warped.tif.tmp"));
+    const double dfWarpedSize =
+        double(nXSize) * nYSize * (nBands + 1) *
+        GDALGetDataTypeSizeBytes(poFirstBand->GetRasterDataType());
+    CPLString osTmpFile(
+        GetTmpFilename(pszDstFilename, "warped.tif.tmp",
+                       UseInMemoryTmpFile(papszOptions, dfWarpedSize)));
     auto hSrcDS = GDALDataset::ToHandle(poSrcDS);
 
     std::unique_ptr<CPLConfigOptionSetter> poWarpThreadSetter;
@@ -1124,7 +1168,9 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     if (bGenerateMskOvr)
     {
         CPLDebug("COG", "Generating overviews of the mask: start");
-        m_osTmpMskOverviewFilename = GetTmpFilename(pszFilename, "msk.ovr.tmp");
+        m_osTmpMskOverviewFilename = GetTmpFilename(
+            pszFilename, "msk.ovr.tmp",
+            UseInMemoryTmpFile(papszOptions, double(nXSize) * nYSize / 3));
         GDALRasterBand *poSrcMask = poFirstBand->GetMaskBand();
         const char *pszResampling = CSLFetchNameValueDef(
             papszOptions, "OVERVIEW_RESAMPLING",
@@ -1154,7 +1200,12 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     if (bGenerateOvr)
     {
         CPLDebug("COG", "Generating overviews of the imagery: start");
-        m_osTmpOverviewFilename = GetTmpFilename(pszFilename, "ovr.tmp");
+        const double dfOvrSize =
+            double(nXSize) * nYSize * nBands / 3 *
+            GDALGetDataTypeSizeBytes(poFirstBand->GetRasterDataType());
+        m_osTmpOverviewFilename =
+            GetTmpFilename(pszFilename, "ovr.tmp",
+                           UseInMemoryTmpFile(papszOptions, dfOvrSize));
         std::vector<GDALRasterBand *> apoSrcBands;
         for (int i = 0; i < nBands; i++)
             apoSrcBands.push_back(poCurDS->GetRasterBand(i + 1));
@@ -1643,6 +1694,14 @@ void GDALCOGDriver::InitializeCreationOptionList()
         "       <Value>YES</Value>"
         "       <Value>NO</Value>"
         "   </Option>"
+        "   <Option name='TEMPORARY_FILES' type='string-select' "
+        "default='DISK' "
+        "description='Where to create the temporary files (reprojected "
+        "dataset, overviews)'>"
+        "       <Value>DISK</Value>"
+        "       <Value>MEMORY</Value>"
+        "       <Value>AUTO</Value>"
+        "   </Option>"
         "</CreationOptionList>";
 
     SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST, osOptions.c_str());
@@ -73,6 +73,10 @@ class HDF5ImageDataset final : public HDF5Dataset
     int m_nBlockXSize = 0;
     int m_nBlockYSize = 0;
     int m_nBandChunkSize = 1;  //! Number of bands in a chunk
+    //! Size in bytes of a chunk, or 0 if the dataset is not chunked
+    size_t m_nChunkSizeBytes = 0;
+    //! Size in bytes of the raw data chunk cache of dataset_id
+    size_t m_nChunkCacheSize = 0;
 
     enum WholeBandChunkOptim
     {
@@ -102,6 +106,8 @@ class HDF5ImageDataset final : public HDF5Dataset
     std::vector<GByte> m_abyBandChunk{};
 
     CPLErr CreateODIMH5Projection();
+    void AdjustChunkCacheSize(int nXOff, int nYOff, int nXSize, int nYSize,
+                              int nFirstBand, int nBandCount);
 
     CPL_DISALLOW_COPY_ASSIGN(HDF5ImageDataset)
 
@@ -396,6 +402,8 @@ CPLErr HDF5ImageRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
 
     HDF5_GLOBAL_LOCK();
 
+    poGDS->AdjustChunkCacheSize(nXOff, nYOff, nXSize, nYSize, nBand, 1);
+
     hsize_t count[3] = {0, 0, 0};
     H5OFFSET_TYPE offset[3] = {0, 0, 0};
     hsize_t col_dims[3] = {0, 0, 0};
@@ -702,6 +710,8 @@ CPLErr HDF5ImageRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     {
         HDF5_GLOBAL_LOCK();
 
+        poGDS->AdjustChunkCacheSize(nXOff, nYOff, nXSize, nYSize, nBand, 1);
+
         hsize_t count[3] = {1, static_cast<hsize_t>(nYSize),
                             static_cast<hsize_t>(nXSize)};
         H5OFFSET_TYPE offset[3] = {static_cast<H5OFFSET_TYPE>(nBand - 1),
@@ -782,6 +792,80 @@ CPLErr HDF5ImageRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                                         nPixelSpace, nLineSpace, psExtraArg);
 }
 
+/************************************************************************/
+/*                        AdjustChunkCacheSize()                        */
+/************************************************************************/
+
+/** Grow the raw data chunk cache of dataset_id so that it can hold all the
+ * chunks intersecting the passed window, for bands in the range
+ * [nFirstBand, nFirstBand + nBandCount - 1].
+ *
+ * With the default 1 MB cache of libhdf5, chunks larger than that, or
+ * windows spanning several chunks, are decompressed again each time they are
+ * accessed, which is very costly when reading a time series band after band
+ * from chunks that span several bands. The cache size is bounded by the
+ * HDF5_CHUNK_CACHE_MAX_SIZE configuration option (in MB).
+ *
+ * Must be called with the HDF5 global lock held.
+ */
+void HDF5ImageDataset::AdjustChunkCacheSize(int nXOff, int nYOff, int nXSize,
+                                            int nYSize, int nFirstBand,
+                                            int nBandCount)
+{
+    if (m_nChunkSizeBytes == 0 || nXSize <= 0 || nYSize <= 0 ||
+        nBandCount <= 0)
+        return;
+
+    const size_t nMaxCacheSize =
+        static_cast<size_t>(std::max(
+            0, atoi(CPLGetConfigOption("HDF5_CHUNK_CACHE_MAX_SIZE", "256")))) *
+        1024 * 1024;
+    if (m_nChunkCacheSize >= nMaxCacheSize ||
+        m_nChunkSizeBytes > nMaxCacheSize)
+        return;
+
+    const auto GetChunkCount = [](int nOff, int nSize, int nChunkSize)
+    {
+        return static_cast<size_t>((nOff + nSize - 1) / nChunkSize -
+                                   nOff / nChunkSize + 1);
+    };
+    size_t nChunkCount = GetChunkCount(nXOff, nXSize, m_nBlockXSize) *
+                         GetChunkCount(nYOff, nYSize, m_nBlockYSize);
+    if (ndims == 3)
+    {
+        nChunkCount *=
+            GetChunkCount(nFirstBand - 1, nBandCount, m_nBandChunkSize);
+    }
+    const size_t nNeededCacheSize =
+        std::min(nChunkCount, nMaxCacheSize / m_nChunkSizeBytes) *
+        m_nChunkSizeBytes;
+    if (nNeededCacheSize <= m_nChunkCacheSize)
+        return;
+
+    // The chunk cache parameters can only be set when opening the dataset.
+    const hid_t hDAPL = H5Pcreate(H5P_DATASET_ACCESS);
+    if (hDAPL < 0)
+        return;
+    // libhdf5 recommends a number of hash table slots of about 100 times
+    // the number of chunks that fit in the cache.
+    const size_t nSlots = std::max<size_t>(
+        521, 100 * (nNeededCacheSize / m_nChunkSizeBytes) + 1);
+    H5Pset_chunk_cache(hDAPL, nSlots, nNeededCacheSize,
+                       H5D_CHUNK_CACHE_W0_DEFAULT);
+    const hid_t hNewDatasetId =
+        H5Dopen2(m_hHDF5, poH5Objects->pszPath, hDAPL);
+    H5Pclose(hDAPL);
+    if (hNewDatasetId < 0)
+        return;
+
+    CPLDebug("HDF5", "Setting chunk cache size of %s to " CPL_FRMT_GUIB
+             " bytes",
+             poH5Objects->pszPath, static_cast<GUIntBig>(nNeededCacheSize));
+    H5Dclose(dataset_id);
+    dataset_id = hNewDatasetId;
+    m_nChunkCacheSize = nNeededCacheSize;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -826,6 +910,9 @@ CPLErr HDF5ImageDataset::IRasterIO(
     {
         HDF5_GLOBAL_LOCK();
 
+        AdjustChunkCacheSize(nXOff, nYOff, nXSize, nYSize, panBandMap[0],
+                             nBandCount);
+
         hsize_t count[3] = {static_cast<hsize_t>(nBandCount),
                             static_cast<hsize_t>(nYSize),
                             static_cast<hsize_t>(nXSize)};
@@ -875,6 +962,9 @@ CPLErr HDF5ImageDataset::IRasterIO(
     {
         HDF5_GLOBAL_LOCK();
 
+        AdjustChunkCacheSize(nXOff, nYOff, nXSize, nYSize, panBandMap[0],
+                             nBandCount);
+
         hsize_t count[3] = {static_cast<hsize_t>(nYSize),
                             static_cast<hsize_t>(nXSize),
                             static_cast<hsize_t>(nBandCount)};
@@ -1291,6 +1381,20 @@ GDALDataset *HDF5ImageDataset::Open(GDALOpenInfo *poOpenInfo)
             if (poDS->GetYIndex() >= 0)
                 poDS->m_nBlockYSize =
                     static_cast<int>(panChunkDims[poDS->GetYIndex()]);
+            poDS->m_nChunkSizeBytes = H5Tget_size(poDS->native);
+            for (int i = 0; i < poDS->ndims; ++i)
+                poDS->m_nChunkSizeBytes *= static_cast<size_t>(panChunkDims[i]);
+            const hid_t hDAPL = H5Dget_access_plist(poDS->dataset_id);
+            if (hDAPL > 0)
+            {
+                size_t nSlots = 0;
+                double dfW0 = 0;
+                if (H5Pget_chunk_cache(hDAPL, &nSlots,
+                                       &poDS->m_nChunkCacheSize, &dfW0) < 0)
+                    poDS->m_nChunkCacheSize = 0;
+                H5Pclose(hDAPL);
+            }
+
             if (nBands > 1)
             {
                 poDS->m_nBandChunkSize =
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <string>
+#include <vector>
 
 #include "gdalorienteddataset.h"
 
@@ -4868,6 +4869,241 @@ GDALDataset *JPGDataset::CreateCopyStage2(
     return poJPG_DS;
 }
 
+#if !defined(JPGDataset) && !defined(JPEG_LIB_MK1)
+
+/************************************************************************/
+/*                            DecodeImage()                             */
+/************************************************************************/
+
+/** Decode a 8-bit JPEG codestream held in memory, without going through
+ * a dataset. Grayscale images are returned as a single band, and other
+ * 3-component images are converted to RGB.
+ */
+bool JPGDataset::DecodeImage(const void *pSrc, size_t nSrcSize,
+                             CSLConstList papszOptions,
+                             GDALDecodedImage &sImage)
+{
+    const GByte *pabySrc = static_cast<const GByte *>(pSrc);
+    if (nSrcSize < 3 || pabySrc[0] != 0xFF || pabySrc[1] != 0xD8 ||
+        pabySrc[2] != 0xFF)
+    {
+        return false;
+    }
+
+    GDALJPEGUserData sUserData;
+    struct jpeg_decompress_struct sDInfo;
+    struct jpeg_error_mgr sJErr;
+    struct jpeg_progress_mgr sJProgress;
+    memset(&sDInfo, 0, sizeof(sDInfo));
+    memset(&sJProgress, 0, sizeof(sJProgress));
+    std::vector<GByte> abyScanline;
+
+    sDInfo.err = jpeg_std_error(&sJErr);
+    sJErr.error_exit = JPGDataset::ErrorExit;
+    sJErr.output_message = JPGDataset::OutputMessage;
+    sUserData.p_previous_emit_message = sJErr.emit_message;
+    sJErr.emit_message = JPGDataset::EmitMessage;
+    sDInfo.client_data = &sUserData;
+
+    if (setjmp(sUserData.setjmp_buffer))
+    {
+        jpeg_destroy_decompress(&sDInfo);
+        return false;
+    }
+
+    jpeg_create_decompress(&sDInfo);
+    SetMaxMemoryToUse(&sDInfo);
+    sJProgress.progress_monitor = JPGDataset::ProgressMonitor;
+    sDInfo.progress = &sJProgress;
+
+    jpeg_gdal_mem_src(&sDInfo, pabySrc, nSrcSize);
+    jpeg_read_header(&sDInfo, TRUE);
+
+    if (!GDALCheckDecodedImageSize(static_cast<int>(sDInfo.image_width),
+                                   static_cast<int>(sDInfo.image_height),
+                                   papszOptions))
+    {
+        jpeg_destroy_decompress(&sDInfo);
+        return false;
+    }
+    if (sDInfo.data_precision != 8)
+    {
+        // Probably a 12-bit JPEG: let the caller fall back to the dataset
+        // API.
+        jpeg_destroy_decompress(&sDInfo);
+        return false;
+    }
+    if (sDInfo.num_components == 1)
+    {
+        sDInfo.out_color_space = JCS_GRAYSCALE;
+    }
+    else if (sDInfo.num_components == 3)
+    {
+        sDInfo.out_color_space = JCS_RGB;
+    }
+    else
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "JPEG images with %d components are not supported by "
+                 "DecodeImage()",
+                 sDInfo.num_components);
+        jpeg_destroy_decompress(&sDInfo);
+        return false;
+    }
+
+    jpeg_start_decompress(&sDInfo);
+
+    const int nXSize = static_cast<int>(sDInfo.output_width);
+    const int nYSize = static_cast<int>(sDInfo.output_height);
+    const int nBands = sDInfo.output_components;
+    const size_t nBandSize = static_cast<size_t>(nXSize) * nYSize;
+    try
+    {
+        sImage.abyData.resize(nBandSize * nBands);
+        abyScanline.resize(static_cast<size_t>(nXSize) * nBands);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory when decoding JPEG image");
+        jpeg_destroy_decompress(&sDInfo);
+        return false;
+    }
+
+    void *apDstBands[3] = {nullptr, nullptr, nullptr};
+    for (int iY = 0; iY < nYSize; ++iY)
+    {
+        GByte *pabyRow =
+            nBands == 1
+                ? sImage.abyData.data() + static_cast<size_t>(iY) * nXSize
+                : abyScanline.data();
+        JSAMPLE *ppSamples = reinterpret_cast<JSAMPLE *>(pabyRow);
+        jpeg_read_scanlines(&sDInfo, &ppSamples, 1);
+        if (nBands > 1)
+        {
+            for (int iBand = 0; iBand < nBands; ++iBand)
+            {
+                apDstBands[iBand] = sImage.abyData.data() +
+                                    iBand * nBandSize +
+                                    static_cast<size_t>(iY) * nXSize;
+            }
+            GDALDeinterleave(pabyRow, GDT_Byte, nBands, apDstBands, GDT_Byte,
+                             nXSize);
+        }
+    }
+
+    jpeg_finish_decompress(&sDInfo);
+    jpeg_destroy_decompress(&sDInfo);
+
+    if (sUserData.bNonFatalErrorEncountered)
+        return false;
+
+    sImage.nXSize = nXSize;
+    sImage.nYSize = nYSize;
+    sImage.nBands = nBands;
+    sImage.eDT = GDT_Byte;
+    sImage.poColorTable.reset();
+    return true;
+}
+
+/************************************************************************/
+/*                            EncodeImage()                             */
+/************************************************************************/
+
+/** Encode a 1 (grayscale) or 3 (RGB) band Byte image as a baseline JPEG
+ * codestream in memory. The QUALITY option is honoured.
+ */
+bool JPGDataset::EncodeImage(int nXSize, int nYSize, int nBands,
+                             GDALDataType eDT, const void *const *papBandData,
+                             const GDALColorTable *poColorTable,
+                             CSLConstList papszOptions,
+                             std::vector<GByte> &abyOut)
+{
+    if (eDT != GDT_Byte || (nBands != 1 && nBands != 3) || poColorTable)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "JPEG EncodeImage() only supports 1 or 3 bands of type Byte, "
+                 "without color table");
+        return false;
+    }
+
+    const int nQuality =
+        atoi(CSLFetchNameValueDef(papszOptions, "QUALITY", "75"));
+    if (nQuality < 1 || nQuality > 100)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "QUALITY=%s is not a legal value in the range 1-100.",
+                 CSLFetchNameValue(papszOptions, "QUALITY"));
+        return false;
+    }
+
+    std::vector<GByte> abyScanline;
+    try
+    {
+        abyScanline.resize(static_cast<size_t>(nXSize) * nBands);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory when encoding JPEG image");
+        return false;
+    }
+    abyOut.clear();
+
+    GDALJPEGUserData sUserData;
+    struct jpeg_compress_struct sCInfo;
+    struct jpeg_error_mgr sJErr;
+    memset(&sCInfo, 0, sizeof(sCInfo));
+
+    sCInfo.err = jpeg_std_error(&sJErr);
+    sJErr.error_exit = JPGDataset::ErrorExit;
+    sJErr.output_message = JPGDataset::OutputMessage;
+    sUserData.p_previous_emit_message = sJErr.emit_message;
+    sJErr.emit_message = JPGDataset::EmitMessage;
+    sCInfo.client_data = &sUserData;
+
+    if (setjmp(sUserData.setjmp_buffer))
+    {
+        jpeg_destroy_compress(&sCInfo);
+        return false;
+    }
+
+    jpeg_create_compress(&sCInfo);
+    jpeg_gdal_mem_dest(&sCInfo, &abyOut);
+
+    sCInfo.image_width = nXSize;
+    sCInfo.image_height = nYSize;
+    sCInfo.input_components = nBands;
+    sCInfo.in_color_space = nBands == 3 ? JCS_RGB : JCS_GRAYSCALE;
+    jpeg_set_defaults(&sCInfo);
+    sCInfo.data_precision = 8;
+    sCInfo.optimize_coding = TRUE;
+    jpeg_set_quality(&sCInfo, nQuality, TRUE);
+
+    jpeg_start_compress(&sCInfo, TRUE);
+
+    for (int iY = 0; iY < nYSize; ++iY)
+    {
+        const size_t nSrcOffset = static_cast<size_t>(iY) * nXSize;
+        for (int iBand = 0; iBand < nBands; ++iBand)
+        {
+            GDALCopyWords(static_cast<const GByte *>(papBandData[iBand]) +
+                              nSrcOffset,
+                          GDT_Byte, 1, abyScanline.data() + iBand, GDT_Byte,
+                          nBands, nXSize);
+        }
+        JSAMPLE *ppSamples = reinterpret_cast<JSAMPLE *>(abyScanline.data());
+        jpeg_write_scanlines(&sCInfo, &ppSamples, 1);
+    }
+
+    jpeg_finish_compress(&sCInfo);
+    jpeg_destroy_compress(&sCInfo);
+
+    return !sUserData.bNonFatalErrorEncountered;
+}
+
+#endif  // !defined(JPGDataset) && !defined(JPEG_LIB_MK1)
+
 /************************************************************************/
 /*                         GDALRegister_JPEG()                          */
 /************************************************************************/
@@ -5008,6 +5244,10 @@ void GDALRegister_JPEG()
 
     poDriver->pfnOpen = JPGDatasetCommon::Open;
     poDriver->pfnCreateCopy = JPGDataset::CreateCopy;
+#if !defined(JPEG_LIB_MK1)
+    poDriver->pfnDecodeImage = JPGDataset::DecodeImage;
+    poDriver->pfnEncodeImage = JPGDataset::EncodeImage;
+#endif
 
     GetGDALDriverManager()->RegisterDriver(poDriver);
 }
@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -339,6 +340,17 @@ class JPGDataset final : public JPGDatasetCommon
         struct jpeg_error_mgr &sJErr, GByte *&pabyScanline);
     static void ErrorExit(j_common_ptr cinfo);
     static void OutputMessage(j_common_ptr cinfo);
+
+#if !defined(JPGDataset) && !defined(JPEG_LIB_MK1)
+    static bool DecodeImage(const void *pSrc, size_t nSrcSize,
+                            CSLConstList papszOptions,
+                            GDALDecodedImage &sImage);
+    static bool EncodeImage(int nXSize, int nYSize, int nBands,
+                            GDALDataType eDT, const void *const *papBandData,
+                            const GDALColorTable *poColorTable,
+                            CSLConstList papszOptions,
+                            std::vector<GByte> &abyOut);
+#endif
 };
 
 /************************************************************************/
@@ -15,6 +15,7 @@
 #include "vsidataio.h"
 
 #include <cstddef>
+#include <exception>
 
 CPL_C_START
 #include "jerror.h"
@@ -402,3 +403,155 @@ void jpeg_vsiio_dest(j_compress_ptr cinfo, VSILFILE *outfile)
     dest->pub.term_destination = term_destination;
     dest->outfile = outfile;
 }
+
+/* ==================================================================== */
+/*      In-memory source and destination managers                       */
+/* ==================================================================== */
+
+static void init_mem_source(CPL_UNUSED j_decompress_ptr cinfo)
+{
+    // No work necessary here.
+}
+
+// Called when the decoder wants more data than available: insert a fake EOI
+// marker after emitting a warning, as libjpeg's jdatasrc.c does.
+static boolean fill_mem_input_buffer(j_decompress_ptr cinfo)
+{
+    static const JOCTET abyEOI[2] = {static_cast<JOCTET>(0xFF),
+                                     static_cast<JOCTET>(JPEG_EOI)};
+
+    cinfo->err->msg_code = JWRN_JPEG_EOF;
+    (*cinfo->err->emit_message)(reinterpret_cast<j_common_ptr>(cinfo), -1);
+
+    cinfo->src->next_input_byte = abyEOI;
+    cinfo->src->bytes_in_buffer = 2;
+
+    return TRUE;
+}
+
+static void skip_mem_input_data(j_decompress_ptr cinfo, long num_bytes)
+{
+    if (num_bytes > 0)
+    {
+        if (static_cast<size_t>(num_bytes) > cinfo->src->bytes_in_buffer)
+        {
+            (void)fill_mem_input_buffer(cinfo);
+        }
+        else
+        {
+            cinfo->src->next_input_byte += static_cast<size_t>(num_bytes);
+            cinfo->src->bytes_in_buffer -= static_cast<size_t>(num_bytes);
+        }
+    }
+}
+
+// Prepare for input from a memory buffer, which must remain valid during the
+// whole decompression.
+
+void jpeg_gdal_mem_src(j_decompress_ptr cinfo, const GByte *pabyData,
+                       size_t nSize)
+{
+    if (cinfo->src == nullptr)
+    {
+        cinfo->src =
+            static_cast<struct jpeg_source_mgr *>((*cinfo->mem->alloc_small)(
+                reinterpret_cast<j_common_ptr>(cinfo), JPOOL_PERMANENT,
+                sizeof(struct jpeg_source_mgr)));
+    }
+
+    cinfo->src->init_source = init_mem_source;
+    cinfo->src->fill_input_buffer = fill_mem_input_buffer;
+    cinfo->src->skip_input_data = skip_mem_input_data;
+    cinfo->src->resync_to_restart = jpeg_resync_to_restart;  // Default method.
+    cinfo->src->term_source = term_source;
+    cinfo->src->bytes_in_buffer = nSize;
+    cinfo->src->next_input_byte = pabyData;
+}
+
+namespace
+{
+typedef struct
+{
+    struct jpeg_destination_mgr pub;  // Public fields.
+
+    std::vector<GByte> *out;  // Target buffer.
+    JOCTET *buffer;           // Start of buffer.
+} my_mem_destination_mgr;
+}  // namespace
+
+typedef my_mem_destination_mgr *my_mem_dest_ptr;
+
+static void init_mem_destination(j_compress_ptr cinfo)
+{
+    my_mem_dest_ptr dest = reinterpret_cast<my_mem_dest_ptr>(cinfo->dest);
+
+    dest->buffer = static_cast<JOCTET *>((*cinfo->mem->alloc_small)(
+        reinterpret_cast<j_common_ptr>(cinfo), JPOOL_IMAGE,
+        OUTPUT_BUF_SIZE * sizeof(JOCTET)));
+
+    dest->pub.next_output_byte = dest->buffer;
+    dest->pub.free_in_buffer = OUTPUT_BUF_SIZE;
+}
+
+static bool append_to_mem_destination(my_mem_dest_ptr dest, size_t nBytes)
+{
+    try
+    {
+        dest->out->insert(dest->out->end(), dest->buffer,
+                          dest->buffer + nBytes);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    return true;
+}
+
+static boolean empty_mem_output_buffer(j_compress_ptr cinfo)
+{
+    my_mem_dest_ptr dest = reinterpret_cast<my_mem_dest_ptr>(cinfo->dest);
+
+    if (!append_to_mem_destination(dest, OUTPUT_BUF_SIZE))
+    {
+        cinfo->err->msg_code = JERR_OUT_OF_MEMORY;
+        cinfo->err->error_exit(reinterpret_cast<j_common_ptr>(cinfo));
+        return FALSE;  // will never reach that point
+    }
+
+    dest->pub.next_output_byte = dest->buffer;
+    dest->pub.free_in_buffer = OUTPUT_BUF_SIZE;
+
+    return TRUE;
+}
+
+static void term_mem_destination(j_compress_ptr cinfo)
+{
+    my_mem_dest_ptr dest = reinterpret_cast<my_mem_dest_ptr>(cinfo->dest);
+
+    if (!append_to_mem_destination(dest,
+                                   OUTPUT_BUF_SIZE - dest->pub.free_in_buffer))
+    {
+        cinfo->err->msg_code = JERR_OUT_OF_MEMORY;
+        cinfo->err->error_exit(reinterpret_cast<j_common_ptr>(cinfo));
+    }
+}
+
+// Prepare for output to a memory buffer, to which the compressed image is
+// appended.
+
+void jpeg_gdal_mem_dest(j_compress_ptr cinfo, std::vector<GByte> *pabyOut)
+{
+    if (cinfo->dest == nullptr)
+    {
+        cinfo->dest = static_cast<struct jpeg_destination_mgr *>(
+            (*cinfo->mem->alloc_small)(reinterpret_cast<j_common_ptr>(cinfo),
+                                       JPOOL_PERMANENT,
+                                       sizeof(my_mem_destination_mgr)));
+    }
+
+    my_mem_dest_ptr dest = reinterpret_cast<my_mem_dest_ptr>(cinfo->dest);
+    dest->pub.init_destination = init_mem_destination;
+    dest->pub.empty_output_buffer = empty_mem_output_buffer;
+    dest->pub.term_destination = term_mem_destination;
+    dest->out = pabyOut;
+}
@@ -16,6 +16,8 @@
 
 #include "cpl_vsi.h"
 
+#include <vector>
+
 CPL_C_START
 #ifdef LIBJPEG_12_PATH
 #include LIBJPEG_12_PATH
@@ -27,4 +29,8 @@ CPL_C_END
 void jpeg_vsiio_src(j_decompress_ptr cinfo, VSILFILE *infile);
 void jpeg_vsiio_dest(j_compress_ptr cinfo, VSILFILE *outfile);
 
+void jpeg_gdal_mem_src(j_decompress_ptr cinfo, const GByte *pabyData,
+                       size_t nSize);
+void jpeg_gdal_mem_dest(j_compress_ptr cinfo, std::vector<GByte> *pabyOut);
+
 #endif  // VSIDATAIO_H_INCLUDED
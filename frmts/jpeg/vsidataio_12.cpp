@@ -22,6 +22,10 @@
 #define my_src_ptr my_src_ptr_12
 #define my_destination_mgr my_destination_mgr_12
 #define my_dest_ptr my_dest_ptr_12
+#define jpeg_gdal_mem_src jpeg_gdal_mem_src_12
+#define jpeg_gdal_mem_dest jpeg_gdal_mem_dest_12
+#define my_mem_destination_mgr my_mem_destination_mgr_12
+#define my_mem_dest_ptr my_mem_dest_ptr_12
 
 #include "vsidataio.cpp"
 
@@ -119,6 +119,13 @@ class MBTilesDataset final : public GDALPamDataset,
                                    void *pProgressData,
                                    CSLConstList papszOptions) override;
 
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
     virtual int GetLayerCount() override
     {
         return static_cast<int>(m_apoLayers.size());
@@ -1007,6 +1014,27 @@ CPLErr MBTilesDataset::IFlushCacheWithErrCode(bool bAtClosing)
     return eErr;
 }
 
+/************************************************************************/
+/*                            IRasterIO()                               */
+/************************************************************************/
+
+CPLErr MBTilesDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                 int nXSize, int nYSize, void *pData,
+                                 int nBufXSize, int nBufYSize,
+                                 GDALDataType eBufType, int nBandCount,
+                                 BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                                 GSpacing nLineSpace, GSpacing nBandSpace,
+                                 GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize)
+        PrefetchTiles(nXOff, nYOff, nXSize, nYSize);
+
+    return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nBandCount, panBandMap, nPixelSpace,
+                                     nLineSpace, nBandSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                         ICanIWriteBlock()                            */
 /************************************************************************/
@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <typeinfo>
 #include <vector>
 
 #include "cpl_config.h"
@@ -211,6 +212,30 @@ CPLErr MEMRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 {
     if (nXSize != nBufXSize || nYSize != nBufYSize)
     {
+        // Nearest neighbour subsampling is done directly from the memory
+        // buffer, without going through the block cache, so that it can be
+        // safely used by concurrent readers. Overviews, if any, are still
+        // preferred when downsampling.
+        if (eRWFlag == GF_Read &&
+            psExtraArg->eResampleAlg == GRIORA_NearestNeighbour &&
+            !HasDirtyBlocks())
+        {
+            if ((nBufXSize < nXSize || nBufYSize < nYSize) &&
+                GetOverviewCount() > 0)
+            {
+                int bTried = FALSE;
+                const CPLErr eErr = TryOverviewRasterIO(
+                    eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                    nBufYSize, eBufType, nPixelSpaceBuf, nLineSpaceBuf,
+                    psExtraArg, &bTried);
+                if (bTried)
+                    return eErr;
+            }
+            return IReadSubsampledNearest(nXOff, nYOff, nXSize, nYSize, pData,
+                                          nBufXSize, nBufYSize, eBufType,
+                                          nPixelSpaceBuf, nLineSpaceBuf,
+                                          psExtraArg);
+        }
         return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
                                          pData, nBufXSize, nBufYSize, eBufType,
                                          static_cast<int>(nPixelSpaceBuf),
@@ -218,7 +243,10 @@ CPLErr MEMRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     }
 
     // In case block based I/O has been done before.
-    FlushCache(false);
+    // When reading, this is only needed if there are dirty blocks, which
+    // avoids touching the block cache in the read-only case.
+    if (eRWFlag == GF_Write || HasDirtyBlocks())
+        FlushCache(false);
 
     if (eRWFlag == GF_Read)
     {
@@ -251,6 +279,143 @@ CPLErr MEMRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     return CE_None;
 }
 
+/************************************************************************/
+/*                       IReadSubsampledNearest()                       */
+/************************************************************************/
+
+/** Nearest neighbour resampled read, directly from the memory buffer.
+ *
+ * This follows exactly the pixel selection logic of the generic
+ * GDALRasterBand::IRasterIO() implementation, but does not use the block
+ * cache, and is thus safe to call from several threads.
+ */
+CPLErr MEMRasterBand::IReadSubsampledNearest(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData, int nBufXSize,
+    int nBufYSize, GDALDataType eBufType, GSpacing nPixelSpaceBuf,
+    GSpacing nLineSpaceBuf, GDALRasterIOExtraArg *psExtraArg)
+{
+    double dfXOff = nXOff;
+    double dfYOff = nYOff;
+    double dfXSize = nXSize;
+    double dfYSize = nYSize;
+    if (psExtraArg->bFloatingPointWindowValidity)
+    {
+        dfXOff = psExtraArg->dfXOff;
+        dfYOff = psExtraArg->dfYOff;
+        dfXSize = psExtraArg->dfXSize;
+        dfYSize = psExtraArg->dfYSize;
+    }
+    const bool bUseIntegerRequestCoords =
+        (!psExtraArg->bFloatingPointWindowValidity ||
+         (nXOff == psExtraArg->dfXOff && nYOff == psExtraArg->dfYOff &&
+          nXSize == psExtraArg->dfXSize && nYSize == psExtraArg->dfYSize));
+
+    const double dfSrcXInc = dfXSize / static_cast<double>(nBufXSize);
+    const double dfSrcYInc = dfYSize / static_cast<double>(nBufYSize);
+    // Add small epsilon to avoid some numeric precision issues.
+    constexpr double EPS = 1e-10;
+    const double dfSrcXStart = 0.5 * dfSrcXInc + dfXOff + EPS;
+
+    // Compute the source column of each buffer column once.
+    std::vector<int> anSrcX;
+    try
+    {
+        anSrcX.resize(nBufXSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in IReadSubsampledNearest()");
+        return CE_Failure;
+    }
+    if (bUseIntegerRequestCoords && static_cast<int>(dfSrcXInc) == dfSrcXInc)
+    {
+        const int nSrcXInc = static_cast<int>(dfSrcXInc);
+        int iSrcX = static_cast<int>(dfSrcXStart);
+        for (int iBufXOff = 0; iBufXOff < nBufXSize; ++iBufXOff)
+        {
+            anSrcX[iBufXOff] = std::min(iSrcX, nRasterXSize - 1);
+            iSrcX += nSrcXInc;
+        }
+    }
+    else
+    {
+        double dfSrcX = dfSrcXStart;
+        for (int iBufXOff = 0; iBufXOff < nBufXSize;
+             ++iBufXOff, dfSrcX += dfSrcXInc)
+        {
+            anSrcX[iBufXOff] = static_cast<int>(
+                std::min(std::max(0.0, dfSrcX),
+                         static_cast<double>(nRasterXSize - 1)));
+        }
+    }
+
+    // Check if the source columns are evenly spaced, in which case a single
+    // GDALCopyWords() call per line can be used.
+    GSpacing nSrcXStride = nPixelOffset;
+    bool bRegularX = true;
+    if (nBufXSize > 1)
+    {
+        nSrcXStride = (anSrcX[1] - anSrcX[0]) * nPixelOffset;
+        for (int iBufXOff = 2; bRegularX && iBufXOff < nBufXSize; ++iBufXOff)
+        {
+            bRegularX = (anSrcX[iBufXOff] - anSrcX[iBufXOff - 1]) *
+                            nPixelOffset ==
+                        nSrcXStride;
+        }
+    }
+    bRegularX = bRegularX && nSrcXStride >= INT_MIN &&
+                nSrcXStride <= INT_MAX && nPixelSpaceBuf >= INT_MIN &&
+                nPixelSpaceBuf <= INT_MAX;
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    for (int iBufYOff = 0; iBufYOff < nBufYSize; ++iBufYOff)
+    {
+        const double dfSrcY = (iBufYOff + 0.5) * dfSrcYInc + dfYOff + EPS;
+        const int iSrcY = static_cast<int>(std::min(
+            std::max(0.0, dfSrcY), static_cast<double>(nRasterYSize - 1)));
+        const GByte *pabySrcLine =
+            pabyData + nLineOffset * static_cast<GPtrDiff_t>(iSrcY);
+        GByte *pabyDstLine = static_cast<GByte *>(pData) +
+                             nLineSpaceBuf * static_cast<GPtrDiff_t>(iBufYOff);
+
+        if (bRegularX)
+        {
+            GDALCopyWords64(pabySrcLine + anSrcX[0] * nPixelOffset, eDataType,
+                            static_cast<int>(nSrcXStride), pabyDstLine,
+                            eBufType, static_cast<int>(nPixelSpaceBuf),
+                            nBufXSize);
+        }
+        else if (eDataType == eBufType)
+        {
+            for (int iBufXOff = 0; iBufXOff < nBufXSize; ++iBufXOff)
+            {
+                memcpy(pabyDstLine + iBufXOff * nPixelSpaceBuf,
+                       pabySrcLine + anSrcX[iBufXOff] * nPixelOffset, nDTSize);
+            }
+        }
+        else
+        {
+            for (int iBufXOff = 0; iBufXOff < nBufXSize; ++iBufXOff)
+            {
+                GDALCopyWords64(pabySrcLine + anSrcX[iBufXOff] * nPixelOffset,
+                                eDataType, 0,
+                                pabyDstLine + iBufXOff * nPixelSpaceBuf,
+                                eBufType, 0, 1);
+            }
+        }
+
+        if (psExtraArg->pfnProgress != nullptr &&
+            !psExtraArg->pfnProgress(1.0 * (iBufYOff + 1) / nBufYSize, "",
+                                     psExtraArg->pProgressData))
+        {
+            return CE_Failure;
+        }
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -339,7 +504,19 @@ CPLErr MEMDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
         if (IsPixelInterleaveDataset())
         {
-            FlushCache(false);
+            const auto HasDirtyBlocks = [this]()
+            {
+                for (int i = 0; i < nBands; ++i)
+                {
+                    if (cpl::down_cast<MEMRasterBand *>(papoBands[i])
+                            ->HasDirtyBlocks())
+                        return true;
+                }
+                return false;
+            };
+            // In case block based I/O has been done before.
+            if (eRWFlag == GF_Write || HasDirtyBlocks())
+                FlushCache(false);
             const auto poFirstBand =
                 cpl::down_cast<MEMRasterBand *>(papoBands[0]);
             const GDALDataType eDT = poFirstBand->GetRasterDataType();
@@ -471,6 +648,7 @@ GDALRasterBand *MEMRasterBand::GetOverview(int i)
 
 CPLErr MEMRasterBand::CreateMaskBand(int nFlagsIn)
 {
+    std::lock_guard oLock(m_oMaskMutex);
     InvalidateMaskBand();
 
     MEMDataset *poMemDS = dynamic_cast<MEMDataset *>(poDS);
@@ -507,6 +685,26 @@ CPLErr MEMRasterBand::CreateMaskBand(int nFlagsIn)
     return CE_None;
 }
 
+/************************************************************************/
+/*                            GetMaskBand()                             */
+/************************************************************************/
+
+GDALRasterBand *MEMRasterBand::GetMaskBand()
+{
+    std::lock_guard oLock(m_oMaskMutex);
+    return GDALPamRasterBand::GetMaskBand();
+}
+
+/************************************************************************/
+/*                            GetMaskFlags()                            */
+/************************************************************************/
+
+int MEMRasterBand::GetMaskFlags()
+{
+    std::lock_guard oLock(m_oMaskMutex);
+    return GDALPamRasterBand::GetMaskFlags();
+}
+
 /************************************************************************/
 /*                            IsMaskBand()                              */
 /************************************************************************/
@@ -1043,6 +1241,34 @@ CPLErr MEMDataset::CreateMaskBand(int nFlagsIn)
     return poFirstBand->CreateMaskBand(nFlagsIn | GMF_PER_DATASET);
 }
 
+/************************************************************************/
+/*                           IsThreadSafe()                             */
+/************************************************************************/
+
+/** Implements GDALDataset::IsThreadSafe()
+ *
+ * Read-only raster operations on a MEM dataset never modify shared state
+ * (pixel data is read directly from the memory buffers, without using the
+ * block cache), so a dataset opened in read-only mode can be used
+ * concurrently from several threads. Writable datasets (in particular the
+ * ones returned by Create()) are not, since GDALDataset::EnterReadWrite()
+ * relies on this method to decide whether to take the read/write mutex.
+ */
+bool MEMDataset::IsThreadSafe(int nScopeFlags) const
+{
+    if (nScopeFlags == GDAL_OF_RASTER && eAccess == GA_ReadOnly &&
+        typeid(*this) == typeid(MEMDataset))
+    {
+        for (int i = 0; i < nBands; ++i)
+        {
+            if (typeid(*(papoBands[i])) != typeid(MEMRasterBand))
+                return false;
+        }
+        return true;
+    }
+    return GDALDataset::IsThreadSafe(nScopeFlags);
+}
+
 /************************************************************************/
 /*                           CanBeCloned()                              */
 /************************************************************************/
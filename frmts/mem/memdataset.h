@@ -20,6 +20,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 CPL_C_START
 /* Caution: if changing this prototype, also change in
@@ -116,6 +117,8 @@ class CPL_DLL MEMDataset CPL_NON_FINAL : public GDALDataset
 
     virtual CPLErr CreateMaskBand(int nFlagsIn) override;
 
+    bool IsThreadSafe(int nScopeFlags) const override;
+
     std::shared_ptr<GDALGroup> GetRootGroup() const override;
 
     void AddMEMBand(GDALRasterBandH hMEMBand);
@@ -182,6 +185,17 @@ class CPL_DLL MEMRasterBand CPL_NON_FINAL : public GDALPamRasterBand
 
     bool m_bIsMask = false;
 
+    // Protects the lazy instantiation of the mask band, so that concurrent
+    // readers can be served by IsThreadSafe() datasets.
+    std::recursive_mutex m_oMaskMutex{};
+
+    CPLErr IReadSubsampledNearest(int nXOff, int nYOff, int nXSize, int nYSize,
+                                  void *pData, int nBufXSize, int nBufYSize,
+                                  GDALDataType eBufType,
+                                  GSpacing nPixelSpaceBuf,
+                                  GSpacing nLineSpaceBuf,
+                                  GDALRasterIOExtraArg *psExtraArg);
+
     MEMRasterBand(GByte *pabyDataIn, GDALDataType eTypeIn, int nXSizeIn,
                   int nYSizeIn, bool bOwnDataIn);
 
@@ -204,6 +218,8 @@ class CPL_DLL MEMRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     virtual GDALRasterBand *GetOverview(int) override;
 
     virtual CPLErr CreateMaskBand(int nFlagsIn) override;
+    virtual GDALRasterBand *GetMaskBand() override;
+    virtual int GetMaskFlags() override;
     virtual bool IsMaskBand() const override;
 
     // Allow access to MEM driver's private internal memory buffer.
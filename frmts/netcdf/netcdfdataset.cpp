@@ -213,6 +213,11 @@ class netCDFRasterBand final : public GDALPamRasterBand
     bool bSignedData;
     bool bCheckLongitude;
     bool m_bCreateMetadataFromOtherVarsDone = false;
+    //! Dimensions of netCDF-4 chunks along X and Y, and size in bytes of a
+    //! chunk. 0 if the variable is not chunked.
+    int m_nChunkXSize = 0;
+    int m_nChunkYSize = 0;
+    size_t m_nChunkSizeBytes = 0;
 
     void CreateMetadataFromAttributes();
     void CreateMetadataFromOtherVars();
@@ -226,6 +231,7 @@ class netCDFRasterBand final : public GDALPamRasterBand
     void SetBlockSize();
 
     bool FetchNetcdfChunk(size_t xstart, size_t ystart, void *pImage);
+    void AdjustChunkCacheSize(int nXOff, int nYOff, int nXSize, int nYSize);
 
     void SetNoDataValueNoUpdate(double dfNoData);
     void SetNoDataValueNoUpdate(int64_t nNoData);
@@ -275,6 +281,11 @@ class netCDFRasterBand final : public GDALPamRasterBand
     virtual CPLErr SetUnitType(const char *) override;
     virtual CPLErr IReadBlock(int, int, void *) override;
     virtual CPLErr IWriteBlock(int, int, void *) override;
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
 
     char **GetMetadata(const char *pszDomain = "") override;
     const char *GetMetadataItem(const char *pszName,
@@ -838,6 +849,12 @@ void netCDFRasterBand::SetBlockSize()
                 nBlockYSize = (int)chunksize[nZDim - 2];
             else
                 nBlockYSize = 1;
+
+            m_nChunkXSize = nBlockXSize;
+            m_nChunkYSize = nBlockYSize;
+            m_nChunkSizeBytes = GDALGetDataTypeSizeBytes(eDataType);
+            for (int i = 0; i < nZDim; ++i)
+                m_nChunkSizeBytes *= chunksize[i];
         }
     }
 
@@ -2508,6 +2525,99 @@ bool netCDFRasterBand::FetchNetcdfChunk(size_t xstart, size_t ystart,
     return true;
 }
 
+/************************************************************************/
+/*                        AdjustChunkCacheSize()                        */
+/************************************************************************/
+
+/** Grow the netCDF-4 raw data chunk cache of the variable so that it can
+ * hold all the chunks intersecting the passed window (in GDAL space).
+ *
+ * With the default chunk cache of netCDF-C, chunks larger than it, or
+ * windows spanning several chunks, are decompressed again each time they are
+ * accessed, which is very costly when reading a time series band after band
+ * from chunks that span several bands. The cache size is bounded by the
+ * GDAL_NETCDF_CHUNK_CACHE_MAX_SIZE configuration option (in MB).
+ *
+ * Must be called with hNCMutex held.
+ */
+void netCDFRasterBand::AdjustChunkCacheSize(int nXOff, int nYOff, int nXSize,
+                                            int nYSize)
+{
+    if (m_nChunkSizeBytes == 0 || nXSize <= 0 || nYSize <= 0)
+        return;
+
+    const size_t nMaxCacheSize =
+        static_cast<size_t>(std::max(
+            0, atoi(CPLGetConfigOption("GDAL_NETCDF_CHUNK_CACHE_MAX_SIZE",
+                                       "256")))) *
+        1024 * 1024;
+    if (m_nChunkSizeBytes > nMaxCacheSize)
+        return;
+
+    size_t nCurCacheSize = 0;
+    size_t nSlots = 0;
+    float fPreemption = 0.0f;
+    if (nc_get_var_chunk_cache(cdfid, nZId, &nCurCacheSize, &nSlots,
+                               &fPreemption) != NC_NOERR ||
+        nCurCacheSize >= nMaxCacheSize)
+    {
+        return;
+    }
+
+    // Convert to netCDF space
+    auto poGDS = static_cast<netCDFDataset *>(poDS);
+    if (nBandYPos >= 0 && poGDS->bBottomUp)
+        nYOff = nRasterYSize - nYOff - nYSize;
+
+    const auto GetChunkCount = [](int nOff, int nSize, int nChunkSize)
+    {
+        return static_cast<size_t>((nOff + nSize - 1) / nChunkSize -
+                                   nOff / nChunkSize + 1);
+    };
+    const size_t nChunkCount = GetChunkCount(nXOff, nXSize, m_nChunkXSize) *
+                               GetChunkCount(nYOff, nYSize, m_nChunkYSize);
+    const size_t nNeededCacheSize =
+        std::min(nChunkCount, nMaxCacheSize / m_nChunkSizeBytes) *
+        m_nChunkSizeBytes;
+    if (nNeededCacheSize <= nCurCacheSize)
+        return;
+
+    CPLDebug("GDAL_netCDF", "Setting chunk cache size to " CPL_FRMT_GUIB
+             " bytes",
+             static_cast<GUIntBig>(nNeededCacheSize));
+    // netCDF-C recommends a number of hash table slots that is larger than
+    // the number of chunks that fit in the cache.
+    nSlots = std::max(nSlots, 100 * (nNeededCacheSize / m_nChunkSizeBytes) + 1);
+    NCDF_ERR(nc_set_var_chunk_cache(cdfid, nZId, nNeededCacheSize, nSlots,
+                                    fPreemption));
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr netCDFRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                   int nXSize, int nYSize, void *pData,
+                                   int nBufXSize, int nBufYSize,
+                                   GDALDataType eBufType,
+                                   GSpacing nPixelSpace, GSpacing nLineSpace,
+                                   GDALRasterIOExtraArg *psExtraArg)
+{
+    // Blocks match netCDF chunks, so the default block based implementation
+    // issues one request per chunk. Make sure that the chunks of the whole
+    // window can stay in the chunk cache, so that each chunk is decompressed
+    // only once even if it spans several bands or GDAL blocks.
+    if (eRWFlag == GF_Read && m_nChunkSizeBytes != 0)
+    {
+        CPLMutexHolderD(&hNCMutex);
+        AdjustChunkCacheSize(nXOff, nYOff, nXSize, nYSize);
+    }
+
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                             IReadBlock()                             */
 /************************************************************************/
@@ -2518,6 +2628,15 @@ CPLErr netCDFRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
 {
     CPLMutexHolderD(&hNCMutex);
 
+    if (m_nChunkSizeBytes != 0)
+    {
+        const int nXOff = nBlockXOff * nBlockXSize;
+        const int nYOff = nBlockYOff * nBlockYSize;
+        AdjustChunkCacheSize(nXOff, nYOff,
+                             std::min(nBlockXSize, nRasterXSize - nXOff),
+                             std::min(nBlockYSize, nRasterYSize - nYOff));
+    }
+
     // Locate X, Y and Z position in the array.
 
     size_t xstart = static_cast<size_t>(nBlockXOff) * nBlockXSize;
@@ -2849,6 +2849,345 @@ static void png_gdal_warning(CPL_UNUSED png_structp png_ptr,
     CPLError(CE_Warning, CPLE_AppDefined, "libpng: %s", error_message);
 }
 
+/************************************************************************/
+/*                         png_mem_read_data()                          */
+/************************************************************************/
+
+namespace
+{
+struct PNGMemReadContext
+{
+    const GByte *pabyData = nullptr;
+    size_t nSize = 0;
+    size_t nOffset = 0;
+};
+}  // namespace
+
+static void png_mem_read_data(png_structp png_ptr, png_bytep data,
+                              png_size_t length)
+{
+    auto psContext =
+        static_cast<PNGMemReadContext *>(png_get_io_ptr(png_ptr));
+    if (length > psContext->nSize - psContext->nOffset)
+        png_error(png_ptr, "Read Error");
+    memcpy(data, psContext->pabyData + psContext->nOffset, length);
+    psContext->nOffset += length;
+}
+
+/************************************************************************/
+/*                         png_mem_write_data()                         */
+/************************************************************************/
+
+static void png_mem_write_data(png_structp png_ptr, png_bytep data,
+                               png_size_t length)
+{
+    auto pabyOut = static_cast<std::vector<GByte> *>(png_get_io_ptr(png_ptr));
+    bool bOK = true;
+    try
+    {
+        pabyOut->insert(pabyOut->end(), data, data + length);
+    }
+    catch (const std::exception &)
+    {
+        bOK = false;
+    }
+    if (!bOK)
+        png_error(png_ptr, "Write Error");
+}
+
+static void png_mem_flush(png_structp)
+{
+}
+
+/************************************************************************/
+/*                       safe_png_read_header()                         */
+/************************************************************************/
+
+static bool safe_png_read_header(png_structp hPNG, png_infop psPNGInfo,
+                                 jmp_buf sSetJmpContext)
+{
+    if (setjmp(sSetJmpContext) != 0)
+        return false;
+    png_read_info(hPNG, psPNGInfo);
+    if (png_get_bit_depth(hPNG, psPNGInfo) < 8)
+        png_set_packing(hPNG);
+#ifdef CPL_LSB
+    if (png_get_bit_depth(hPNG, psPNGInfo) == 16)
+        png_set_swap(hPNG);
+#endif
+    png_set_interlace_handling(hPNG);
+    png_read_update_info(hPNG, psPNGInfo);
+    return true;
+}
+
+/************************************************************************/
+/*                          PNGDecodeImage()                            */
+/************************************************************************/
+
+static bool PNGDecodeImage(const void *pSrc, size_t nSrcSize,
+                           CSLConstList papszOptions, GDALDecodedImage &sImage)
+{
+    if (nSrcSize < 8 ||
+        png_sig_cmp(static_cast<png_const_bytep>(pSrc), 0, 8) != 0)
+    {
+        return false;
+    }
+
+    png_structp hPNG = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr,
+                                              nullptr, nullptr);
+    if (hPNG == nullptr)
+        return false;
+#ifdef DISABLE_CRC_CHECK
+    PNGDatasetDisableCRCCheck(hPNG);
+#endif
+    png_infop psPNGInfo = png_create_info_struct(hPNG);
+
+    jmp_buf sSetJmpContext;
+    png_set_error_fn(hPNG, &sSetJmpContext, png_gdal_error, png_gdal_warning);
+
+    PNGMemReadContext sContext;
+    sContext.pabyData = static_cast<const GByte *>(pSrc);
+    sContext.nSize = nSrcSize;
+    png_set_read_fn(hPNG, &sContext, png_mem_read_data);
+
+    bool bRet = safe_png_read_header(hPNG, psPNGInfo, sSetJmpContext) &&
+                GDALCheckDecodedImageSize(
+                    static_cast<int>(png_get_image_width(hPNG, psPNGInfo)),
+                    static_cast<int>(png_get_image_height(hPNG, psPNGInfo)),
+                    papszOptions);
+    if (bRet)
+    {
+        sImage.nXSize = static_cast<int>(png_get_image_width(hPNG, psPNGInfo));
+        sImage.nYSize =
+            static_cast<int>(png_get_image_height(hPNG, psPNGInfo));
+        const int nColorType = png_get_color_type(hPNG, psPNGInfo);
+        sImage.nBands = nColorType == PNG_COLOR_TYPE_PALETTE
+                            ? 1
+                            : png_get_channels(hPNG, psPNGInfo);
+        sImage.eDT = png_get_bit_depth(hPNG, psPNGInfo) == 16 ? GDT_UInt16
+                                                                 : GDT_Byte;
+        sImage.poColorTable.reset();
+
+        if (nColorType == PNG_COLOR_TYPE_PALETTE)
+        {
+            png_color *pasPNGPalette = nullptr;
+            int nColorCount = 0;
+            if (png_get_PLTE(hPNG, psPNGInfo, &pasPNGPalette, &nColorCount) ==
+                0)
+                nColorCount = 0;
+
+            unsigned char *trans = nullptr;
+            png_color_16 *trans_values = nullptr;
+            int num_trans = 0;
+            png_get_tRNS(hPNG, psPNGInfo, &trans, &num_trans, &trans_values);
+
+            sImage.poColorTable = std::make_unique<GDALColorTable>();
+            for (int iColor = nColorCount - 1; iColor >= 0; iColor--)
+            {
+                GDALColorEntry oEntry;
+                oEntry.c1 = pasPNGPalette[iColor].red;
+                oEntry.c2 = pasPNGPalette[iColor].green;
+                oEntry.c3 = pasPNGPalette[iColor].blue;
+                oEntry.c4 = iColor < num_trans ? trans[iColor] : 255;
+                sImage.poColorTable->SetColorEntry(iColor, &oEntry);
+            }
+        }
+
+        const size_t nDTSize = GDALGetDataTypeSizeBytes(sImage.eDT);
+        const size_t nRowBytes = png_get_rowbytes(hPNG, psPNGInfo);
+        std::vector<png_bytep> apabyRows;
+        std::vector<GByte> abyInterleaved;
+        try
+        {
+            const size_t nPixels =
+                static_cast<size_t>(sImage.nXSize) * sImage.nYSize;
+            if (nRowBytes != sImage.nXSize * sImage.nBands * nDTSize ||
+                nPixels > std::numeric_limits<size_t>::max() / nDTSize /
+                              sImage.nBands)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Unexpected PNG row size");
+                bRet = false;
+            }
+            else
+            {
+                sImage.abyData.resize(nPixels * sImage.nBands * nDTSize);
+                if (sImage.nBands > 1)
+                    abyInterleaved.resize(sImage.abyData.size());
+                GByte *pabyImage = sImage.nBands > 1
+                                       ? abyInterleaved.data()
+                                       : sImage.abyData.data();
+                apabyRows.resize(sImage.nYSize);
+                for (int iY = 0; iY < sImage.nYSize; ++iY)
+                    apabyRows[iY] = pabyImage + iY * nRowBytes;
+            }
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for decoded PNG image");
+            bRet = false;
+        }
+
+        if (bRet)
+        {
+            bRet = safe_png_read_image(hPNG, apabyRows.data(), sSetJmpContext);
+        }
+        if (bRet && sImage.nBands > 1)
+        {
+            std::vector<void *> apDstBuffers;
+            for (int i = 0; i < sImage.nBands; ++i)
+            {
+                apDstBuffers.push_back(sImage.abyData.data() +
+                                       i * (sImage.abyData.size() /
+                                            sImage.nBands));
+            }
+            GDALDeinterleave(abyInterleaved.data(), sImage.eDT, sImage.nBands,
+                             apDstBuffers.data(), sImage.eDT,
+                             static_cast<size_t>(sImage.nXSize) *
+                                 sImage.nYSize);
+        }
+    }
+
+    png_destroy_read_struct(&hPNG, &psPNGInfo, nullptr);
+    return bRet;
+}
+
+/************************************************************************/
+/*                       safe_png_encode_image()                        */
+/************************************************************************/
+
+static bool safe_png_encode_image(png_structp hPNG, png_infop psPNGInfo,
+                                  jmp_buf sSetJmpContext, int nXSize,
+                                  int nYSize, int nBitDepth, int nColorType,
+                                  int nZLevel, png_color *pasPNGColors,
+                                  int nColors, GByte *pabyAlpha, int nAlphas,
+                                  png_bytep *papabyRows)
+{
+    if (setjmp(sSetJmpContext) != 0)
+        return false;
+    png_set_IHDR(hPNG, psPNGInfo, nXSize, nYSize, nBitDepth, nColorType,
+                 PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_BASE,
+                 PNG_FILTER_TYPE_BASE);
+    png_set_compression_level(hPNG, nZLevel);
+    if (nColors > 0)
+        png_set_PLTE(hPNG, psPNGInfo, pasPNGColors, nColors);
+    if (nAlphas > 0)
+        png_set_tRNS(hPNG, psPNGInfo, pabyAlpha, nAlphas, nullptr);
+    png_write_info(hPNG, psPNGInfo);
+#ifdef CPL_LSB
+    if (nBitDepth == 16)
+        png_set_swap(hPNG);
+#endif
+    png_write_image(hPNG, papabyRows);
+    png_write_end(hPNG, psPNGInfo);
+    return true;
+}
+
+/************************************************************************/
+/*                          PNGEncodeImage()                            */
+/************************************************************************/
+
+static bool PNGEncodeImage(int nXSize, int nYSize, int nBands,
+                           GDALDataType eDT, const void *const *papBandData,
+                           const GDALColorTable *poColorTable,
+                           CSLConstList papszOptions,
+                           std::vector<GByte> &abyOut)
+{
+    if (eDT != GDT_Byte && eDT != GDT_UInt16)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "PNG encoding only supports Byte and UInt16 data types");
+        return false;
+    }
+    if (nBands < 1 || nBands > 4 || (poColorTable && nBands != 1) ||
+        (poColorTable && eDT != GDT_Byte))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "PNG encoding only supports 1 to 4 bands, and color tables "
+                 "only for single Byte band images");
+        return false;
+    }
+
+    const int nZLevel = atoi(CSLFetchNameValueDef(papszOptions, "ZLEVEL", "6"));
+    if (nZLevel < 1 || nZLevel > 9)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "Illegal ZLEVEL value");
+        return false;
+    }
+
+    const int nColorType = poColorTable  ? PNG_COLOR_TYPE_PALETTE
+                           : nBands == 1 ? PNG_COLOR_TYPE_GRAY
+                           : nBands == 2 ? PNG_COLOR_TYPE_GRAY_ALPHA
+                           : nBands == 3 ? PNG_COLOR_TYPE_RGB
+                                         : PNG_COLOR_TYPE_RGB_ALPHA;
+
+    png_color asPNGColors[256] = {};
+    GByte abyAlpha[256] = {};
+    int nColors = 0;
+    int nAlphas = 0;
+    if (poColorTable)
+    {
+        nColors = std::min(256, poColorTable->GetColorEntryCount());
+        for (int i = 0; i < nColors; ++i)
+        {
+            GDALColorEntry sEntry;
+            poColorTable->GetColorEntryAsRGB(i, &sEntry);
+            asPNGColors[i].red = static_cast<png_byte>(sEntry.c1);
+            asPNGColors[i].green = static_cast<png_byte>(sEntry.c2);
+            asPNGColors[i].blue = static_cast<png_byte>(sEntry.c3);
+            abyAlpha[i] = static_cast<GByte>(sEntry.c4);
+            if (sEntry.c4 != 255)
+                nAlphas = i + 1;
+        }
+    }
+
+    // Interleave pixel values
+    const size_t nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    const size_t nPixels = static_cast<size_t>(nXSize) * nYSize;
+    std::vector<GByte> abyInterleaved;
+    std::vector<png_bytep> apabyRows;
+    try
+    {
+        abyInterleaved.resize(nPixels * nBands * nDTSize);
+        apabyRows.resize(nYSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for PNG encoding");
+        return false;
+    }
+    for (int i = 0; i < nBands; ++i)
+    {
+        GDALCopyWords64(papBandData[i], eDT, static_cast<int>(nDTSize),
+                        abyInterleaved.data() + i * nDTSize, eDT,
+                        static_cast<int>(nBands * nDTSize), nPixels);
+    }
+    const size_t nRowBytes = static_cast<size_t>(nXSize) * nBands * nDTSize;
+    for (int iY = 0; iY < nYSize; ++iY)
+        apabyRows[iY] = abyInterleaved.data() + iY * nRowBytes;
+
+    png_structp hPNG = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr,
+                                               nullptr, nullptr);
+    if (hPNG == nullptr)
+        return false;
+    png_infop psPNGInfo = png_create_info_struct(hPNG);
+
+    jmp_buf sSetJmpContext;
+    png_set_error_fn(hPNG, &sSetJmpContext, png_gdal_error, png_gdal_warning);
+    abyOut.clear();
+    png_set_write_fn(hPNG, &abyOut, png_mem_write_data, png_mem_flush);
+
+    const bool bRet = safe_png_encode_image(
+        hPNG, psPNGInfo, sSetJmpContext, nXSize, nYSize,
+        static_cast<int>(nDTSize * 8), nColorType, nZLevel, asPNGColors,
+        nColors, abyAlpha, nAlphas, apabyRows.data());
+
+    png_destroy_write_struct(&hPNG, &psPNGInfo);
+    return bRet;
+}
+
 /************************************************************************/
 /*                          GDALRegister_PNG()                          */
 /************************************************************************/
@@ -2864,6 +3203,8 @@ void GDALRegister_PNG()
 
     poDriver->pfnOpen = PNGDataset::Open;
     poDriver->pfnCreateCopy = PNGDataset::CreateCopy;
+    poDriver->pfnDecodeImage = PNGDecodeImage;
+    poDriver->pfnEncodeImage = PNGEncodeImage;
 #ifdef SUPPORT_CREATE
     poDriver->pfnCreate = PNGDataset::Create;
 #endif
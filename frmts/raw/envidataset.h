@@ -152,6 +152,12 @@ class ENVIRasterBand final : public RawRasterBand
     CPLErr SetScale(double) override;
 
     CPLErr SetCategoryNames(char **) override;
+
+  protected:
+    bool CanBeReadConcurrently() const override
+    {
+        return true;
+    }
 };
 
 #endif  // GDAL_FRMTS_RAW_ENVIDATASET_H_INCLUDED
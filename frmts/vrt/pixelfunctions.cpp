@@ -46,7 +46,15 @@
 namespace gdal
 {
 MathExpression::~MathExpression() = default;
+
+CPLErr MathExpression::EvaluateBulk(int /* nCount */,
+                                    double * /* padfResults */)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Bulk evaluation is not supported for this expression dialect");
+    return CE_Failure;
 }
+}  // namespace gdal
 
 template <typename T>
 inline double GetSrcVal(const void *pSource, GDALDataType eSrcType, T ii)
@@ -133,6 +141,158 @@ static CPLErr FetchDoubleArg(CSLConstList papszArgs, const char *pszName,
     return CE_None;
 }
 
+/************************************************************************/
+/*                          ApplyRealKernel()                           */
+/************************************************************************/
+
+// Number of pixels of the temporary buffer used when the output buffer is
+// not a packed Float32 or Float64 one.
+constexpr int REAL_KERNEL_CHUNK_SIZE = 256;
+
+template <int N, class Tsrc, class Tdst, class Kernel>
+static inline void ApplyRealKernelRow(const Tsrc *pSrc0, const Tsrc *pSrc1,
+                                      Tdst *pDst, int nCount,
+                                      const Kernel &oKernel)
+{
+    for (int i = 0; i < nCount; ++i)
+    {
+        if constexpr (N == 1)
+        {
+            GDALCopyWord(oKernel(static_cast<double>(pSrc0[i])), pDst[i]);
+        }
+        else
+        {
+            GDALCopyWord(oKernel(static_cast<double>(pSrc0[i]),
+                                 static_cast<double>(pSrc1[i])),
+                         pDst[i]);
+        }
+    }
+}
+
+template <int N, class Tsrc, class Kernel>
+static void ApplyRealKernel(const void *const *papoSources, void *pData,
+                            int nXSize, int nYSize, GDALDataType eBufType,
+                            int nPixelSpace, int nLineSpace,
+                            const Kernel &oKernel)
+{
+    const Tsrc *const pSrc0 = static_cast<const Tsrc *>(papoSources[0]);
+    const Tsrc *const pSrc1 = static_cast<const Tsrc *>(papoSources[N - 1]);
+    for (int iLine = 0; iLine < nYSize; ++iLine)
+    {
+        const size_t nSrcOffset = static_cast<size_t>(iLine) * nXSize;
+        GByte *const pabyDst = static_cast<GByte *>(pData) +
+                               static_cast<GSpacing>(nLineSpace) * iLine;
+        if (eBufType == GDT_Float32 && nPixelSpace == sizeof(float) &&
+            CPL_IS_ALIGNED(pabyDst, alignof(float)))
+        {
+            ApplyRealKernelRow<N>(pSrc0 + nSrcOffset, pSrc1 + nSrcOffset,
+                                  reinterpret_cast<float *>(pabyDst), nXSize,
+                                  oKernel);
+        }
+        else if (eBufType == GDT_Float64 && nPixelSpace == sizeof(double) &&
+                 CPL_IS_ALIGNED(pabyDst, alignof(double)))
+        {
+            ApplyRealKernelRow<N>(pSrc0 + nSrcOffset, pSrc1 + nSrcOffset,
+                                  reinterpret_cast<double *>(pabyDst), nXSize,
+                                  oKernel);
+        }
+        else
+        {
+            double adfTmp[REAL_KERNEL_CHUNK_SIZE];
+            for (int iCol = 0; iCol < nXSize; iCol += REAL_KERNEL_CHUNK_SIZE)
+            {
+                const int nCount =
+                    std::min(REAL_KERNEL_CHUNK_SIZE, nXSize - iCol);
+                ApplyRealKernelRow<N>(pSrc0 + nSrcOffset + iCol,
+                                      pSrc1 + nSrcOffset + iCol, adfTmp,
+                                      nCount, oKernel);
+                GDALCopyWords(adfTmp, GDT_Float64, sizeof(double),
+                              pabyDst + static_cast<GSpacing>(iCol) *
+                                            nPixelSpace,
+                              eBufType, nPixelSpace, nCount);
+            }
+        }
+    }
+}
+
+/** Apply oKernel(dfSrc0) (N == 1) or oKernel(dfSrc0, dfSrc1) (N == 2) on
+ * each pixel of the (real-valued) sources, and store the result in pData.
+ *
+ * Byte, UInt16, Int16, Float32 and Float64 sources are read through type
+ * specialized loops, that the compiler can vectorize when the kernel is
+ * simple enough, in particular when writing to packed Float32 or Float64
+ * output buffers. Other data types go through GetSrcVal().
+ */
+template <int N, class Kernel>
+static void ApplyRealKernel(const void *const *papoSources,
+                            GDALDataType eSrcType, void *pData, int nXSize,
+                            int nYSize, GDALDataType eBufType, int nPixelSpace,
+                            int nLineSpace, const Kernel &oKernel)
+{
+    static_assert(N == 1 || N == 2);
+    CPLAssert(!GDALDataTypeIsComplex(eSrcType));
+
+    switch (eSrcType)
+    {
+        case GDT_Byte:
+            ApplyRealKernel<N, GByte>(papoSources, pData, nXSize, nYSize,
+                                      eBufType, nPixelSpace, nLineSpace,
+                                      oKernel);
+            return;
+        case GDT_UInt16:
+            ApplyRealKernel<N, GUInt16>(papoSources, pData, nXSize, nYSize,
+                                        eBufType, nPixelSpace, nLineSpace,
+                                        oKernel);
+            return;
+        case GDT_Int16:
+            ApplyRealKernel<N, GInt16>(papoSources, pData, nXSize, nYSize,
+                                       eBufType, nPixelSpace, nLineSpace,
+                                       oKernel);
+            return;
+        case GDT_Float32:
+            ApplyRealKernel<N, float>(papoSources, pData, nXSize, nYSize,
+                                      eBufType, nPixelSpace, nLineSpace,
+                                      oKernel);
+            return;
+        case GDT_Float64:
+            ApplyRealKernel<N, double>(papoSources, pData, nXSize, nYSize,
+                                       eBufType, nPixelSpace, nLineSpace,
+                                       oKernel);
+            return;
+        default:
+            break;
+    }
+
+    size_t ii = 0;
+    for (int iLine = 0; iLine < nYSize; ++iLine)
+    {
+        GByte *const pabyDst = static_cast<GByte *>(pData) +
+                               static_cast<GSpacing>(nLineSpace) * iLine;
+        double adfTmp[REAL_KERNEL_CHUNK_SIZE];
+        for (int iCol = 0; iCol < nXSize; iCol += REAL_KERNEL_CHUNK_SIZE)
+        {
+            const int nCount = std::min(REAL_KERNEL_CHUNK_SIZE, nXSize - iCol);
+            for (int i = 0; i < nCount; ++i, ++ii)
+            {
+                if constexpr (N == 1)
+                {
+                    adfTmp[i] =
+                        oKernel(GetSrcVal(papoSources[0], eSrcType, ii));
+                }
+                else
+                {
+                    adfTmp[i] =
+                        oKernel(GetSrcVal(papoSources[0], eSrcType, ii),
+                                GetSrcVal(papoSources[1], eSrcType, ii));
+                }
+            }
+            GDALCopyWords(adfTmp, GDT_Float64, sizeof(double),
+                          pabyDst + static_cast<GSpacing>(iCol) * nPixelSpace,
+                          eBufType, nPixelSpace, nCount);
+        }
+    }
+}
+
 static CPLErr RealPixelFunc(void **papoSources, int nSources, void *pData,
                             int nXSize, int nYSize, GDALDataType eSrcType,
                             GDALDataType eBufType, int nPixelSpace,
@@ -1269,27 +1429,16 @@ static CPLErr DiffPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
-        {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        ApplyRealKernel<2>(
+            papoSources, eSrcType, pData, nXSize, nYSize, eBufType,
+            nPixelSpace, nLineSpace,
+            [bHasNoData, dfNoData](double dfA, double dfB)
             {
-                const double dfA = GetSrcVal(papoSources[0], eSrcType, ii);
-                const double dfB = GetSrcVal(papoSources[1], eSrcType, ii);
-
-                const double dfPixVal =
-                    bHasNoData &&
-                            (IsNoData(dfA, dfNoData) || IsNoData(dfB, dfNoData))
-                        ? dfNoData
-                        : dfA - dfB;
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
-        }
+                return bHasNoData && (IsNoData(dfA, dfNoData) ||
+                                      IsNoData(dfB, dfNoData))
+                           ? dfNoData
+                           : dfA - dfB;
+            });
     }
 
     /* ---- Return success ---- */
@@ -1370,6 +1519,29 @@ static CPLErr MulPixelFunc(void **papoSources, int nSources, void *pData,
             }
         }
     }
+    else if (nSources == 2)
+    {
+        /* ---- Set pixels ---- */
+        ApplyRealKernel<2>(
+            papoSources, eSrcType, pData, nXSize, nYSize, eBufType,
+            nPixelSpace, nLineSpace,
+            [dfK, bHasNoData, dfNoData, bPropagateNoData](double dfA,
+                                                          double dfB)
+            {
+                if (bHasNoData)
+                {
+                    const bool bANoData = IsNoData(dfA, dfNoData);
+                    const bool bBNoData = IsNoData(dfB, dfNoData);
+                    if (bPropagateNoData && (bANoData || bBNoData))
+                        return dfNoData;
+                    if (bANoData)
+                        dfA = 1.0;
+                    if (bBNoData)
+                        dfB = 1.0;
+                }
+                return dfK * dfA * dfB;
+            });
+    }
     else
     {
         /* ---- Set pixels ---- */
@@ -1475,14 +1647,11 @@ static CPLErr DivPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
-        {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        ApplyRealKernel<2>(
+            papoSources, eSrcType, pData, nXSize, nYSize, eBufType,
+            nPixelSpace, nLineSpace,
+            [bHasNoData, dfNoData](double dfNum, double dfDenom)
             {
-                const double dfNum = GetSrcVal(papoSources[0], eSrcType, ii);
-                const double dfDenom = GetSrcVal(papoSources[1], eSrcType, ii);
-
                 double dfPixVal = dfNoData;
                 if (!bHasNoData || (!IsNoData(dfNum, dfNoData) &&
                                     !IsNoData(dfDenom, dfNoData)))
@@ -1499,14 +1668,8 @@ static CPLErr DivPixelFunc(void **papoSources, int nSources, void *pData,
 #endif
                         ;
                 }
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
-        }
+                return dfPixVal;
+            });
     }
 
     /* ---- Return success ---- */
@@ -1642,16 +1805,12 @@ static CPLErr InvPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
-        {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        ApplyRealKernel<1>(
+            papoSources, eSrcType, pData, nXSize, nYSize, eBufType,
+            nPixelSpace, nLineSpace,
+            [dfK, bHasNoData, dfNoData](double dfVal)
             {
-                // Source raster pixels may be obtained with GetSrcVal macro.
-                // Not complex.
-                const double dfVal = GetSrcVal(papoSources[0], eSrcType, ii);
                 double dfPixVal = dfNoData;
-
                 if (!bHasNoData || !IsNoData(dfVal, dfNoData))
                 {
                     dfPixVal =
@@ -1665,14 +1824,8 @@ static CPLErr InvPixelFunc(void **papoSources, int nSources, void *pData,
 #endif
                         ;
                 }
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
-        }
+                return dfPixVal;
+            });
     }
 
     /* ---- Return success ---- */
@@ -1762,30 +1915,14 @@ static CPLErr SqrtPixelFunc(void **papoSources, int nSources, void *pData,
         return CE_Failure;
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-        {
-            // Source raster pixels may be obtained with GetSrcVal macro.
-            double dfPixVal = GetSrcVal(papoSources[0], eSrcType, ii);
-
-            if (bHasNoData && IsNoData(dfPixVal, dfNoData))
-            {
-                dfPixVal = dfNoData;
-            }
-            else
-            {
-                dfPixVal = std::sqrt(dfPixVal);
-            }
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
+    ApplyRealKernel<1>(papoSources, eSrcType, pData, nXSize, nYSize, eBufType,
+                       nPixelSpace, nLineSpace,
+                       [bHasNoData, dfNoData](double dfVal)
+                       {
+                           return bHasNoData && IsNoData(dfVal, dfNoData)
+                                      ? dfNoData
+                                      : std::sqrt(dfVal);
+                       });
 
     /* ---- Return success ---- */
     return CE_None;
@@ -1844,25 +1981,15 @@ static CPLErr Log10PixelFuncHelper(void **papoSources, int nSources,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
-        for (int iLine = 0; iLine < nYSize; ++iLine)
-        {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-            {
-                // Source raster pixels may be obtained with GetSrcVal macro.
-                const double dfSrcVal = GetSrcVal(papoSources[0], eSrcType, ii);
-                const double dfPixVal =
-                    bHasNoData && IsNoData(dfSrcVal, dfNoData)
-                        ? dfNoData
-                        : fact * std::log10(std::abs(dfSrcVal));
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
-        }
+        ApplyRealKernel<1>(papoSources, eSrcType, pData, nXSize, nYSize,
+                           eBufType, nPixelSpace, nLineSpace,
+                           [bHasNoData, dfNoData, fact](double dfSrcVal)
+                           {
+                               return bHasNoData && IsNoData(dfSrcVal, dfNoData)
+                                          ? dfNoData
+                                          : fact *
+                                                std::log10(std::abs(dfSrcVal));
+                           });
     }
 
     /* ---- Return success ---- */
@@ -1923,24 +2050,14 @@ static CPLErr ExpPixelFuncHelper(void **papoSources, int nSources, void *pData,
         return CE_Failure;
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-        {
-            // Source raster pixels may be obtained with GetSrcVal macro.
-            const double dfVal = GetSrcVal(papoSources[0], eSrcType, ii);
-            const double dfPixVal = bHasNoData && IsNoData(dfVal, dfNoData)
-                                        ? dfNoData
-                                        : pow(base, dfVal * fact);
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
+    ApplyRealKernel<1>(papoSources, eSrcType, pData, nXSize, nYSize, eBufType,
+                       nPixelSpace, nLineSpace,
+                       [bHasNoData, dfNoData, base, fact](double dfVal)
+                       {
+                           return bHasNoData && IsNoData(dfVal, dfNoData)
+                                      ? dfNoData
+                                      : pow(base, dfVal * fact);
+                       });
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2021,24 +2138,14 @@ static CPLErr PowPixelFunc(void **papoSources, int nSources, void *pData,
         return CE_Failure;
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-        {
-            const double dfVal = GetSrcVal(papoSources[0], eSrcType, ii);
-
-            const double dfPixVal = bHasNoData && IsNoData(dfVal, dfNoData)
-                                        ? dfNoData
-                                        : std::pow(dfVal, power);
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
+    ApplyRealKernel<1>(papoSources, eSrcType, pData, nXSize, nYSize, eBufType,
+                       nPixelSpace, nLineSpace,
+                       [bHasNoData, dfNoData, power](double dfVal)
+                       {
+                           return bHasNoData && IsNoData(dfVal, dfNoData)
+                                      ? dfNoData
+                                      : std::pow(dfVal, power);
+                       });
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2197,22 +2304,15 @@ static CPLErr ReplaceNoDataPixelFunc(void **papoSources, int nSources,
     }
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+    ApplyRealKernel<1>(
+        papoSources, eSrcType, pData, nXSize, nYSize, eBufType, nPixelSpace,
+        nLineSpace,
+        [dfOldNoData, dfNewNoData](double dfPixVal)
         {
-            double dfPixVal = GetSrcVal(papoSources[0], eSrcType, ii);
-            if (dfPixVal == dfOldNoData || std::isnan(dfPixVal))
-                dfPixVal = dfNewNoData;
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
+            return dfPixVal == dfOldNoData || std::isnan(dfPixVal)
+                       ? dfNewNoData
+                       : dfPixVal;
+        });
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2252,24 +2352,14 @@ static CPLErr ScalePixelFunc(void **papoSources, int nSources, void *pData,
         return CE_Failure;
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-        {
-            const double dfVal = GetSrcVal(papoSources[0], eSrcType, ii);
-
-            const double dfPixVal = bHasNoData && IsNoData(dfVal, dfNoData)
-                                        ? dfNoData
-                                        : dfVal * dfScale + dfOffset;
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
+    ApplyRealKernel<1>(papoSources, eSrcType, pData, nXSize, nYSize, eBufType,
+                       nPixelSpace, nLineSpace,
+                       [bHasNoData, dfNoData, dfScale, dfOffset](double dfVal)
+                       {
+                           return bHasNoData && IsNoData(dfVal, dfNoData)
+                                      ? dfNoData
+                                      : dfVal * dfScale + dfOffset;
+                       });
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2302,14 +2392,11 @@ static CPLErr NormDiffPixelFunc(void **papoSources, int nSources, void *pData,
         return CE_Failure;
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
-    for (int iLine = 0; iLine < nYSize; ++iLine)
-    {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+    ApplyRealKernel<2>(
+        papoSources, eSrcType, pData, nXSize, nYSize, eBufType, nPixelSpace,
+        nLineSpace,
+        [bHasNoData, dfNoData](double dfLeftVal, double dfRightVal)
         {
-            const double dfLeftVal = GetSrcVal(papoSources[0], eSrcType, ii);
-            const double dfRightVal = GetSrcVal(papoSources[1], eSrcType, ii);
-
             double dfPixVal = dfNoData;
 
             if (!bHasNoData || (!IsNoData(dfLeftVal, dfNoData) &&
@@ -2328,14 +2415,8 @@ static CPLErr NormDiffPixelFunc(void **papoSources, int nSources, void *pData,
 #endif
                     ;
             }
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
-    }
+            return dfPixVal;
+        });
 
     /* ---- Return success ---- */
     return CE_None;
@@ -2787,8 +2868,6 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
         return CE_Failure;
     }
 
-    std::vector<double> adfValuesForPixel(nSources);
-
     const char *pszDialect = CSLFetchNameValue(papszArgs, "dialect");
     if (!pszDialect)
     {
@@ -2803,16 +2882,24 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
         return CE_Failure;
     }
 
+    // When the expression engine supports it, evaluate whole lines at once.
+    // Each variable then points to an array of nXSize values.
+    const bool bUseBands = strstr(pszExpression, "BANDS") != nullptr;
+    const size_t nBulkSize =
+        !bUseBands && poExpression->SupportsBulkEvaluation() ? nXSize : 1;
+
+    std::vector<double> adfValuesForPixel(nSources * nBulkSize);
+
     {
         int iSource = 0;
         for (const auto &osName : aosSourceNames)
         {
-            poExpression->RegisterVariable(osName,
-                                           &adfValuesForPixel[iSource++]);
+            poExpression->RegisterVariable(
+                osName, &adfValuesForPixel[iSource++ * nBulkSize]);
         }
     }
 
-    if (strstr(pszExpression, "BANDS"))
+    if (bUseBands)
     {
         poExpression->RegisterVector("BANDS", &adfValuesForPixel);
     }
@@ -2822,26 +2909,65 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
     if (!padfResults)
         return CE_Failure;
 
+    // Bulk evaluation is only possible for expressions returning a single
+    // value, which we check by evaluating the first pixel.
+    bool bBulk = false;
+    if (nBulkSize > 1 && nYSize > 0)
+    {
+        for (int iSrc = 0; iSrc < nSources; iSrc++)
+        {
+            adfValuesForPixel[iSrc * nBulkSize] =
+                GetSrcVal(papoSources[iSrc], eSrcType, 0);
+        }
+        if (poExpression->Evaluate() != CE_None)
+        {
+            return CE_Failure;
+        }
+        bBulk = poExpression->Results().size() == 1;
+    }
+
     /* ---- Set pixels ---- */
+    const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
     size_t ii = 0;
     for (int iLine = 0; iLine < nYSize; ++iLine)
     {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        if (bBulk)
         {
             for (int iSrc = 0; iSrc < nSources; iSrc++)
             {
-                // cppcheck-suppress unreadVariable
-                adfValuesForPixel[iSrc] =
-                    GetSrcVal(papoSources[iSrc], eSrcType, ii);
+                GDALCopyWords(static_cast<const GByte *>(papoSources[iSrc]) +
+                                  ii * nSrcTypeSize,
+                              eSrcType, nSrcTypeSize,
+                              &adfValuesForPixel[iSrc * nBulkSize],
+                              GDT_Float64, sizeof(double), nXSize);
             }
+            ii += nXSize;
 
-            if (auto eErr = poExpression->Evaluate(); eErr != CE_None)
+            if (poExpression->EvaluateBulk(nXSize, padfResults.get()) !=
+                CE_None)
             {
                 return CE_Failure;
             }
-            else
+        }
+        else
+        {
+            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
             {
-                padfResults.get()[iCol] = poExpression->Results()[0];
+                for (int iSrc = 0; iSrc < nSources; iSrc++)
+                {
+                    // cppcheck-suppress unreadVariable
+                    adfValuesForPixel[iSrc * nBulkSize] =
+                        GetSrcVal(papoSources[iSrc], eSrcType, ii);
+                }
+
+                if (auto eErr = poExpression->Evaluate(); eErr != CE_None)
+                {
+                    return CE_Failure;
+                }
+                else
+                {
+                    padfResults.get()[iCol] = poExpression->Results()[0];
+                }
             }
         }
 
@@ -3866,6 +3992,9 @@ static CPLErr BasicPixelFunc(void **papoSources, int nSources, void *pData,
  */
 CPLErr GDALRegisterDefaultPixelFunc()
 {
+    const std::vector<std::string> aosAlreadyRegistered =
+        VRTDerivedRasterBand::GetPixelFunctionNames();
+
     GDALAddDerivedBandPixelFunc("real", RealPixelFunc);
     GDALAddDerivedBandPixelFunc("imag", ImagPixelFunc);
     GDALAddDerivedBandPixelFunc("complex", ComplexPixelFunc);
@@ -3933,5 +4062,19 @@ CPLErr GDALRegisterDefaultPixelFunc()
                                         pszBasicPixelFuncMetadata);
     GDALAddDerivedBandPixelFuncWithArgs("mode", BasicPixelFunc<ModeKernel>,
                                         pszBasicPixelFuncMetadata);
+
+    // All above functions compute each output pixel from the source pixels
+    // at the same location, and are thread-safe.
+    for (const std::string &osName :
+         VRTDerivedRasterBand::GetPixelFunctionNames())
+    {
+        if (std::find(aosAlreadyRegistered.begin(), aosAlreadyRegistered.end(),
+                      osName) == aosAlreadyRegistered.end())
+        {
+            VRTDerivedRasterBand::SetPixelFunctionRowSplittable(
+                osName.c_str());
+        }
+    }
+
     return CE_None;
 }
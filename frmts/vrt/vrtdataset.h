@@ -695,6 +695,12 @@ class VRTProcessedDataset final : public VRTDataset
         //! Nodata values (nOutBands) of the output bands.
         std::vector<double> adfOutNoData{};
 
+        //! Input nodata values, as passed to the init function.
+        std::vector<double> adfInNoDataForInit{};
+
+        //! Output nodata values, as passed to the init function (final step).
+        std::vector<double> adfOutNoDataForInit{};
+
         //! Working data structure (private data of the implementation of the function)
         VRTPDWorkingDataPtr pWorkingData = nullptr;
 
@@ -764,6 +770,15 @@ class VRTProcessedDataset final : public VRTDataset
     //! Value of CPLGetUsablePhysicalRAM() / 10 * 4
     GIntBig m_nAllowedRAMUsage = 0;
 
+    //! Whether all steps use algorithms registered with THREAD_SAFE=YES
+    bool m_bStepsThreadSafe = true;
+
+    //! Working data structures of steps, for ProcessStepsMultiThreaded()
+    std::vector<std::vector<VRTPDWorkingDataPtr>> m_aapWorkingDataPool{};
+
+    //! Mutex protecting m_aapWorkingDataPool
+    std::mutex m_oWorkingDataPoolMutex{};
+
     CPLErr Init(const CPLXMLNode *, const char *,
                 const VRTProcessedDataset *poParentDS,
                 GDALDataset *poParentSrcDS, int iOvrLevel);
@@ -774,6 +789,19 @@ class VRTProcessedDataset final : public VRTDataset
                    std::vector<double> &adfOutNoData);
     bool ProcessRegion(int nXOff, int nYOff, int nBufXSize, int nBufYSize,
                        GDALProgressFunc pfnProgress, void *pProgressData);
+    bool ProcessSteps(const std::vector<VRTPDWorkingDataPtr> *papWorkingData,
+                      int nXOff, int nYOff, int nBufXSize, int nBufYSize,
+                      const double adfSrcGT[],
+                      std::vector<NoInitByte> &abyInput,
+                      std::vector<NoInitByte> &abyOutput,
+                      GDALProgressFunc pfnProgress, void *pProgressData) const;
+    bool ProcessStepsMultiThreaded(int nXOff, int nYOff, int nBufXSize,
+                                   int nBufYSize, const double adfSrcGT[],
+                                   int nMaxThreads);
+    bool CreateStepsWorkingData(
+        std::vector<VRTPDWorkingDataPtr> &apWorkingData) const;
+    void FreeStepsWorkingData(
+        std::vector<VRTPDWorkingDataPtr> &apWorkingData) const;
 };
 
 /************************************************************************/
@@ -1227,6 +1255,8 @@ class CPL_DLL VRTDerivedRasterBand CPL_NON_FINAL : public VRTSourcedRasterBand
 
     static std::vector<std::string> GetPixelFunctionNames();
 
+    static void SetPixelFunctionRowSplittable(const char *pszFuncNameIn);
+
     void SetPixelFunctionName(const char *pszFuncNameIn);
     void AddPixelFunctionArgument(const char *pszArg, const char *pszValue);
     void SetSkipNonContributingSources(bool bSkip);
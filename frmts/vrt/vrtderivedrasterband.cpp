@@ -15,11 +15,16 @@
 #include "cpl_minixml.h"
 #include "cpl_string.h"
 #include "vrtdataset.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "gdalpython.h"
 
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <set>
 #include <vector>
 #include <utility>
 
@@ -246,6 +251,18 @@ GetGlobalMapPixelFunction()
     return gosMapPixelFunction;
 }
 
+/************************************************************************/
+/*                 GetGlobalSetRowSplittablePixelFunction()             */
+/************************************************************************/
+
+// Names of the pixel functions that may be applied concurrently on
+// independent row blocks of the same request.
+static std::set<std::string> &GetGlobalSetRowSplittablePixelFunction()
+{
+    static std::set<std::string> goSetRowSplittablePixelFunction;
+    return goSetRowSplittablePixelFunction;
+}
+
 /************************************************************************/
 /*                           AddPixelFunction()                         */
 /************************************************************************/
@@ -276,6 +293,7 @@ CPLErr CPL_STDCALL GDALAddDerivedBandPixelFunc(
         return CE_None;
     }
 
+    GetGlobalSetRowSplittablePixelFunction().erase(pszName);
     GetGlobalMapPixelFunction()[pszName] = {
         [pfnNewFunction](void **papoSources, int nSources, void *pData,
                          int nBufXSize, int nBufYSize, GDALDataType eSrcType,
@@ -319,6 +337,7 @@ CPLErr CPL_STDCALL GDALAddDerivedBandPixelFuncWithArgs(
         return CE_None;
     }
 
+    GetGlobalSetRowSplittablePixelFunction().erase(pszName);
     GetGlobalMapPixelFunction()[pszName] = {pfnNewFunction,
                                             pszMetadata ? pszMetadata : ""};
 
@@ -388,6 +407,27 @@ VRTDerivedRasterBand::GetPixelFunction(const char *pszFuncNameIn)
     return &(oIter->second);
 }
 
+/************************************************************************/
+/*                    SetPixelFunctionRowSplittable()                   */
+/************************************************************************/
+
+/**
+ * Declare that a registered pixel function computes each output pixel only
+ * from the source pixels at the same location, and is thread-safe, so that
+ * it may be invoked concurrently on independent row blocks of a request.
+ *
+ * This property is reset if the pixel function is registered again.
+ *
+ * @param pszFuncNameIn The name associated with the pixel function.
+ */
+/* static */
+void VRTDerivedRasterBand::SetPixelFunctionRowSplittable(
+    const char *pszFuncNameIn)
+{
+    if (GetPixelFunction(pszFuncNameIn))
+        GetGlobalSetRowSplittablePixelFunction().insert(pszFuncNameIn);
+}
+
 /************************************************************************/
 /*                        GetPixelFunctionNames()                       */
 /************************************************************************/
@@ -1569,14 +1609,83 @@ CPLErr VRTDerivedRasterBand::IRasterIO(
             aosArgs.SetNameValue(pszKey, pszValue);
         }
 
-        static_assert(sizeof(apBuffers[0]) == sizeof(void *));
-        eErr = (poPixelFunc->first)(
-            // We cast vector<unique_ptr<void>>.data() as void**. This is OK
-            // given above static_assert
-            reinterpret_cast<void **>(apBuffers.data()), nBufferCount, pData,
-            nBufXSize, nBufYSize, eSrcType, eBufType,
-            static_cast<int>(nPixelSpace), static_cast<int>(nLineSpace),
-            aosArgs.List());
+        // Split the request in row blocks processed by the thread pool,
+        // when the pixel function allows it and the request is large enough
+        // to amortize the cost of dispatching jobs.
+        constexpr int MIN_PIXELS_PER_JOB = 64 * 1024;
+        const GIntBig nBufPixels = static_cast<GIntBig>(nBufXSize) * nBufYSize;
+        int nJobs = 1;
+        if (nBufferRadius == 0 && nBufPixels >= 2 * MIN_PIXELS_PER_JOB &&
+            cpl::contains(GetGlobalSetRowSplittablePixelFunction(),
+                          osFuncName))
+        {
+            nJobs = static_cast<int>(std::min<GIntBig>(
+                std::min<GIntBig>(nBufYSize, nBufPixels / MIN_PIXELS_PER_JOB),
+                VRTDataset::GetNumThreads(poDS)));
+        }
+        CPLWorkerThreadPool *poThreadPool =
+            nJobs > 1 ? GDALGetGlobalThreadPool(nJobs) : nullptr;
+        auto poQueue =
+            poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+        if (poQueue)
+        {
+            CPLDebug("VRT",
+                     "IRasterIO(): applying pixel function %s with %d jobs",
+                     osFuncName.c_str(), nJobs);
+
+            CPLErrorAccumulator oErrorAccumulator;
+            std::atomic<bool> bSuccess = true;
+            const int nRowsPerJob = DIV_ROUND_UP(nBufYSize, nJobs);
+            for (int iYStart = 0; iYStart < nBufYSize; iYStart += nRowsPerJob)
+            {
+                const int nRows = std::min(nRowsPerJob, nBufYSize - iYStart);
+                const auto Job = [&, iYStart, nRows]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+
+                    std::vector<void *> apSrcBuffers(nBufferCount);
+                    for (int i = 0; i < nBufferCount; ++i)
+                    {
+                        apSrcBuffers[i] =
+                            static_cast<GByte *>(apBuffers[i].get()) +
+                            static_cast<size_t>(iYStart) * nBufXSize *
+                                nSrcTypeSize;
+                    }
+                    if ((poPixelFunc->first)(
+                            apSrcBuffers.data(), nBufferCount,
+                            static_cast<GByte *>(pData) + iYStart * nLineSpace,
+                            nBufXSize, nRows, eSrcType, eBufType,
+                            static_cast<int>(nPixelSpace),
+                            static_cast<int>(nLineSpace),
+                            aosArgs.List()) != CE_None)
+                    {
+                        bSuccess = false;
+                    }
+                };
+                if (!poQueue->SubmitJob(Job))
+                {
+                    bSuccess = false;
+                    break;
+                }
+            }
+            poQueue->WaitCompletion();
+            oErrorAccumulator.ReplayErrors();
+            eErr = bSuccess ? CE_None : CE_Failure;
+        }
+        else
+        {
+            static_assert(sizeof(apBuffers[0]) == sizeof(void *));
+            eErr = (poPixelFunc->first)(
+                // We cast vector<unique_ptr<void>>.data() as void**. This is
+                // OK given above static_assert
+                reinterpret_cast<void **>(apBuffers.data()), nBufferCount,
+                pData, nBufXSize, nBufYSize, eSrcType, eBufType,
+                static_cast<int>(nPixelSpace), static_cast<int>(nLineSpace),
+                aosArgs.List());
+        }
     }
 
     return eErr;
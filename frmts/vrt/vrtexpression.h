@@ -87,6 +87,33 @@ class MathExpression
      */
     virtual CPLErr Evaluate() = 0;
 
+    /**
+     * Return whether EvaluateBulk() is supported by this implementation.
+     *
+     * @since 3.12
+     */
+    virtual bool SupportsBulkEvaluation() const
+    {
+        return false;
+    }
+
+    /**
+     * Evaluate the expression for several sets of values of its variables.
+     *
+     * The location of each variable registered with RegisterVariable() must
+     * be the start of an array of at least nCount values, and the i-th
+     * evaluation uses the i-th value of each array. The expression is
+     * compiled once, and must return a single value. Vectors registered with
+     * RegisterVector() are not supported.
+     *
+     * @param nCount Number of evaluations.
+     * @param padfResults Array of nCount values, receiving the results.
+     * @return CE_None if the expression was successfully evaluated, CE_Failure otherwise.
+     *
+     * @since 3.12
+     */
+    virtual CPLErr EvaluateBulk(int nCount, double *padfResults);
+
     /**
      * Access the results from the last time the expression was evaluated.
      *
@@ -155,6 +182,13 @@ class MuParserExpression : public MathExpression
 
     CPLErr Evaluate() override;
 
+    bool SupportsBulkEvaluation() const override
+    {
+        return true;
+    }
+
+    CPLErr EvaluateBulk(int nCount, double *padfResults) override;
+
     const std::vector<double> &Results() const override;
 
   private:
@@ -165,6 +165,38 @@ class MuParserExpression::Impl
         return CE_None;
     }
 
+    CPLErr EvaluateBulk(int nCount, double *padfResults)
+    {
+        if (!m_bIsCompiled)
+        {
+            if (auto eErr = Compile(); eErr != CE_None)
+            {
+                return eErr;
+            }
+
+            m_bIsCompiled = true;
+        }
+
+        try
+        {
+            // Variables point to arrays of nCount values, and the bytecode
+            // is run on each of them.
+            m_oParser.Eval(padfResults, nCount);
+        }
+        catch (const mu::Parser::exception_type &e)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", e.GetMsg().c_str());
+            return CE_Failure;
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", e.what());
+            return CE_Failure;
+        }
+
+        return CE_None;
+    }
+
     const CPLString m_osExpression;
     std::map<CPLString, CPLString> m_oSubstitutions{};
     mu::Parser m_oParser{};
@@ -237,6 +269,11 @@ CPLErr MuParserExpression::Evaluate()
     return m_pImpl->Evaluate();
 }
 
+CPLErr MuParserExpression::EvaluateBulk(int nCount, double *padfResults)
+{
+    return m_pImpl->EvaluateBulk(nCount, padfResults);
+}
+
 const std::vector<double> &MuParserExpression::Results() const
 {
     return m_pImpl->m_adfResults;
@@ -10,12 +10,16 @@
  * SPDX-License-Identifier: MIT
  ****************************************************************************/
 
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "vrtdataset.h"
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <vector>
@@ -68,6 +72,10 @@ struct VRTProcessedDatasetFunc
 
     //! Required processing function
     GDALVRTProcessedDatasetFuncProcess pfnProcess = nullptr;
+
+    //! Whether pfnProcess can be called concurrently (THREAD_SAFE=YES
+    //! registration option)
+    bool bThreadSafe = false;
 };
 
 /************************************************************************/
@@ -83,23 +91,14 @@ GetGlobalMapProcessedDatasetFunc()
 }
 
 /************************************************************************/
-/*                            Step::~Step()                             */
-/************************************************************************/
-
-/*! @cond Doxygen_Suppress */
-
-/** Step destructor */
-VRTProcessedDataset::Step::~Step()
-{
-    deinit();
-}
-
-/************************************************************************/
-/*                           Step::deinit()                             */
+/*                           FreeWorkingData()                          */
 /************************************************************************/
 
-/** Free pWorkingData */
-void VRTProcessedDataset::Step::deinit()
+/** Free a working data structure returned by the init function of
+ * algorithm osAlgorithm.
+ */
+static void FreeWorkingData(const std::string &osAlgorithm,
+                            VRTPDWorkingDataPtr pWorkingData)
 {
     if (pWorkingData)
     {
@@ -118,10 +117,32 @@ void VRTProcessedDataset::Step::deinit()
         {
             CPLAssert(false);
         }
-        pWorkingData = nullptr;
     }
 }
 
+/************************************************************************/
+/*                            Step::~Step()                             */
+/************************************************************************/
+
+/*! @cond Doxygen_Suppress */
+
+/** Step destructor */
+VRTProcessedDataset::Step::~Step()
+{
+    deinit();
+}
+
+/************************************************************************/
+/*                           Step::deinit()                             */
+/************************************************************************/
+
+/** Free pWorkingData */
+void VRTProcessedDataset::Step::deinit()
+{
+    FreeWorkingData(osAlgorithm, pWorkingData);
+    pWorkingData = nullptr;
+}
+
 /************************************************************************/
 /*                        Step::Step(Step&& other)                      */
 /************************************************************************/
@@ -132,7 +153,10 @@ VRTProcessedDataset::Step::Step(Step &&other)
       aosArguments(std::move(other.aosArguments)), eInDT(other.eInDT),
       eOutDT(other.eOutDT), nInBands(other.nInBands),
       nOutBands(other.nOutBands), adfInNoData(other.adfInNoData),
-      adfOutNoData(other.adfOutNoData), pWorkingData(other.pWorkingData)
+      adfOutNoData(other.adfOutNoData),
+      adfInNoDataForInit(std::move(other.adfInNoDataForInit)),
+      adfOutNoDataForInit(std::move(other.adfOutNoDataForInit)),
+      pWorkingData(other.pWorkingData)
 {
     other.pWorkingData = nullptr;
 }
@@ -155,6 +179,8 @@ VRTProcessedDataset::Step &VRTProcessedDataset::Step::operator=(Step &&other)
         nOutBands = other.nOutBands;
         adfInNoData = std::move(other.adfInNoData);
         adfOutNoData = std::move(other.adfOutNoData);
+        adfInNoDataForInit = std::move(other.adfInNoDataForInit);
+        adfOutNoDataForInit = std::move(other.adfOutNoDataForInit);
         std::swap(pWorkingData, other.pWorkingData);
     }
     return *this;
@@ -179,6 +205,8 @@ VRTProcessedDataset::~VRTProcessedDataset()
 {
     VRTProcessedDataset::FlushCache(true);
     VRTProcessedDataset::CloseDependentDatasets();
+    for (auto &apWorkingData : m_aapWorkingDataPool)
+        FreeStepsWorkingData(apWorkingData);
 }
 
 /************************************************************************/
@@ -819,6 +847,9 @@ bool VRTProcessedDataset::ParseStep(const CPLXMLNode *psStep, bool bIsFinalStep,
 
     const auto &oFunc = oIterFunc->second;
 
+    if (!oFunc.bThreadSafe)
+        m_bStepsThreadSafe = false;
+
     if (!oFunc.aeSupportedInputDT.empty())
     {
         if (std::find(oFunc.aeSupportedInputDT.begin(),
@@ -1043,9 +1074,14 @@ bool VRTProcessedDataset::ParseStep(const CPLXMLNode *psStep, bool bIsFinalStep,
 
     if (oFunc.pfnInit)
     {
+        // Save initialization parameters, so that per-thread working data
+        // can be later created by ProcessStepsMultiThreaded()
+        oStep.adfInNoDataForInit = adfInNoData;
+
         double *padfOutNoData = nullptr;
         if (bIsFinalStep && !adfOutNoData.empty())
         {
+            oStep.adfOutNoDataForInit = adfOutNoData;
             oStep.nOutBands = static_cast<int>(adfOutNoData.size());
             padfOutNoData = static_cast<double *>(
                 CPLMalloc(adfOutNoData.size() * sizeof(double)));
@@ -1324,11 +1360,6 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
             return false;
     }
 
-    const double dfSrcXOff = nXOff;
-    const double dfSrcYOff = nYOff;
-    const double dfSrcXSize = nBufXSize;
-    const double dfSrcYSize = nBufYSize;
-
     double adfSrcGT[6];
     if (m_poSrcDS->GetGeoTransform(adfSrcGT) != CE_None)
     {
@@ -1340,7 +1371,58 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
         adfSrcGT[5] = 1;
     }
 
-    GDALDataType eLastDT = eFirstDT;
+    // Run the processing steps on row strips in parallel, for large enough
+    // regions, and if that does not consume too much RAM (each strip uses
+    // its own working buffers, in addition to the ones of the whole region)
+    constexpr int MINIMUM_PIXEL_COUNT_FOR_THREADED_PROCESSING = 1000 * 1000;
+    int nMaxThreads = 0;
+    if (m_bStepsThreadSafe &&
+        nPixelCount >= MINIMUM_PIXEL_COUNT_FOR_THREADED_PROCESSING &&
+        nBufYSize >= 2 &&
+        (m_nAllowedRAMUsage <= 0 ||
+         static_cast<GIntBig>(nPixelCount) <=
+             m_nAllowedRAMUsage / (2 * m_nWorkingBytesPerPixel)) &&
+        (nMaxThreads = VRTDataset::GetNumThreads(this)) > 1)
+    {
+        if (!ProcessStepsMultiThreaded(nXOff, nYOff, nBufXSize, nBufYSize,
+                                       adfSrcGT, nMaxThreads))
+        {
+            return false;
+        }
+        return !pfnProgress || pfnProgress(1.0, "", pProgressData);
+    }
+
+    return ProcessSteps(nullptr, nXOff, nYOff, nBufXSize, nBufYSize, adfSrcGT,
+                        abyInput, abyOutput, pfnProgress, pProgressData);
+}
+
+/************************************************************************/
+/*                            ProcessSteps()                            */
+/************************************************************************/
+
+/** Run all processing steps on the region (nXOff, nYOff, nBufXSize,
+ * nBufYSize), whose source pixel values are in abyInput, pixel-interleaved
+ * in the input data type of the first step.
+ *
+ * The output is stored in abyInput in a pixel-interleaved way.
+ *
+ * @param papWorkingData Working data structures to use for each step, or
+ *                       nullptr to use the ones of m_aoSteps.
+ */
+bool VRTProcessedDataset::ProcessSteps(
+    const std::vector<VRTPDWorkingDataPtr> *papWorkingData, int nXOff,
+    int nYOff, int nBufXSize, int nBufYSize, const double adfSrcGT[],
+    std::vector<NoInitByte> &abyInput, std::vector<NoInitByte> &abyOutput,
+    GDALProgressFunc pfnProgress, void *pProgressData) const
+{
+    const size_t nPixelCount = static_cast<size_t>(nBufXSize) * nBufYSize;
+
+    const double dfSrcXOff = nXOff;
+    const double dfSrcYOff = nYOff;
+    const double dfSrcXSize = nBufXSize;
+    const double dfSrcYSize = nBufYSize;
+
+    GDALDataType eLastDT = m_aoSteps.front().eInDT;
     const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
 
     int iStep = 0;
@@ -1385,8 +1467,10 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
         }
 
         const auto &oFunc = oIterFunc->second;
+        VRTPDWorkingDataPtr pWorkingData =
+            papWorkingData ? (*papWorkingData)[iStep] : oStep.pWorkingData;
         if (oFunc.pfnProcess(
-                oStep.osAlgorithm.c_str(), oFunc.pUserData, oStep.pWorkingData,
+                oStep.osAlgorithm.c_str(), oFunc.pUserData, pWorkingData,
                 oStep.aosArguments.List(), nBufXSize, nBufYSize,
                 abyInput.data(), abyInput.size(), oStep.eInDT, oStep.nInBands,
                 oStep.adfInNoData.data(), abyOutput.data(), abyOutput.size(),
@@ -1411,6 +1495,244 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
     return true;
 }
 
+/************************************************************************/
+/*                       CreateStepsWorkingData()                       */
+/************************************************************************/
+
+/** Create a new instance of the working data structure of each step, by
+ * calling again the init function of the algorithms with the parameters
+ * used by ParseStep().
+ *
+ * Steps that have no working data get a nullptr entry. The result must be
+ * freed with FreeStepsWorkingData(), even on failure.
+ */
+bool VRTProcessedDataset::CreateStepsWorkingData(
+    std::vector<VRTPDWorkingDataPtr> &apWorkingData) const
+{
+    const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
+    apWorkingData.clear();
+    for (const auto &oStep : m_aoSteps)
+    {
+        apWorkingData.push_back(nullptr);
+        if (!oStep.pWorkingData)
+            continue;
+
+        const auto oIterFunc = oMapFunctions.find(oStep.osAlgorithm);
+        CPLAssert(oIterFunc != oMapFunctions.end());
+        const auto &oFunc = oIterFunc->second;
+        CPLAssert(oFunc.pfnInit);
+
+        std::vector<double> adfInNoData(oStep.adfInNoDataForInit);
+        int nOutBands = static_cast<int>(oStep.adfOutNoDataForInit.size());
+        GDALDataType eOutDT = oStep.eInDT;
+        double *padfOutNoData = nullptr;
+        if (!oStep.adfOutNoDataForInit.empty())
+        {
+            padfOutNoData = static_cast<double *>(
+                CPLMalloc(oStep.adfOutNoDataForInit.size() * sizeof(double)));
+            memcpy(padfOutNoData, oStep.adfOutNoDataForInit.data(),
+                   oStep.adfOutNoDataForInit.size() * sizeof(double));
+        }
+
+        const bool bOK =
+            oFunc.pfnInit(oStep.osAlgorithm.c_str(), oFunc.pUserData,
+                          oStep.aosArguments.List(), oStep.nInBands,
+                          oStep.eInDT, adfInNoData.data(), &nOutBands, &eOutDT,
+                          &padfOutNoData, m_osVRTPath.c_str(),
+                          &(apWorkingData.back())) == CE_None;
+        CPLFree(padfOutNoData);
+        if (!bOK)
+            return false;
+        if (nOutBands != oStep.nOutBands || eOutDT != oStep.eOutDT)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Algorithm '%s': init() function returned inconsistent "
+                     "results between invocations",
+                     oStep.osAlgorithm.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        FreeStepsWorkingData()                        */
+/************************************************************************/
+
+/** Free working data structures created by CreateStepsWorkingData() */
+void VRTProcessedDataset::FreeStepsWorkingData(
+    std::vector<VRTPDWorkingDataPtr> &apWorkingData) const
+{
+    for (size_t i = 0; i < apWorkingData.size(); ++i)
+    {
+        FreeWorkingData(m_aoSteps[i].osAlgorithm, apWorkingData[i]);
+    }
+    apWorkingData.clear();
+}
+
+/************************************************************************/
+/*                      ProcessStepsMultiThreaded()                     */
+/************************************************************************/
+
+/** Same as ProcessSteps() on the region (nXOff, nYOff, nBufXSize,
+ * nBufYSize), whose source pixel values are in m_abyInput, except that the
+ * region is split into strips of rows, aligned on the block height when
+ * possible, processed in parallel.
+ *
+ * Each strip is processed with its own working buffers and its own working
+ * data structures, since the ones of m_aoSteps are not necessarily
+ * thread-safe (they may for example hold dataset handles). Those working
+ * data structures are kept in m_aapWorkingDataPool to be reused by later
+ * calls.
+ *
+ * Must only be called if all steps use algorithms registered with the
+ * THREAD_SAFE=YES option.
+ *
+ * The output is stored in m_abyInput in a pixel-interleaved way.
+ */
+bool VRTProcessedDataset::ProcessStepsMultiThreaded(int nXOff, int nYOff,
+                                                    int nBufXSize,
+                                                    int nBufYSize,
+                                                    const double adfSrcGT[],
+                                                    int nMaxThreads)
+{
+    // Compute the limits of the strips
+    const int nTargetStrips = std::min(nMaxThreads, nBufYSize);
+    std::vector<int> anStripYOff{0};
+    for (int i = 1; i < nTargetStrips; ++i)
+    {
+        int nY = static_cast<int>(static_cast<int64_t>(nBufYSize) * i /
+                                  nTargetStrips);
+        const int nAlignedY =
+            (nYOff + nY) / m_nBlockYSize * m_nBlockYSize - nYOff;
+        if (nAlignedY > anStripYOff.back())
+            nY = nAlignedY;
+        if (nY > anStripYOff.back())
+            anStripYOff.push_back(nY);
+    }
+    anStripYOff.push_back(nBufYSize);
+    const int nStrips = static_cast<int>(anStripYOff.size()) - 1;
+
+    CPLWorkerThreadPool *poThreadPool =
+        nStrips > 1 ? GDALGetGlobalThreadPool(nStrips) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+    {
+        return ProcessSteps(nullptr, nXOff, nYOff, nBufXSize, nBufYSize,
+                            adfSrcGT, m_abyInput, m_abyOutput, nullptr,
+                            nullptr);
+    }
+
+    CPLDebugOnly("VRT",
+                 "ProcessRegion(): processing %d strips of rows in parallel",
+                 nStrips);
+
+    const auto &oFirstStep = m_aoSteps.front();
+    const auto &oLastStep = m_aoSteps.back();
+    const size_t nInBytesPerPixel =
+        static_cast<size_t>(oFirstStep.nInBands) *
+        GDALGetDataTypeSizeBytes(oFirstStep.eInDT);
+    const size_t nOutBytesPerPixel =
+        static_cast<size_t>(oLastStep.nOutBands) *
+        GDALGetDataTypeSizeBytes(oLastStep.eOutDT);
+    const size_t nPixelCount = static_cast<size_t>(nBufXSize) * nBufYSize;
+
+    std::vector<NoInitByte> abyFinalOutput;
+    try
+    {
+        abyFinalOutput.resize(nPixelCount * nOutBytesPerPixel);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating working buffer");
+        return false;
+    }
+
+    CPLErrorAccumulator oErrorAccumulator;
+    std::atomic<bool> bSuccess = true;
+    for (int iStrip = 0; iStrip < nStrips; ++iStrip)
+    {
+        const int nStripYOff = anStripYOff[iStrip];
+        const int nStripYSize = anStripYOff[iStrip + 1] - nStripYOff;
+        const auto job = [this, nXOff, nYOff, nBufXSize, nStripYOff,
+                          nStripYSize, adfSrcGT, nInBytesPerPixel,
+                          nOutBytesPerPixel, &abyFinalOutput,
+                          &oErrorAccumulator, &bSuccess]()
+        {
+            if (!bSuccess)
+                return;
+
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            const size_t nStripPixelOff =
+                static_cast<size_t>(nStripYOff) * nBufXSize;
+            const size_t nStripPixelCount =
+                static_cast<size_t>(nStripYSize) * nBufXSize;
+            std::vector<NoInitByte> abyInput;
+            std::vector<NoInitByte> abyOutput;
+            try
+            {
+                abyInput.resize(nStripPixelCount * nInBytesPerPixel);
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory allocating working buffer");
+                bSuccess = false;
+                return;
+            }
+            memcpy(abyInput.data(),
+                   m_abyInput.data() + nStripPixelOff * nInBytesPerPixel,
+                   abyInput.size());
+
+            std::vector<VRTPDWorkingDataPtr> apWorkingData;
+            {
+                std::lock_guard oLock(m_oWorkingDataPoolMutex);
+                if (!m_aapWorkingDataPool.empty())
+                {
+                    apWorkingData = std::move(m_aapWorkingDataPool.back());
+                    m_aapWorkingDataPool.pop_back();
+                }
+            }
+            const bool bOK =
+                (!apWorkingData.empty() ||
+                 CreateStepsWorkingData(apWorkingData)) &&
+                ProcessSteps(&apWorkingData, nXOff, nYOff + nStripYOff,
+                             nBufXSize, nStripYSize, adfSrcGT, abyInput,
+                             abyOutput, nullptr, nullptr);
+            if (!bOK)
+            {
+                FreeStepsWorkingData(apWorkingData);
+                bSuccess = false;
+                return;
+            }
+            {
+                std::lock_guard oLock(m_oWorkingDataPoolMutex);
+                m_aapWorkingDataPool.push_back(std::move(apWorkingData));
+            }
+
+            CPLAssert(abyInput.size() == nStripPixelCount * nOutBytesPerPixel);
+            memcpy(abyFinalOutput.data() + nStripPixelOff * nOutBytesPerPixel,
+                   abyInput.data(), nStripPixelCount * nOutBytesPerPixel);
+        };
+        if (!poQueue->SubmitJob(job))
+        {
+            bSuccess = false;
+            break;
+        }
+    }
+    poQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    if (!bSuccess)
+        return false;
+
+    std::swap(m_abyInput, abyFinalOutput);
+    return true;
+}
+
 /************************************************************************/
 /*                        VRTProcessedRasterBand()                      */
 /************************************************************************/
@@ -1741,7 +2063,15 @@ CPLErr VRTProcessedDataset::IRasterIO(
                 by pfnInit. May be nullptr.
  @param pfnProcess Processing function called to compute pixel values. Must
                    not be nullptr.
- @param papszOptions Unused currently. Must be nullptr.
+                   It is never called concurrently, unless the
+                   THREAD_SAFE=YES option is set in papszOptions.
+ @param papszOptions NULL terminated list of options, or nullptr.
+                     Starting with GDAL 3.12, THREAD_SAFE=YES may be set to
+                     indicate that pfnProcess may be called concurrently
+                     from several threads (sharing pUserData), on different
+                     row strips of a large region. Each thread then uses its
+                     own working structure, obtained by calling pfnInit
+                     again with the same arguments.
  @return CE_None in case of success, error otherwise.
  @since 3.9
  */
@@ -1752,8 +2082,7 @@ CPLErr GDALVRTRegisterProcessedDatasetFunc(
     size_t nSupportedInputBandCountSize,
     GDALVRTProcessedDatasetFuncInit pfnInit,
     GDALVRTProcessedDatasetFuncFree pfnFree,
-    GDALVRTProcessedDatasetFuncProcess pfnProcess,
-    CPL_UNUSED CSLConstList papszOptions)
+    GDALVRTProcessedDatasetFuncProcess pfnProcess, CSLConstList papszOptions)
 {
     if (pszFuncName == nullptr || pszFuncName[0] == '\0')
     {
@@ -1779,6 +2108,8 @@ CPLErr GDALVRTRegisterProcessedDatasetFunc(
     VRTProcessedDatasetFunc oFunc;
     oFunc.osFuncName = pszFuncName;
     oFunc.pUserData = pUserData;
+    oFunc.bThreadSafe =
+        CPLFetchBool(papszOptions, "THREAD_SAFE", /* bDefault = */ false);
     if (pszXMLMetadata)
     {
         oFunc.bMetadataSpecified = true;
@@ -1754,6 +1754,10 @@ static CPLErr ExpressionProcess(
  */
 void GDALVRTRegisterDefaultProcessedDatasetFuncs()
 {
+    // All builtin functions support concurrent calls to their pfnProcess
+    // callback, with distinct working structures.
+    const char *const apszOptions[] = {"THREAD_SAFE=YES", nullptr};
+
     GDALVRTRegisterProcessedDatasetFunc(
         "BandAffineCombination", nullptr,
         "<ProcessedDatasetFunctionArgumentsList>"
@@ -1775,7 +1779,7 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "   <Argument name='max' description='clamp max value' type='double'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, BandAffineCombinationInit,
-        BandAffineCombinationFree, BandAffineCombinationProcess, nullptr);
+        BandAffineCombinationFree, BandAffineCombinationProcess, apszOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "LUT", nullptr,
@@ -1790,7 +1794,7 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "type='string' required='true'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, LUTInit, LUTFree, LUTProcess,
-        nullptr);
+        apszOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "LocalScaleOffset", nullptr,
@@ -1820,7 +1824,7 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "description='Override offset dataset nodata value'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, LocalScaleOffsetInit,
-        LocalScaleOffsetFree, LocalScaleOffsetProcess, nullptr);
+        LocalScaleOffsetFree, LocalScaleOffsetProcess, apszOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "Trimming", nullptr,
@@ -1850,7 +1854,7 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "description='Override trimming dataset nodata value'/>"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, TrimmingInit, TrimmingFree,
-        TrimmingProcess, nullptr);
+        TrimmingProcess, apszOptions);
 
     GDALVRTRegisterProcessedDatasetFunc(
         "Expression", nullptr,
@@ -1863,5 +1867,5 @@ void GDALVRTRegisterDefaultProcessedDatasetFuncs()
         "type='integer' />"
         "</ProcessedDatasetFunctionArgumentsList>",
         GDT_Float64, nullptr, 0, nullptr, 0, ExpressionInit, ExpressionFree,
-        ExpressionProcess, nullptr);
+        ExpressionProcess, apszOptions);
 }
@@ -18,6 +18,7 @@
 #include "webpdrivercore.h"
 
 #include <limits>
+#include <vector>
 
 /************************************************************************/
 /* ==================================================================== */
@@ -1069,6 +1070,238 @@ GDALDataset *WEBPDataset::CreateCopy(const char *pszFilename,
     return nullptr;
 }
 
+/************************************************************************/
+/*                          WEBPDecodeImage()                           */
+/************************************************************************/
+
+static bool WEBPDecodeImage(const void *pSrc, size_t nSrcSize,
+                            CSLConstList papszOptions,
+                            GDALDecodedImage &sImage)
+{
+    const uint8_t *pabySrc = static_cast<const uint8_t *>(pSrc);
+    if (nSrcSize < 16 || memcmp(pabySrc, "RIFF", 4) != 0 ||
+        memcmp(pabySrc + 8, "WEBP", 4) != 0 ||
+        nSrcSize > std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+    const uint32_t nSize = static_cast<uint32_t>(nSrcSize);
+
+    int nWidth = 0;
+    int nHeight = 0;
+    if (!WebPGetInfo(pabySrc, nSize, &nWidth, &nHeight))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "WebPGetInfo() failed");
+        return false;
+    }
+    if (!GDALCheckDecodedImageSize(nWidth, nHeight, papszOptions))
+        return false;
+
+    int nBands = 3;
+#if WEBP_DECODER_ABI_VERSION >= 0x0002
+    WebPBitstreamFeatures sFeatures;
+    if (WebPGetFeatures(pabySrc, nSize, &sFeatures) != VP8_STATUS_OK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "WebPGetFeatures() failed");
+        return false;
+    }
+    if (sFeatures.has_alpha)
+        nBands = 4;
+#endif
+
+    const size_t nBandSize = static_cast<size_t>(nWidth) * nHeight;
+    std::vector<GByte> abyInterleaved;
+    try
+    {
+        abyInterleaved.resize(nBandSize * nBands);
+        sImage.abyData.resize(nBandSize * nBands);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory when decoding WEBP image");
+        return false;
+    }
+
+    const uint8_t *pRet =
+        nBands == 4
+            ? WebPDecodeRGBAInto(pabySrc, nSize, abyInterleaved.data(),
+                                 abyInterleaved.size(), nWidth * nBands)
+            : WebPDecodeRGBInto(pabySrc, nSize, abyInterleaved.data(),
+                                abyInterleaved.size(), nWidth * nBands);
+    if (pRet == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "WebPDecodeRGBInto() failed");
+        return false;
+    }
+
+    void *apDstBands[4] = {nullptr, nullptr, nullptr, nullptr};
+    for (int iBand = 0; iBand < nBands; ++iBand)
+        apDstBands[iBand] = sImage.abyData.data() + iBand * nBandSize;
+    GDALDeinterleave(abyInterleaved.data(), GDT_Byte, nBands, apDstBands,
+                     GDT_Byte, nBandSize);
+
+    sImage.nXSize = nWidth;
+    sImage.nYSize = nHeight;
+    sImage.nBands = nBands;
+    sImage.eDT = GDT_Byte;
+    sImage.poColorTable.reset();
+    return true;
+}
+
+/************************************************************************/
+/*                          WEBPMemoryWriter()                          */
+/************************************************************************/
+
+static int WEBPMemoryWriter(const uint8_t *data, size_t data_size,
+                            const WebPPicture *const picture)
+{
+    auto pabyOut = static_cast<std::vector<GByte> *>(picture->custom_ptr);
+    try
+    {
+        pabyOut->insert(pabyOut->end(), data, data + data_size);
+    }
+    catch (const std::exception &)
+    {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/************************************************************************/
+/*                          WEBPEncodeImage()                           */
+/************************************************************************/
+
+static bool WEBPEncodeImage(int nXSize, int nYSize, int nBands,
+                            GDALDataType eDT, const void *const *papBandData,
+                            const GDALColorTable *poColorTable,
+                            CSLConstList papszOptions,
+                            std::vector<GByte> &abyOut)
+{
+    if (eDT != GDT_Byte || poColorTable ||
+        (nBands != 3
+#if WEBP_ENCODER_ABI_VERSION >= 0x0100
+         && nBands != 4
+#endif
+         ))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "WEBP EncodeImage() only supports RGB or RGBA Byte images");
+        return false;
+    }
+    if (nXSize > 16383 || nYSize > 16383)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "WEBP maximum image dimensions are 16383 x 16383.");
+        return false;
+    }
+
+    float fQuality = 75.0f;
+    const char *pszQUALITY = CSLFetchNameValue(papszOptions, "QUALITY");
+    if (pszQUALITY != nullptr)
+    {
+        fQuality = static_cast<float>(CPLAtof(pszQUALITY));
+        if (fQuality < 0.0f || fQuality > 100.0f)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg, "%s=%s is not a legal value.",
+                     "QUALITY", pszQUALITY);
+            return false;
+        }
+    }
+
+    WebPConfig sConfig;
+    if (!WebPConfigInitInternal(&sConfig, WEBP_PRESET_DEFAULT, fQuality,
+                                WEBP_ENCODER_ABI_VERSION))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "WebPConfigInit() failed");
+        return false;
+    }
+
+    WebPPicture sPicture;
+    if (!WebPPictureInit(&sPicture))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "WebPPictureInit() failed");
+        return false;
+    }
+#if WEBP_ENCODER_ABI_VERSION >= 0x0100
+    sConfig.lossless = CPLFetchBool(papszOptions, "LOSSLESS", false);
+    if (sConfig.lossless)
+        sPicture.use_argb = 1;
+#endif
+    if (!WebPValidateConfig(&sConfig))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "WebPValidateConfig() failed");
+        return false;
+    }
+
+    const size_t nBandSize = static_cast<size_t>(nXSize) * nYSize;
+    std::vector<GByte> abyInterleaved;
+    try
+    {
+        abyInterleaved.resize(nBandSize * nBands);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory when encoding WEBP image");
+        return false;
+    }
+    for (int iBand = 0; iBand < nBands; ++iBand)
+    {
+        GDALCopyWords64(papBandData[iBand], GDT_Byte, 1,
+                        abyInterleaved.data() + iBand, GDT_Byte, nBands,
+                        nBandSize);
+    }
+
+    abyOut.clear();
+    sPicture.width = nXSize;
+    sPicture.height = nYSize;
+    sPicture.writer = WEBPMemoryWriter;
+    sPicture.custom_ptr = &abyOut;
+    if (!WebPPictureAlloc(&sPicture))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "WebPPictureAlloc() failed");
+        return false;
+    }
+
+    bool bRet = true;
+#if WEBP_ENCODER_ABI_VERSION >= 0x0100
+    if (nBands == 4)
+    {
+        if (!WebPPictureImportRGBA(&sPicture, abyInterleaved.data(),
+                                   nBands * nXSize))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "WebPPictureImportRGBA() failed");
+            bRet = false;
+        }
+    }
+    else
+#endif
+        if (!WebPPictureImportRGB(&sPicture, abyInterleaved.data(),
+                                  nBands * nXSize))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "WebPPictureImportRGB() failed");
+        bRet = false;
+    }
+
+    if (bRet && !WebPEncode(&sConfig, &sPicture))
+    {
+#if WEBP_ENCODER_ABI_VERSION >= 0x0100
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "WebPEncode() failed with error code %d",
+                 sPicture.error_code);
+#else
+        CPLError(CE_Failure, CPLE_AppDefined, "WebPEncode() failed");
+#endif
+        bRet = false;
+    }
+
+    WebPPictureFree(&sPicture);
+
+    return bRet;
+}
+
 /************************************************************************/
 /*                         GDALRegister_WEBP()                          */
 /************************************************************************/
@@ -1084,6 +1317,8 @@ void GDALRegister_WEBP()
 
     poDriver->pfnOpen = WEBPDataset::Open;
     poDriver->pfnCreateCopy = WEBPDataset::CreateCopy;
+    poDriver->pfnDecodeImage = WEBPDecodeImage;
+    poDriver->pfnEncodeImage = WEBPEncodeImage;
 
     GetGDALDriverManager()->RegisterDriver(poDriver);
 }
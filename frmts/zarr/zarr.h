@@ -15,11 +15,15 @@
 
 #include "cpl_compressor.h"
 #include "cpl_json.h"
+#include "cpl_mem_cache.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
 #include "memmultidim.h"
 
 #include <array>
+#include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -801,6 +805,16 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     mutable std::map<uint64_t, CachedTile> m_oMapTileIndexToCachedTile{};
 
+    // Write-behind queue in which encoding and writing of dirty tiles is
+    // done by worker threads. Only used when NUM_THREADS > 1.
+    mutable bool m_bTileWriteQueueInitDone = false;
+    mutable std::unique_ptr<CPLJobQueue> m_poTileWriteQueue{};
+    mutable size_t m_nTileWriteQueueMaxMemory = 0;
+    // Below members are protected by m_oMutex
+    mutable size_t m_nTileWriteQueueMemory = 0;
+    mutable std::set<std::string> m_oSetTileWriteQueueFilenames{};
+    mutable bool m_bTileWriteQueueError = false;
+
     static uint64_t
     ComputeTileCount(const std::string &osName,
                      const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -832,6 +846,15 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     virtual bool FlushDirtyTile() const = 0;
 
+    CPLJobQueue *GetTileWriteQueue() const;
+
+    bool SubmitTileWrite(const std::string &osFilename, size_t nMemory,
+                         std::function<bool()> &&task) const;
+
+    bool WaitTileWrites() const;
+
+    bool WaitTileWrite(const uint64_t *tileIndices) const;
+
     std::shared_ptr<GDALMDArray> OpenTilePresenceCache(bool bCanCreate) const;
 
     void NotifyChildrenOfRenaming() override;
@@ -1102,6 +1125,14 @@ class ZarrV2Array final : public ZarrArray
                            ZarrByteVectorQuickResize &abyTmpRawTileData,
                            ZarrByteVectorQuickResize &abyDecodedTileData) const;
 
+    bool EncodeAndWriteTile(
+        const std::string &osFilename,
+        const std::vector<std::pair<const CPLCompressor *, CPLStringList>>
+            &aoFilters,
+        const CPLStringList &aosCompressorOptions,
+        ZarrByteVectorQuickResize &abyRawTileData,
+        ZarrByteVectorQuickResize &abyTmpRawTileData) const;
+
     // Disable copy constructor and assignment operator
     ZarrV2Array(const ZarrV2Array &) = delete;
     ZarrV2Array &operator=(const ZarrV2Array &) = delete;
@@ -1429,10 +1460,47 @@ class ZarrV3CodecTranspose final : public ZarrV3Codec
                 ZarrByteVectorQuickResize &abyDst) const override;
 };
 
+/************************************************************************/
+/*                           ZarrV3CodecCRC32C                          */
+/************************************************************************/
+
+// Implements https://zarr-specs.readthedocs.io/en/latest/v3/codecs/crc32c/index.html
+class ZarrV3CodecCRC32C final : public ZarrV3Codec
+{
+  public:
+    static constexpr const char *NAME = "crc32c";
+
+    ZarrV3CodecCRC32C();
+
+    IOType GetInputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+};
+
 /************************************************************************/
 /*                          ZarrV3CodecSequence                         */
 /************************************************************************/
 
+class ZarrV3CodecShardingIndexed;
+
 class ZarrV3CodecSequence
 {
     const ZarrArrayMetadata m_oInputArrayMetadata;
@@ -1460,6 +1528,94 @@ class ZarrV3CodecSequence
 
     bool Encode(ZarrByteVectorQuickResize &abyBuffer);
     bool Decode(ZarrByteVectorQuickResize &abyBuffer);
+
+    // Returns the sharding_indexed codec if the sequence is made of it
+    ZarrV3CodecShardingIndexed *GetShardingCodec() const;
+};
+
+/************************************************************************/
+/*                      ZarrV3CodecShardingIndexed                      */
+/************************************************************************/
+
+// Implements https://zarr-specs.readthedocs.io/en/latest/v3/codecs/sharding-indexed/index.html
+// Shards are not encoded or decoded as a whole: ZarrV3Array reads and
+// writes inner chunks, and uses this class to decode and encode the index.
+class ZarrV3CodecShardingIndexed final : public ZarrV3Codec
+{
+    std::vector<size_t> m_anInnerBlockSize{};
+    size_t m_nInnerChunkCount = 0;
+    std::unique_ptr<ZarrV3CodecSequence> m_poInnerCodecs{};
+    std::unique_ptr<ZarrV3CodecSequence> m_poIndexCodecs{};
+    size_t m_nEncodedIndexSize = 0;
+    bool m_bIndexAtEnd = true;
+
+  public:
+    static constexpr const char *NAME = "sharding_indexed";
+
+    // Value of the offset and nbytes of a missing inner chunk in the index
+    static constexpr uint64_t MISSING_CHUNK =
+        std::numeric_limits<uint64_t>::max();
+
+    ZarrV3CodecShardingIndexed();
+    ~ZarrV3CodecShardingIndexed() override;
+
+    IOType GetInputType() const override
+    {
+        return IOType::ARRAY;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    static CPLJSONObject
+    GetConfiguration(const std::vector<GUInt64> &anInnerBlockSize,
+                     const CPLJSONArray &oInnerCodecs);
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+
+    const std::vector<size_t> &GetInnerBlockSize() const
+    {
+        return m_anInnerBlockSize;
+    }
+
+    size_t GetInnerChunkCount() const
+    {
+        return m_nInnerChunkCount;
+    }
+
+    ZarrV3CodecSequence *GetInnerCodecs() const
+    {
+        return m_poInnerCodecs.get();
+    }
+
+    bool IsIndexAtEnd() const
+    {
+        return m_bIndexAtEnd;
+    }
+
+    size_t GetEncodedIndexSize() const
+    {
+        return m_nEncodedIndexSize;
+    }
+
+    // anIndex[2 * i] and anIndex[2 * i + 1] are the offset and size of
+    // the i-th inner chunk, in C order.
+    bool DecodeIndex(ZarrByteVectorQuickResize &abyIndex,
+                     std::vector<uint64_t> &anIndex);
+    bool EncodeIndex(const std::vector<uint64_t> &anIndex,
+                     ZarrByteVectorQuickResize &abyIndex);
 };
 
 /************************************************************************/
@@ -1471,6 +1627,28 @@ class ZarrV3Array final : public ZarrArray
     bool m_bV2ChunkKeyEncoding = false;
     std::unique_ptr<ZarrV3CodecSequence> m_poCodecs{};
 
+    // Shape of the shards when the sharding_indexed codec is used, in which
+    // case m_anBlockSize is the shape of the inner chunks. Empty otherwise.
+    std::vector<GUInt64> m_anShardSize{};
+
+    // Decoded index of recently accessed shards, keyed by filename. A null
+    // pointer means a missing shard. Protected by m_oMutex.
+    mutable lru11::Cache<std::string,
+                         std::shared_ptr<const std::vector<uint64_t>>>
+        m_oShardIndexCache{};
+
+    // Encoded inner chunks not yet written, keyed by shard indices and
+    // index of the inner chunk in the shard. An empty vector means a
+    // missing chunk. Only modified by the writing thread, with m_oMutex
+    // held. Other threads must hold m_oMutex to access it.
+    mutable std::map<std::vector<uint64_t>,
+                     std::map<size_t, std::vector<GByte>>>
+        m_oMapPendingShards{};
+
+    // Codec sequences available for tile write jobs. Protected by m_oMutex
+    mutable std::vector<std::shared_ptr<ZarrV3CodecSequence>>
+        m_apoTileWriteCodecs{};
+
     ZarrV3Array(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
                 const std::string &osParentName, const std::string &osName,
                 const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -1492,6 +1670,52 @@ class ZarrV3Array final : public ZarrArray
                       ZarrByteVectorQuickResize &abyDecodedTileData,
                       bool &bMissingTileOut) const;
 
+    VSILFILE *OpenChunkFile(const std::string &osFilename,
+                            bool &bMissingOut) const;
+
+    std::string BuildChunkFilename(const uint64_t *chunkIndices) const;
+
+    bool IsSharded() const
+    {
+        return !m_anShardSize.empty();
+    }
+
+    void GetShardIndices(const uint64_t *tileIndices,
+                         std::vector<uint64_t> &anShardIndices,
+                         size_t &nInnerChunkIdx) const;
+
+    bool GetShardIndex(const std::string &osFilename, bool bUseMutex,
+                       ZarrV3CodecShardingIndexed *poShardingCodec,
+                       std::shared_ptr<const std::vector<uint64_t>> &panIndex)
+        const;
+
+    bool ReadShardChunks(const std::string &osFilename,
+                         const std::vector<uint64_t> &anIndex,
+                         const std::vector<size_t> &anInnerChunkIdx,
+                         std::vector<std::vector<GByte>> &aabyChunks) const;
+
+    bool ReadInnerChunks(const uint64_t *tileIndices, size_t nTiles,
+                         bool bUseMutex,
+                         ZarrV3CodecShardingIndexed *poShardingCodec,
+                         std::vector<std::vector<GByte>> &aabyChunks) const;
+
+    bool DecodeInnerChunk(ZarrV3CodecShardingIndexed *poShardingCodec,
+                          const std::vector<GByte> &abyChunk,
+                          ZarrByteVectorQuickResize &abyRawTileData,
+                          ZarrByteVectorQuickResize &abyDecodedTileData) const;
+
+    bool AddPendingInnerChunk(const uint64_t *tileIndices,
+                              const GByte *pabyData, size_t nSize) const;
+
+    bool WriteShard(const std::vector<uint64_t> &anShardIndices,
+                    std::map<size_t, std::vector<GByte>> &oChunks) const;
+
+    bool FlushPendingShards() const;
+
+    bool EncodeAndWriteTile(const std::string &osFilename,
+                            ZarrV3CodecSequence *poCodecs,
+                            ZarrByteVectorQuickResize &abyRawTileData) const;
+
   public:
     ~ZarrV3Array() override;
 
@@ -1513,6 +1737,11 @@ class ZarrV3Array final : public ZarrArray
         m_poCodecs = std::move(poCodecs);
     }
 
+    void SetShardSize(const std::vector<GUInt64> &anShardSize)
+    {
+        m_anShardSize = anShardSize;
+    }
+
     void Flush() override;
 
   protected:
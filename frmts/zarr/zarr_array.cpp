@@ -14,6 +14,7 @@
 #include "ucs4_utf8.hpp"
 
 #include "cpl_float.h"
+#include "gdal_thread_pool.h"
 
 #include "netcdf_cf_constants.h"  // for CF_UNITS, etc
 
@@ -199,6 +200,160 @@ ZarrArray::~ZarrArray()
     DeallocateDecodedTileData();
 }
 
+/************************************************************************/
+/*                    ZarrArray::GetTileWriteQueue()                    */
+/************************************************************************/
+
+// Returns the queue in which dirty tiles should be encoded and written, or
+// nullptr if they must be synchronously written.
+CPLJobQueue *ZarrArray::GetTileWriteQueue() const
+{
+    if (m_bTileWriteQueueInitDone)
+        return m_poTileWriteQueue.get();
+    m_bTileWriteQueueInitDone = true;
+
+    const char *pszNumThreads =
+        m_poSharedResource->GetOpenOptions().FetchNameValueDef(
+            "NUM_THREADS", CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    int nThreads;
+    if (EQUAL(pszNumThreads, "ALL_CPUS"))
+        nThreads = CPLGetNumCPUs();
+    else
+        nThreads = std::max(1, atoi(pszNumThreads));
+    nThreads = std::min(nThreads, 1024);
+    if (nThreads <= 1)
+        return nullptr;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return nullptr;
+    m_poTileWriteQueue = poThreadPool->CreateJobQueue();
+
+    const char *pszMaxMemory =
+        CPLGetConfigOption("GDAL_ZARR_WRITE_QUEUE_MAX_MEMORY", nullptr);
+    m_nTileWriteQueueMaxMemory =
+        pszMaxMemory ? static_cast<size_t>(std::strtoull(pszMaxMemory,
+                                                         nullptr, 10))
+                     : static_cast<size_t>(std::min<GIntBig>(
+                           GDALGetCacheMax64() / 4,
+                           std::numeric_limits<size_t>::max()));
+    CPLDebug(ZARR_DEBUG_KEY,
+             "Using up to %d threads and " CPL_FRMT_GUIB
+             " bytes for writing tiles of %s",
+             nThreads, static_cast<GUIntBig>(m_nTileWriteQueueMaxMemory),
+             GetFullName().c_str());
+    return m_poTileWriteQueue.get();
+}
+
+/************************************************************************/
+/*                     ZarrArray::SubmitTileWrite()                     */
+/************************************************************************/
+
+// Queues a task that encodes and writes tile osFilename, and uses nMemory
+// bytes until it has completed. The task is responsible for emitting an
+// error when returning false.
+bool ZarrArray::SubmitTileWrite(const std::string &osFilename, size_t nMemory,
+                                std::function<bool()> &&task) const
+{
+    auto poQueue = m_poTileWriteQueue.get();
+    CPLAssert(poQueue);
+
+    // Do not let 2 jobs write the same file concurrently
+    bool bPendingWrite;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        bPendingWrite =
+            cpl::contains(m_oSetTileWriteQueueFilenames, osFilename);
+    }
+    if (bPendingWrite && !WaitTileWrites())
+        return false;
+
+    // Wait for enough jobs to have completed to fit within the memory budget
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        while (m_nTileWriteQueueMemory > 0 &&
+               m_nTileWriteQueueMemory + nMemory > m_nTileWriteQueueMaxMemory)
+        {
+            oLock.unlock();
+            poQueue->WaitEvent();
+            oLock.lock();
+        }
+        if (m_bTileWriteQueueError)
+        {
+            m_bTileWriteQueueError = false;
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Writing of a previous tile of %s failed",
+                     GetFullName().c_str());
+            return false;
+        }
+        m_nTileWriteQueueMemory += nMemory;
+        m_oSetTileWriteQueueFilenames.insert(osFilename);
+    }
+
+    const auto taskWrapper = [this, osFilename, nMemory, task]()
+    {
+        const bool bRet = task();
+
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_nTileWriteQueueMemory -= nMemory;
+        m_oSetTileWriteQueueFilenames.erase(osFilename);
+        if (!bRet)
+            m_bTileWriteQueueError = true;
+    };
+    if (!poQueue->SubmitJob(taskWrapper))
+    {
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            m_nTileWriteQueueMemory -= nMemory;
+            m_oSetTileWriteQueueFilenames.erase(osFilename);
+        }
+        // Fallback to synchronous execution
+        return task();
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      ZarrArray::WaitTileWrites()                     */
+/************************************************************************/
+
+// Waits for all queued tile writes to be completed, and returns false if
+// any of them failed.
+bool ZarrArray::WaitTileWrites() const
+{
+    if (!m_poTileWriteQueue)
+        return true;
+    m_poTileWriteQueue->WaitCompletion();
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    if (m_bTileWriteQueueError)
+    {
+        m_bTileWriteQueueError = false;
+        CPLError(CE_Failure, CPLE_AppDefined, "Writing of a tile of %s failed",
+                 GetFullName().c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      ZarrArray::WaitTileWrite()                      */
+/************************************************************************/
+
+// Waits for the completion of the queued writing of a tile, if any.
+bool ZarrArray::WaitTileWrite(const uint64_t *tileIndices) const
+{
+    if (!m_poTileWriteQueue)
+        return true;
+    const std::string osFilename = BuildTileFilename(tileIndices);
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        if (!cpl::contains(m_oSetTileWriteQueueFilenames, osFilename))
+            return true;
+    }
+    return WaitTileWrites();
+}
+
 /************************************************************************/
 /*              ZarrArray::SerializeSpecialAttributes()                 */
 /************************************************************************/
@@ -862,6 +1017,9 @@ bool ZarrArray::IAdviseReadCommon(const GUInt64 *arrayStartIdx,
     if (!CheckValidAndErrorOutIfNot())
         return false;
 
+    if (!WaitTileWrites())
+        return false;
+
     const size_t nDims = m_aoDims.size();
     anIndicesCur.resize(nDims);
     std::vector<uint64_t> anIndicesMin(nDims);
@@ -1160,7 +1318,8 @@ lbl_next_depth:
             }
             else
             {
-                if (!FlushDirtyTile())
+                if (!FlushDirtyTile() ||
+                    !WaitTileWrite(tileIndices.data()))
                     return false;
 
                 m_anCachedTiledIndices = tileIndices;
@@ -1680,6 +1839,7 @@ lbl_next_depth:
                 // potentially existing one.
                 bool bEmptyTile = false;
                 m_bCachedTiledValid =
+                    WaitTileWrite(tileIndices.data()) &&
                     LoadTileData(tileIndices.data(), bEmptyTile);
                 if (!m_bCachedTiledValid)
                 {
@@ -2146,6 +2306,9 @@ bool ZarrArray::CacheTilePresence()
     if (m_nTotalTileCount == 1)
         return true;
 
+    if (!WaitTileWrites())
+        return false;
+
     const std::string osDirectoryName = GetDataDirectory();
 
     struct DirCloser
@@ -2675,6 +2838,10 @@ bool ZarrArray::Rename(const std::string &osNewName)
     const std::string osNewDirectoryName = CPLFormFilenameSafe(
         osRootDirectoryName.c_str(), osNewName.c_str(), nullptr);
 
+    // Queued tile writes use the old directory name
+    if (!WaitTileWrites())
+        return false;
+
     if (VSIRename(osOldDirectoryName.c_str(), osNewDirectoryName.c_str()) != 0)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Renaming of %s to %s failed",
@@ -71,6 +71,10 @@ ZarrV2Array::Create(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
 ZarrV2Array::~ZarrV2Array()
 {
     ZarrV2Array::Flush();
+
+    // Wait for queued tile writes, that reference members of this class,
+    // even if Flush() did not because the array is no longer valid.
+    m_poTileWriteQueue.reset();
 }
 
 /************************************************************************/
@@ -83,6 +87,7 @@ void ZarrV2Array::Flush()
         return;
 
     ZarrV2Array::FlushDirtyTile();
+    WaitTileWrites();
 
     if (m_bDefinitionModified)
     {
@@ -826,6 +831,9 @@ bool ZarrV2Array::FlushDirtyTile() const
     {
         m_bCachedTiledEmpty = true;
 
+        if (!WaitTileWrite(m_anCachedTiledIndices.data()))
+            return false;
+
         VSIStatBufL sStat;
         if (VSIStatL(osFilename.c_str(), &sStat) == 0)
         {
@@ -856,7 +864,9 @@ bool ZarrV2Array::FlushDirtyTile() const
         std::swap(m_abyRawTileData, m_abyTmpRawTileData);
     }
 
-    size_t nRawDataSize = m_abyRawTileData.size();
+    // Collect filter and compressor options, as JSON objects must not be
+    // accessed from worker threads.
+    std::vector<std::pair<const CPLCompressor *, CPLStringList>> aoFilters;
     for (const auto &oFilter : m_oFiltersArray)
     {
         const auto osFilterId = oFilter["id"].ToString();
@@ -878,20 +888,36 @@ bool ZarrV2Array::FlushDirtyTile() const
             aosOptions.SetNameValue(obj.GetName().c_str(),
                                     obj.ToString().c_str());
         }
-        void *out_buffer = &m_abyTmpRawTileData[0];
-        size_t nOutSize = m_abyTmpRawTileData.size();
-        if (!psFilterCompressor->pfnFunc(
-                m_abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
-                aosOptions.List(), psFilterCompressor->user_data))
+        aoFilters.emplace_back(psFilterCompressor, std::move(aosOptions));
+    }
+
+    if (m_psCompressor == nullptr && m_psDecompressor != nullptr)
+    {
+        // Case of imagecodecs_tiff
+
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Only decompression supported for '%s' compression method",
+                 m_osDecompressorId.c_str());
+        return false;
+    }
+
+    CPLStringList aosCompressorOptions;
+    if (m_psCompressor)
+    {
+        for (const auto &obj : m_oCompressorJSon.GetChildren())
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Filter %s for tile %s failed", osFilterId.c_str(),
-                     osFilename.c_str());
-            return false;
+            aosCompressorOptions.SetNameValue(obj.GetName().c_str(),
+                                              obj.ToString().c_str());
+        }
+        if (EQUAL(m_psCompressor->pszId, "blosc") &&
+            m_oType.GetClass() == GEDTC_NUMERIC)
+        {
+            aosCompressorOptions.SetNameValue(
+                "TYPESIZE",
+                CPLSPrintf("%d", GDALGetDataTypeSizeBytes(
+                                     GDALGetNonComplexDataType(
+                                         m_oType.GetNumericDataType()))));
         }
-
-        nRawDataSize = nOutSize;
-        std::swap(m_abyRawTileData, m_abyTmpRawTileData);
     }
 
     if (m_osDimSeparator == "/")
@@ -909,14 +935,87 @@ bool ZarrV2Array::FlushDirtyTile() const
         }
     }
 
-    if (m_psCompressor == nullptr && m_psDecompressor != nullptr)
+    if (GetTileWriteQueue())
     {
-        // Case of imagecodecs_tiff
+        // Compress and write a copy of the tile in a worker thread
+        auto poRawTileData = std::make_shared<ZarrByteVectorQuickResize>();
+        try
+        {
+            poRawTileData->resize(m_abyRawTileData.size());
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for tile %s", osFilename.c_str());
+            return false;
+        }
+        memcpy(poRawTileData->data(), m_abyRawTileData.data(),
+               m_abyRawTileData.size());
+        const size_t nTmpSize = m_abyTmpRawTileData.size();
+        return SubmitTileWrite(
+            osFilename, 2 * m_abyRawTileData.size() + nTmpSize,
+            [this, osFilename, aoFilters, aosCompressorOptions, poRawTileData,
+             nTmpSize]()
+            {
+                ZarrByteVectorQuickResize abyTmpRawTileData;
+                try
+                {
+                    abyTmpRawTileData.resize(nTmpSize);
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Cannot allocate memory for tile %s",
+                             osFilename.c_str());
+                    return false;
+                }
+                return EncodeAndWriteTile(osFilename, aoFilters,
+                                          aosCompressorOptions, *poRawTileData,
+                                          abyTmpRawTileData);
+            });
+    }
 
-        CPLError(CE_Failure, CPLE_NotSupported,
-                 "Only decompression supported for '%s' compression method",
-                 m_osDecompressorId.c_str());
-        return false;
+    return EncodeAndWriteTile(osFilename, aoFilters, aosCompressorOptions,
+                              m_abyRawTileData, m_abyTmpRawTileData);
+}
+
+/************************************************************************/
+/*                   ZarrV2Array::EncodeAndWriteTile()                  */
+/************************************************************************/
+
+bool ZarrV2Array::EncodeAndWriteTile(
+    const std::string &osFilename,
+    const std::vector<std::pair<const CPLCompressor *, CPLStringList>>
+        &aoFilters,
+    const CPLStringList &aosCompressorOptions,
+    ZarrByteVectorQuickResize &abyRawTileData,
+    ZarrByteVectorQuickResize &abyTmpRawTileData) const
+{
+    // This method should NOT modify any ZarrArray member, as it may be
+    // called from worker threads.
+
+    // Set those #define to avoid accidental use of some global variables
+#define m_abyTmpRawTileData cannot_use_here
+#define m_abyRawTileData cannot_use_here
+#define m_abyDecodedTileData cannot_use_here
+
+    size_t nRawDataSize = abyRawTileData.size();
+    for (const auto &[psFilterCompressor, aosOptions] : aoFilters)
+    {
+        void *out_buffer = &abyTmpRawTileData[0];
+        size_t nOutSize = abyTmpRawTileData.size();
+        if (!psFilterCompressor->pfnFunc(
+                abyRawTileData.data(), nRawDataSize, &out_buffer, &nOutSize,
+                aosOptions.List(), psFilterCompressor->user_data))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Filter %s for tile %s failed", psFilterCompressor->pszId,
+                     osFilename.c_str());
+            return false;
+        }
+
+        nRawDataSize = nOutSize;
+        std::swap(abyRawTileData, abyTmpRawTileData);
     }
 
     VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
@@ -930,7 +1029,7 @@ bool ZarrV2Array::FlushDirtyTile() const
     bool bRet = true;
     if (m_psCompressor == nullptr)
     {
-        if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
+        if (VSIFWriteL(abyRawTileData.data(), 1, nRawDataSize, fp) !=
             nRawDataSize)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -958,26 +1057,10 @@ bool ZarrV2Array::FlushDirtyTile() const
         {
             void *out_buffer = &abyCompressedData[0];
             size_t out_size = abyCompressedData.size();
-            CPLStringList aosOptions;
-            const auto &compressorConfig = m_oCompressorJSon;
-            for (const auto &obj : compressorConfig.GetChildren())
-            {
-                aosOptions.SetNameValue(obj.GetName().c_str(),
-                                        obj.ToString().c_str());
-            }
-            if (EQUAL(m_psCompressor->pszId, "blosc") &&
-                m_oType.GetClass() == GEDTC_NUMERIC)
-            {
-                aosOptions.SetNameValue(
-                    "TYPESIZE",
-                    CPLSPrintf("%d", GDALGetDataTypeSizeBytes(
-                                         GDALGetNonComplexDataType(
-                                             m_oType.GetNumericDataType()))));
-            }
-
             if (!m_psCompressor->pfnFunc(
-                    m_abyRawTileData.data(), nRawDataSize, &out_buffer,
-                    &out_size, aosOptions.List(), m_psCompressor->user_data))
+                    abyRawTileData.data(), nRawDataSize, &out_buffer,
+                    &out_size, aosCompressorOptions.List(),
+                    m_psCompressor->user_data))
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Compression of tile %s failed", osFilename.c_str());
@@ -998,6 +1081,9 @@ bool ZarrV2Array::FlushDirtyTile() const
     VSIFCloseL(fp);
 
     return bRet;
+#undef m_abyTmpRawTileData
+#undef m_abyRawTileData
+#undef m_abyDecodedTileData
 }
 
 /************************************************************************/
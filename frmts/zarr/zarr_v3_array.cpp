@@ -68,6 +68,10 @@ ZarrV3Array::Create(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
 ZarrV3Array::~ZarrV3Array()
 {
     ZarrV3Array::Flush();
+
+    // Wait for queued tile writes, that reference members of this class,
+    // even if Flush() did not because the array is no longer valid.
+    m_poTileWriteQueue.reset();
 }
 
 /************************************************************************/
@@ -80,6 +84,8 @@ void ZarrV3Array::Flush()
         return;
 
     ZarrV3Array::FlushDirtyTile();
+    WaitTileWrites();
+    FlushPendingShards();
 
     if (!m_aoDims.empty())
     {
@@ -145,7 +151,8 @@ void ZarrV3Array::Serialize(const CPLJSONObject &oAttrs)
         CPLJSONObject oConfiguration;
         oChunkGrid.Add("configuration", oConfiguration);
         CPLJSONArray oChunks;
-        for (const auto nBlockSize : m_anBlockSize)
+        for (const auto nBlockSize :
+             IsSharded() ? m_anShardSize : m_anBlockSize)
         {
             oChunks.Add(static_cast<GInt64>(nBlockSize));
         }
@@ -382,6 +389,24 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
 
     bMissingTileOut = false;
 
+    if (IsSharded())
+    {
+        auto poShardingCodec = poCodecs->GetShardingCodec();
+        std::vector<std::vector<GByte>> aabyChunks;
+        if (!ReadInnerChunks(tileIndices, 1, bUseMutex, poShardingCodec,
+                             aabyChunks))
+        {
+            return false;
+        }
+        if (aabyChunks[0].empty())
+        {
+            bMissingTileOut = true;
+            return true;
+        }
+        return DecodeInnerChunk(poShardingCodec, aabyChunks[0],
+                                abyRawTileData, abyDecodedTileData);
+    }
+
     std::string osFilename = BuildTileFilename(tileIndices);
 
     // For network file systems, get the streaming version of the filename,
@@ -421,43 +446,9 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
     if (bUseMutex)
         m_oMutex.unlock();
 
-    VSILFILE *fp = nullptr;
-    // This is the number of files returned in a S3 directory listing operation
-    constexpr uint64_t MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING = 1000;
-    const char *const apszOpenOptions[] = {"IGNORE_FILENAME_RESTRICTIONS=YES",
-                                           nullptr};
-    const auto nErrorBefore = CPLGetErrorCounter();
-    if ((m_osDimSeparator == "/" && !m_anBlockSize.empty() &&
-         m_anBlockSize.back() > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING) ||
-        (m_osDimSeparator != "/" &&
-         m_nTotalTileCount > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING))
-    {
-        // Avoid issuing ReadDir() when a lot of files are expected
-        CPLConfigOptionSetter optionSetter("GDAL_DISABLE_READDIR_ON_OPEN",
-                                           "YES", true);
-        fp = VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
-    }
-    else
-    {
-        fp = VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
-    }
+    VSILFILE *fp = OpenChunkFile(osFilename, bMissingTileOut);
     if (fp == nullptr)
-    {
-        if (nErrorBefore != CPLGetErrorCounter())
-        {
-            return false;
-        }
-        else
-        {
-            // Missing files are OK and indicate nodata_value
-            CPLDebugOnly(ZARR_DEBUG_KEY, "Tile %s missing (=nodata)",
-                         osFilename.c_str());
-            bMissingTileOut = true;
-            return true;
-        }
-    }
-
-    bMissingTileOut = false;
+        return bMissingTileOut;
 
     CPLAssert(abyRawTileData.capacity() >= m_nTileSize);
     // should not fail
@@ -553,6 +544,408 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
 #undef m_poCodecs
 }
 
+/************************************************************************/
+/*                     ZarrV3Array::OpenChunkFile()                     */
+/************************************************************************/
+
+// Returns nullptr if the file could not be opened. bMissingOut is then set
+// if this is because the file does not exist, which is not an error.
+VSILFILE *ZarrV3Array::OpenChunkFile(const std::string &osFilename,
+                                     bool &bMissingOut) const
+{
+    bMissingOut = false;
+
+    VSILFILE *fp = nullptr;
+    // This is the number of files returned in a S3 directory listing operation
+    constexpr uint64_t MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING = 1000;
+    const char *const apszOpenOptions[] = {"IGNORE_FILENAME_RESTRICTIONS=YES",
+                                           nullptr};
+    const auto nErrorBefore = CPLGetErrorCounter();
+    if ((m_osDimSeparator == "/" && !m_anBlockSize.empty() &&
+         m_anBlockSize.back() > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING) ||
+        (m_osDimSeparator != "/" &&
+         m_nTotalTileCount > MAX_TILES_ALLOWED_FOR_DIRECTORY_LISTING))
+    {
+        // Avoid issuing ReadDir() when a lot of files are expected
+        CPLConfigOptionSetter optionSetter("GDAL_DISABLE_READDIR_ON_OPEN",
+                                           "YES", true);
+        fp = VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
+    }
+    else
+    {
+        fp = VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions);
+    }
+    if (fp == nullptr && nErrorBefore == CPLGetErrorCounter())
+    {
+        // Missing files are OK and indicate nodata_value
+        CPLDebugOnly(ZARR_DEBUG_KEY, "Tile %s missing (=nodata)",
+                     osFilename.c_str());
+        bMissingOut = true;
+    }
+    return fp;
+}
+
+/************************************************************************/
+/*                    ZarrV3Array::GetShardIndices()                    */
+/************************************************************************/
+
+// Computes the indices of the shard containing the inner chunk of indices
+// tileIndices, and the index of that inner chunk in the shard (C order).
+void ZarrV3Array::GetShardIndices(const uint64_t *tileIndices,
+                                  std::vector<uint64_t> &anShardIndices,
+                                  size_t &nInnerChunkIdx) const
+{
+    const size_t nDims = m_aoDims.size();
+    anShardIndices.resize(nDims);
+    nInnerChunkIdx = 0;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        const uint64_t nChunksPerShard = m_anShardSize[i] / m_anBlockSize[i];
+        anShardIndices[i] = tileIndices[i] / nChunksPerShard;
+        nInnerChunkIdx = static_cast<size_t>(nInnerChunkIdx * nChunksPerShard +
+                                             tileIndices[i] % nChunksPerShard);
+    }
+}
+
+/************************************************************************/
+/*                     ZarrV3Array::GetShardIndex()                     */
+/************************************************************************/
+
+// Returns the decoded index of a shard, or a null pointer if the shard does
+// not exist.
+bool ZarrV3Array::GetShardIndex(
+    const std::string &osFilename, bool bUseMutex,
+    ZarrV3CodecShardingIndexed *poShardingCodec,
+    std::shared_ptr<const std::vector<uint64_t>> &panIndex) const
+{
+    panIndex.reset();
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+        if (bUseMutex)
+            oLock.lock();
+        if (m_oShardIndexCache.tryGet(osFilename, panIndex))
+            return true;
+    }
+
+    bool bMissing = false;
+    VSILFILE *fp = OpenChunkFile(osFilename, bMissing);
+    if (fp == nullptr)
+    {
+        if (!bMissing)
+            return false;
+    }
+    else
+    {
+        bool bRet = true;
+        VSIFSeekL(fp, 0, SEEK_END);
+        const vsi_l_offset nFileSize = VSIFTellL(fp);
+        const size_t nIndexSize = poShardingCodec->GetEncodedIndexSize();
+        ZarrByteVectorQuickResize abyIndex;
+        std::vector<uint64_t> anIndex;
+        if (nFileSize < nIndexSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Shard %s is too small to contain its index",
+                     osFilename.c_str());
+            bRet = false;
+        }
+        else
+        {
+            abyIndex.resize(nIndexSize);
+            const vsi_l_offset nIndexOffset =
+                poShardingCodec->IsIndexAtEnd() ? nFileSize - nIndexSize : 0;
+            if (VSIFSeekL(fp, nIndexOffset, SEEK_SET) != 0 ||
+                VSIFReadL(abyIndex.data(), 1, nIndexSize, fp) != nIndexSize)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Cannot read index of shard %s", osFilename.c_str());
+                bRet = false;
+            }
+            else if (!poShardingCodec->DecodeIndex(abyIndex, anIndex))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot decode index of shard %s",
+                         osFilename.c_str());
+                bRet = false;
+            }
+        }
+        VSIFCloseL(fp);
+        if (!bRet)
+            return false;
+
+        for (size_t i = 0; i + 1 < anIndex.size(); i += 2)
+        {
+            const uint64_t nOffset = anIndex[i];
+            const uint64_t nSize = anIndex[i + 1];
+            if ((nOffset == ZarrV3CodecShardingIndexed::MISSING_CHUNK) !=
+                    (nSize == ZarrV3CodecShardingIndexed::MISSING_CHUNK) ||
+                (nOffset != ZarrV3CodecShardingIndexed::MISSING_CHUNK &&
+                 (nOffset > nFileSize || nSize > nFileSize - nOffset)))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid index entry for inner chunk %d of shard %s",
+                         static_cast<int>(i / 2), osFilename.c_str());
+                return false;
+            }
+        }
+        panIndex =
+            std::make_shared<const std::vector<uint64_t>>(std::move(anIndex));
+    }
+
+    std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+    if (bUseMutex)
+        oLock.lock();
+    m_oShardIndexCache.insert(osFilename, panIndex);
+    return true;
+}
+
+/************************************************************************/
+/*                    ZarrV3Array::ReadShardChunks()                    */
+/************************************************************************/
+
+// Reads the encoded inner chunks of indices anInnerChunkIdx of a shard.
+// Adjacent or close byte ranges are coalesced, and all of them are fetched
+// with a single multi-range read. aabyChunks[i] is left empty for missing
+// inner chunks.
+bool ZarrV3Array::ReadShardChunks(
+    const std::string &osFilename, const std::vector<uint64_t> &anIndex,
+    const std::vector<size_t> &anInnerChunkIdx,
+    std::vector<std::vector<GByte>> &aabyChunks) const
+{
+    aabyChunks.resize(anInnerChunkIdx.size());
+
+    std::vector<size_t> anToRead;
+    for (size_t i = 0; i < anInnerChunkIdx.size(); ++i)
+    {
+        const uint64_t nOffset = anIndex[2 * anInnerChunkIdx[i]];
+        const uint64_t nSize = anIndex[2 * anInnerChunkIdx[i] + 1];
+        if (nOffset == ZarrV3CodecShardingIndexed::MISSING_CHUNK || nSize == 0)
+            continue;
+        if (nSize > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Too large inner chunk in shard %s", osFilename.c_str());
+            return false;
+        }
+        anToRead.push_back(i);
+    }
+    if (anToRead.empty())
+        return true;
+
+    std::sort(anToRead.begin(), anToRead.end(),
+              [&anIndex, &anInnerChunkIdx](size_t a, size_t b)
+              {
+                  return anIndex[2 * anInnerChunkIdx[a]] <
+                         anIndex[2 * anInnerChunkIdx[b]];
+              });
+
+    // Merge ranges separated by less than that number of bytes
+    constexpr uint64_t MAX_GAP = 16 * 1024;
+    std::vector<vsi_l_offset> anRangeOffsets;
+    std::vector<size_t> anRangeSizes;
+    std::vector<size_t> anRangeOfChunk(anToRead.size());
+    for (size_t i = 0; i < anToRead.size(); ++i)
+    {
+        const uint64_t nOffset = anIndex[2 * anInnerChunkIdx[anToRead[i]]];
+        const uint64_t nEnd =
+            nOffset + anIndex[2 * anInnerChunkIdx[anToRead[i]] + 1];
+        if (!anRangeOffsets.empty() &&
+            nOffset <= anRangeOffsets.back() + anRangeSizes.back() + MAX_GAP &&
+            nEnd - anRangeOffsets.back() <=
+                static_cast<uint64_t>(std::numeric_limits<int>::max()))
+        {
+            anRangeSizes.back() =
+                std::max(anRangeSizes.back(),
+                         static_cast<size_t>(nEnd - anRangeOffsets.back()));
+        }
+        else
+        {
+            anRangeOffsets.push_back(nOffset);
+            anRangeSizes.push_back(static_cast<size_t>(nEnd - nOffset));
+        }
+        anRangeOfChunk[i] = anRangeOffsets.size() - 1;
+    }
+
+    std::vector<std::vector<GByte>> aabyRanges(anRangeOffsets.size());
+    std::vector<void *> apData(anRangeOffsets.size());
+    try
+    {
+        for (size_t i = 0; i < aabyRanges.size(); ++i)
+        {
+            aabyRanges[i].resize(anRangeSizes[i]);
+            apData[i] = aabyRanges[i].data();
+        }
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for inner chunks of shard %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    bool bMissing = false;
+    VSILFILE *fp = OpenChunkFile(osFilename, bMissing);
+    if (fp == nullptr)
+    {
+        if (bMissing)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Shard %s has disappeared",
+                     osFilename.c_str());
+        }
+        return false;
+    }
+    const bool bOK =
+        VSIFReadMultiRangeL(static_cast<int>(apData.size()), apData.data(),
+                            anRangeOffsets.data(), anRangeSizes.data(),
+                            fp) == 0;
+    VSIFCloseL(fp);
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Could not read inner chunks of shard %s correctly",
+                 osFilename.c_str());
+        return false;
+    }
+
+    for (size_t i = 0; i < anToRead.size(); ++i)
+    {
+        const size_t iRange = anRangeOfChunk[i];
+        const size_t nIdx = anInnerChunkIdx[anToRead[i]];
+        const size_t nOffsetInRange =
+            static_cast<size_t>(anIndex[2 * nIdx] - anRangeOffsets[iRange]);
+        const GByte *pabyStart = aabyRanges[iRange].data() + nOffsetInRange;
+        aabyChunks[anToRead[i]].assign(
+            pabyStart, pabyStart + static_cast<size_t>(anIndex[2 * nIdx + 1]));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    ZarrV3Array::ReadInnerChunks()                    */
+/************************************************************************/
+
+// Reads the encoded inner chunks of indices tileIndices[0:nTiles*nDims],
+// that must all belong to the same shard. aabyChunks[i] is left empty for
+// missing inner chunks.
+bool ZarrV3Array::ReadInnerChunks(
+    const uint64_t *tileIndices, size_t nTiles, bool bUseMutex,
+    ZarrV3CodecShardingIndexed *poShardingCodec,
+    std::vector<std::vector<GByte>> &aabyChunks) const
+{
+    const size_t nDims = m_aoDims.size();
+    aabyChunks.clear();
+    aabyChunks.resize(nTiles);
+
+    std::vector<uint64_t> anShardIndices;
+    std::vector<size_t> anInnerChunkIdx(nTiles);
+    for (size_t i = 0; i < nTiles; ++i)
+    {
+        GetShardIndices(tileIndices + i * nDims, anShardIndices,
+                        anInnerChunkIdx[i]);
+    }
+
+    // Inner chunks written, but whose shard has not been flushed yet
+    std::vector<size_t> anToRead;
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex, std::defer_lock);
+        if (bUseMutex)
+            oLock.lock();
+        const auto oIter = m_oMapPendingShards.find(anShardIndices);
+        for (size_t i = 0; i < nTiles; ++i)
+        {
+            if (oIter != m_oMapPendingShards.end())
+            {
+                const auto oIterChunk = oIter->second.find(anInnerChunkIdx[i]);
+                if (oIterChunk != oIter->second.end())
+                {
+                    aabyChunks[i] = oIterChunk->second;
+                    continue;
+                }
+            }
+            anToRead.push_back(i);
+        }
+    }
+    if (anToRead.empty())
+        return true;
+
+    const std::string osFilename = BuildChunkFilename(anShardIndices.data());
+    std::shared_ptr<const std::vector<uint64_t>> panIndex;
+    if (!GetShardIndex(osFilename, bUseMutex, poShardingCodec, panIndex))
+        return false;
+    if (!panIndex)
+        return true;
+
+    std::vector<size_t> anInnerChunkIdxToRead;
+    for (const size_t i : anToRead)
+        anInnerChunkIdxToRead.push_back(anInnerChunkIdx[i]);
+    std::vector<std::vector<GByte>> aabyChunksRead;
+    if (!ReadShardChunks(osFilename, *panIndex, anInnerChunkIdxToRead,
+                         aabyChunksRead))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < anToRead.size(); ++i)
+        aabyChunks[anToRead[i]] = std::move(aabyChunksRead[i]);
+    return true;
+}
+
+/************************************************************************/
+/*                   ZarrV3Array::DecodeInnerChunk()                    */
+/************************************************************************/
+
+bool ZarrV3Array::DecodeInnerChunk(
+    ZarrV3CodecShardingIndexed *poShardingCodec,
+    const std::vector<GByte> &abyChunk,
+    ZarrByteVectorQuickResize &abyRawTileData,
+    ZarrByteVectorQuickResize &abyDecodedTileData) const
+{
+    try
+    {
+        abyRawTileData.resize(abyChunk.size());
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for inner chunk");
+        return false;
+    }
+    memcpy(abyRawTileData.data(), abyChunk.data(), abyChunk.size());
+
+    if (!poShardingCodec->GetInnerCodecs()->Decode(abyRawTileData))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Decompression of inner chunk failed");
+        return false;
+    }
+    if (abyRawTileData.size() != m_nTileSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Decompressed inner chunk has not expected size. "
+                 "Got %u instead of %u",
+                 static_cast<unsigned>(abyRawTileData.size()),
+                 static_cast<unsigned>(m_nTileSize));
+        return false;
+    }
+
+    if (!abyDecodedTileData.empty())
+    {
+        const size_t nSourceSize =
+            m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
+        const auto nDTSize = m_oType.GetSize();
+        const size_t nValues = abyDecodedTileData.size() / nDTSize;
+        const GByte *pSrc = abyRawTileData.data();
+        GByte *pDst = &abyDecodedTileData[0];
+        for (size_t i = 0; i < nValues;
+             i++, pSrc += nSourceSize, pDst += nDTSize)
+        {
+            DecodeSourceElt(m_aoDtypeElts, pSrc, pDst);
+        }
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                      ZarrV3Array::IAdviseRead()                      */
 /************************************************************************/
@@ -581,6 +974,33 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
     if (wtp == nullptr)
         return false;
 
+    if (IsSharded())
+    {
+        // Order tiles by shard, so that each job can fetch the inner chunks
+        // of a given shard with a single multi-range read.
+        const size_t nDims = m_aoDims.size();
+        std::vector<std::pair<std::vector<uint64_t>, size_t>> aoKeys(nReqTiles);
+        for (size_t i = 0; i < nReqTiles; ++i)
+        {
+            size_t nInnerChunkIdx = 0;
+            GetShardIndices(anReqTilesIndices.data() + i * nDims,
+                            aoKeys[i].first, nInnerChunkIdx);
+            aoKeys[i].first.push_back(nInnerChunkIdx);
+            aoKeys[i].second = i;
+        }
+        std::sort(aoKeys.begin(), aoKeys.end());
+        std::vector<uint64_t> anSortedTilesIndices;
+        anSortedTilesIndices.reserve(anReqTilesIndices.size());
+        for (const auto &oKey : aoKeys)
+        {
+            anSortedTilesIndices.insert(
+                anSortedTilesIndices.end(),
+                anReqTilesIndices.begin() + oKey.second * nDims,
+                anReqTilesIndices.begin() + (oKey.second + 1) * nDims);
+        }
+        anReqTilesIndices = std::move(anSortedTilesIndices);
+    }
+
     struct JobStruct
     {
         JobStruct() = default;
@@ -637,7 +1057,13 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
             std::lock_guard<std::mutex> oLock(poArray->m_oMutex);
             poCodecs = poArray->m_poCodecs->Clone();
         }
+        auto poShardingCodec =
+            poArray->IsSharded() ? poCodecs->GetShardingCodec() : nullptr;
 
+        std::vector<std::vector<GByte>> aabyChunks;
+        std::vector<uint64_t> anShardIndices;
+        std::vector<uint64_t> anOtherShardIndices;
+        size_t iFirstReqOfBatch = 0;
         for (size_t iReq = jobStruct->nFirstIdx;
              iReq < jobStruct->nLastIdxNotIncluded; ++iReq)
         {
@@ -659,8 +1085,34 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
                 nTileIdx += tileIndices[j];
             }
 
-            if (!poArray->AllocateWorkingBuffers(abyRawTileData,
-                                                 abyDecodedTileData))
+            // Fetch at once all inner chunks of the job that belong to
+            // the shard of the current one.
+            bool bReadOK = true;
+            if (poShardingCodec &&
+                (iReq == jobStruct->nFirstIdx ||
+                 iReq == iFirstReqOfBatch + aabyChunks.size()))
+            {
+                size_t nInnerChunkIdx = 0;
+                poArray->GetShardIndices(tileIndices, anShardIndices,
+                                         nInnerChunkIdx);
+                size_t nBatchSize = 1;
+                while (iReq + nBatchSize < jobStruct->nLastIdxNotIncluded)
+                {
+                    poArray->GetShardIndices(
+                        tileIndices + nBatchSize * l_nDims, anOtherShardIndices,
+                        nInnerChunkIdx);
+                    if (anOtherShardIndices != anShardIndices)
+                        break;
+                    ++nBatchSize;
+                }
+                iFirstReqOfBatch = iReq;
+                bReadOK = poArray->ReadInnerChunks(tileIndices, nBatchSize,
+                                                   true,  // use mutex
+                                                   poShardingCodec, aabyChunks);
+            }
+
+            if (!bReadOK || !poArray->AllocateWorkingBuffers(
+                                abyRawTileData, abyDecodedTileData))
             {
                 std::lock_guard<std::mutex> oLock(poArray->m_oMutex);
                 *jobStruct->pbGlobalStatus = false;
@@ -668,10 +1120,23 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
             }
 
             bool bIsEmpty = false;
-            bool success = poArray->LoadTileData(tileIndices,
-                                                 true,  // use mutex
-                                                 poCodecs.get(), abyRawTileData,
-                                                 abyDecodedTileData, bIsEmpty);
+            bool success;
+            if (poShardingCodec)
+            {
+                const auto &abyChunk = aabyChunks[iReq - iFirstReqOfBatch];
+                bIsEmpty = abyChunk.empty();
+                success = bIsEmpty || poArray->DecodeInnerChunk(
+                                          poShardingCodec, abyChunk,
+                                          abyRawTileData, abyDecodedTileData);
+            }
+            else
+            {
+                success = poArray->LoadTileData(
+                    tileIndices,
+                    true,  // use mutex
+                    poCodecs.get(), abyRawTileData, abyDecodedTileData,
+                    bIsEmpty);
+            }
 
             std::lock_guard<std::mutex> oLock(poArray->m_oMutex);
             if (!success)
@@ -743,6 +1208,15 @@ bool ZarrV3Array::FlushDirtyTile() const
     {
         m_bCachedTiledEmpty = true;
 
+        if (IsSharded())
+        {
+            return AddPendingInnerChunk(m_anCachedTiledIndices.data(), nullptr,
+                                        0);
+        }
+
+        if (!WaitTileWrite(m_anCachedTiledIndices.data()))
+            return false;
+
         VSIStatBufL sStat;
         if (VSIStatL(osFilename.c_str(), &sStat) == 0)
         {
@@ -768,15 +1242,17 @@ bool ZarrV3Array::FlushDirtyTile() const
     }
 
     const size_t nSizeBefore = m_abyRawTileData.size();
-    if (m_poCodecs)
-    {
-        if (!m_poCodecs->Encode(m_abyRawTileData))
-        {
-            m_abyRawTileData.resize(nSizeBefore);
-            return false;
-        }
+    if (IsSharded())
+    {
+        const bool bRet =
+            m_poCodecs->GetShardingCodec()->GetInnerCodecs()->Encode(
+                m_abyRawTileData) &&
+            AddPendingInnerChunk(m_anCachedTiledIndices.data(),
+                                 m_abyRawTileData.data(),
+                                 m_abyRawTileData.size());
+        m_abyRawTileData.resize(nSizeBefore);
+        return bRet;
     }
-
     if (m_osDimSeparator == "/")
     {
         std::string osDir = CPLGetDirnameSafe(osFilename.c_str());
@@ -787,24 +1263,92 @@ bool ZarrV3Array::FlushDirtyTile() const
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot create directory %s", osDir.c_str());
-                m_abyRawTileData.resize(nSizeBefore);
                 return false;
             }
         }
     }
 
+    if (GetTileWriteQueue())
+    {
+        // Encode and write a copy of the tile in a worker thread
+        auto poRawTileData = std::make_shared<ZarrByteVectorQuickResize>();
+        try
+        {
+            poRawTileData->resize(nSizeBefore);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for tile %s", osFilename.c_str());
+            return false;
+        }
+        memcpy(poRawTileData->data(), m_abyRawTileData.data(), nSizeBefore);
+
+        // Codec sequences have working buffers, and cannot be shared
+        // between threads.
+        std::shared_ptr<ZarrV3CodecSequence> poCodecs;
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            if (!m_apoTileWriteCodecs.empty())
+            {
+                poCodecs = std::move(m_apoTileWriteCodecs.back());
+                m_apoTileWriteCodecs.pop_back();
+            }
+        }
+        if (!poCodecs && m_poCodecs)
+            poCodecs = m_poCodecs->Clone();
+
+        return SubmitTileWrite(
+            osFilename, 2 * nSizeBefore,
+            [this, osFilename, poRawTileData, poCodecs]()
+            {
+                const bool bRet = EncodeAndWriteTile(
+                    osFilename, poCodecs.get(), *poRawTileData);
+                if (poCodecs)
+                {
+                    std::lock_guard<std::mutex> oLock(m_oMutex);
+                    m_apoTileWriteCodecs.push_back(poCodecs);
+                }
+                return bRet;
+            });
+    }
+
+    const bool bRet =
+        EncodeAndWriteTile(osFilename, m_poCodecs.get(), m_abyRawTileData);
+    m_abyRawTileData.resize(nSizeBefore);
+    return bRet;
+}
+
+/************************************************************************/
+/*                   ZarrV3Array::EncodeAndWriteTile()                  */
+/************************************************************************/
+
+bool ZarrV3Array::EncodeAndWriteTile(
+    const std::string &osFilename, ZarrV3CodecSequence *poCodecs,
+    ZarrByteVectorQuickResize &abyRawTileData) const
+{
+    // This method should NOT modify any ZarrArray member, as it may be
+    // called from worker threads.
+
+    // Set those #define to avoid accidental use of some global variables
+#define m_abyRawTileData cannot_use_here
+#define m_abyDecodedTileData cannot_use_here
+#define m_poCodecs cannot_use_here
+
+    if (poCodecs && !poCodecs->Encode(abyRawTileData))
+        return false;
+
     VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
     if (fp == nullptr)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Cannot create tile %s",
                  osFilename.c_str());
-        m_abyRawTileData.resize(nSizeBefore);
         return false;
     }
 
     bool bRet = true;
-    const size_t nRawDataSize = m_abyRawTileData.size();
-    if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
+    const size_t nRawDataSize = abyRawTileData.size();
+    if (VSIFWriteL(abyRawTileData.data(), 1, nRawDataSize, fp) !=
         nRawDataSize)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
@@ -813,8 +1357,214 @@ bool ZarrV3Array::FlushDirtyTile() const
     }
     VSIFCloseL(fp);
 
-    m_abyRawTileData.resize(nSizeBefore);
+    return bRet;
+#undef m_abyRawTileData
+#undef m_abyDecodedTileData
+#undef m_poCodecs
+}
+
+/************************************************************************/
+/*                 ZarrV3Array::AddPendingInnerChunk()                  */
+/************************************************************************/
+
+// Stores an encoded inner chunk (or a missing one if pabyData == nullptr)
+// in the in-memory shard it belongs to, and writes that shard once all its
+// inner chunks have been set.
+bool ZarrV3Array::AddPendingInnerChunk(const uint64_t *tileIndices,
+                                       const GByte *pabyData,
+                                       size_t nSize) const
+{
+    std::vector<uint64_t> anShardIndices;
+    size_t nInnerChunkIdx = 0;
+    GetShardIndices(tileIndices, anShardIndices, nInnerChunkIdx);
+
+    std::map<size_t, std::vector<GByte>> *poChunks = nullptr;
+    try
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        poChunks = &(m_oMapPendingShards[anShardIndices]);
+        (*poChunks)[nInnerChunkIdx].assign(pabyData, pabyData + nSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for inner chunk");
+        return false;
+    }
+    // Only the writing thread modifies the map, so the shard can be
+    // accessed without the mutex held from now on.
+    auto &oChunks = *poChunks;
+
+    // Number of inner chunks of the shard that intersect the array
+    size_t nExpectedChunks = 1;
+    for (size_t i = 0; i < m_aoDims.size(); ++i)
+    {
+        const uint64_t nChunksPerShard = m_anShardSize[i] / m_anBlockSize[i];
+        const uint64_t nBlocks = cpl::div_round_up(m_aoDims[i]->GetSize(),
+                                                   m_anBlockSize[i]);
+        nExpectedChunks *= static_cast<size_t>(
+            std::min(nChunksPerShard,
+                     nBlocks - anShardIndices[i] * nChunksPerShard));
+    }
+    if (oChunks.size() < nExpectedChunks)
+        return true;
+
+    const bool bRet = WriteShard(anShardIndices, oChunks);
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_oMapPendingShards.erase(anShardIndices);
+    return bRet;
+}
+
+/************************************************************************/
+/*                   ZarrV3Array::FlushPendingShards()                  */
+/************************************************************************/
+
+bool ZarrV3Array::FlushPendingShards() const
+{
+    bool bRet = true;
+    for (auto &[anShardIndices, oChunks] : m_oMapPendingShards)
+    {
+        if (!WriteShard(anShardIndices, oChunks))
+            bRet = false;
+    }
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_oMapPendingShards.clear();
+    return bRet;
+}
+
+/************************************************************************/
+/*                       ZarrV3Array::WriteShard()                      */
+/************************************************************************/
+
+// Writes a shard from the inner chunks of oChunks (indexed by their position
+// in the shard), completed by the ones of the existing shard file.
+bool ZarrV3Array::WriteShard(
+    const std::vector<uint64_t> &anShardIndices,
+    std::map<size_t, std::vector<GByte>> &oChunks) const
+{
+    auto poShardingCodec = m_poCodecs->GetShardingCodec();
+    const size_t nInnerChunkCount = poShardingCodec->GetInnerChunkCount();
+    const std::string osFilename = BuildChunkFilename(anShardIndices.data());
+
+    // Fetch inner chunks that have not been rewritten from the existing file
+    if (oChunks.size() < nInnerChunkCount)
+    {
+        std::shared_ptr<const std::vector<uint64_t>> panIndex;
+        if (!GetShardIndex(osFilename, /* bUseMutex = */ false,
+                           poShardingCodec, panIndex))
+        {
+            return false;
+        }
+        if (panIndex)
+        {
+            std::vector<size_t> anInnerChunkIdx;
+            for (size_t i = 0; i < nInnerChunkCount; ++i)
+            {
+                if (oChunks.find(i) == oChunks.end())
+                    anInnerChunkIdx.push_back(i);
+            }
+            std::vector<std::vector<GByte>> aabyChunks;
+            if (!ReadShardChunks(osFilename, *panIndex, anInnerChunkIdx,
+                                 aabyChunks))
+            {
+                return false;
+            }
+            for (size_t i = 0; i < anInnerChunkIdx.size(); ++i)
+                oChunks[anInnerChunkIdx[i]] = std::move(aabyChunks[i]);
+        }
+    }
+
+    const uint64_t nIndexSize = poShardingCodec->GetEncodedIndexSize();
+    std::vector<uint64_t> anIndex(2 * nInnerChunkCount,
+                                  ZarrV3CodecShardingIndexed::MISSING_CHUNK);
+    uint64_t nOffset = poShardingCodec->IsIndexAtEnd() ? 0 : nIndexSize;
+    for (const auto &[nIdx, abyChunk] : oChunks)
+    {
+        if (!abyChunk.empty())
+        {
+            anIndex[2 * nIdx] = nOffset;
+            anIndex[2 * nIdx + 1] = abyChunk.size();
+            nOffset += abyChunk.size();
+        }
+    }
+
+    if (nOffset == (poShardingCodec->IsIndexAtEnd() ? 0 : nIndexSize))
+    {
+        // All inner chunks are empty
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        m_oShardIndexCache.insert(
+            osFilename, std::shared_ptr<const std::vector<uint64_t>>());
+        VSIStatBufL sStat;
+        if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        {
+            CPLDebugOnly(ZARR_DEBUG_KEY,
+                         "Deleting shard %s that has now empty content",
+                         osFilename.c_str());
+            return VSIUnlink(osFilename.c_str()) == 0;
+        }
+        return true;
+    }
 
+    ZarrByteVectorQuickResize abyIndex;
+    if (!poShardingCodec->EncodeIndex(anIndex, abyIndex))
+        return false;
+
+    if (m_osDimSeparator == "/")
+    {
+        std::string osDir = CPLGetDirnameSafe(osFilename.c_str());
+        VSIStatBufL sStat;
+        if (VSIStatL(osDir.c_str(), &sStat) != 0)
+        {
+            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot create directory %s", osDir.c_str());
+                return false;
+            }
+        }
+    }
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot create shard %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    bool bRet = true;
+    if (!poShardingCodec->IsIndexAtEnd())
+        bRet = VSIFWriteL(abyIndex.data(), 1, abyIndex.size(), fp) ==
+               abyIndex.size();
+    for (const auto &oIter : oChunks)
+    {
+        const auto &abyChunk = oIter.second;
+        if (bRet && !abyChunk.empty())
+            bRet = VSIFWriteL(abyChunk.data(), 1, abyChunk.size(), fp) ==
+                   abyChunk.size();
+    }
+    if (bRet && poShardingCodec->IsIndexAtEnd())
+        bRet = VSIFWriteL(abyIndex.data(), 1, abyIndex.size(), fp) ==
+               abyIndex.size();
+    if (VSIFCloseL(fp) != 0)
+        bRet = false;
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not write shard %s correctly", osFilename.c_str());
+    }
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    if (bRet)
+    {
+        m_oShardIndexCache.insert(
+            osFilename,
+            std::make_shared<const std::vector<uint64_t>>(std::move(anIndex)));
+    }
+    else
+    {
+        m_oShardIndexCache.remove(osFilename);
+    }
     return bRet;
 }
 
@@ -823,6 +1573,24 @@ bool ZarrV3Array::FlushDirtyTile() const
 /************************************************************************/
 
 std::string ZarrV3Array::BuildTileFilename(const uint64_t *tileIndices) const
+{
+    if (IsSharded())
+    {
+        std::vector<uint64_t> anShardIndices;
+        size_t nInnerChunkIdx = 0;
+        GetShardIndices(tileIndices, anShardIndices, nInnerChunkIdx);
+        return BuildChunkFilename(anShardIndices.data());
+    }
+    return BuildChunkFilename(tileIndices);
+}
+
+/************************************************************************/
+/*                  ZarrV3Array::BuildChunkFilename()                   */
+/************************************************************************/
+
+// Builds the filename of a chunk of the chunk grid, that is a shard for
+// sharded arrays.
+std::string ZarrV3Array::BuildChunkFilename(const uint64_t *chunkIndices) const
 {
     if (m_aoDims.empty())
     {
@@ -842,7 +1610,7 @@ std::string ZarrV3Array::BuildTileFilename(const uint64_t *tileIndices) const
         {
             if (i > 0 || !m_bV2ChunkKeyEncoding)
                 osFilename += m_osDimSeparator;
-            osFilename += std::to_string(tileIndices[i]);
+            osFilename += std::to_string(chunkIndices[i]);
         }
         return osFilename;
     }
@@ -1578,11 +2346,29 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
             return nullptr;
     }
 
+    // For sharded arrays, GDAL blocks are the inner chunks, and the chunks of
+    // the chunk grid are shards.
+    std::vector<GUInt64> anShardSize;
+    auto oStructuralCodecs = oCodecs;
+    if (poCodecs && poCodecs->GetShardingCodec() && !aoDims.empty())
+    {
+        anShardSize = std::move(anBlockSize);
+        anBlockSize.clear();
+        for (const size_t nSize :
+             poCodecs->GetShardingCodec()->GetInnerBlockSize())
+        {
+            anBlockSize.push_back(nSize);
+        }
+        oStructuralCodecs = oCodecs[0]["configuration"]["codecs"].ToArray();
+    }
+
     auto poArray =
         ZarrV3Array::Create(m_poSharedResource, GetFullName(), osArrayName,
                             aoDims, oType, aoDtypeElts, anBlockSize);
     if (!poArray)
         return nullptr;
+    if (!anShardSize.empty())
+        poArray->SetShardSize(anShardSize);
     poArray->SetUpdatable(m_bUpdatable);  // must be set before SetAttributes()
     poArray->SetFilename(osZarrayFilename);
     poArray->SetIsV2ChunkKeyEncoding(bV2ChunkKeyEncoding);
@@ -1594,11 +2380,13 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
     poArray->ParseSpecialAttributes(m_pSelf.lock(), oAttributes);
     poArray->SetAttributes(oAttributes);
     poArray->SetDtype(oDtype);
-    if (oCodecs.Size() > 0 &&
-        oCodecs[oCodecs.Size() - 1].GetString("name") != "bytes")
+    if (oStructuralCodecs.Size() > 0 &&
+        oStructuralCodecs[oStructuralCodecs.Size() - 1].GetString("name") !=
+            "bytes")
     {
         poArray->SetStructuralInfo(
-            "COMPRESSOR", oCodecs[oCodecs.Size() - 1].ToString().c_str());
+            "COMPRESSOR",
+            oStructuralCodecs[oStructuralCodecs.Size() - 1].ToString().c_str());
     }
     if (poCodecs)
         poArray->SetCodecs(std::move(poCodecs));
@@ -1617,7 +2405,17 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
     if (CPLTestBool(m_poSharedResource->GetOpenOptions().FetchNameValueDef(
             "CACHE_TILE_PRESENCE", "NO")))
     {
-        poArray->CacheTilePresence();
+        if (!anShardSize.empty())
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "CACHE_TILE_PRESENCE is not supported for sharded array "
+                     "%s",
+                     osArrayName.c_str());
+        }
+        else
+        {
+            poArray->CacheTilePresence();
+        }
     }
 
     return poArray;
@@ -958,6 +958,374 @@ bool ZarrV3CodecTranspose::Decode(const ZarrByteVectorQuickResize &abySrc,
     return Transpose(abySrc, abyDst, false);
 }
 
+/************************************************************************/
+/*                            ZarrCRC32C()                              */
+/************************************************************************/
+
+// CRC-32C (Castagnoli polynomial), as used by the crc32c codec
+static uint32_t ZarrCRC32C(const GByte *pabyData, size_t nSize)
+{
+    static const std::array<uint32_t, 256> anTable = []()
+    {
+        std::array<uint32_t, 256> anTableTmp{};
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t nCRC = i;
+            for (int j = 0; j < 8; ++j)
+                nCRC = (nCRC >> 1) ^ ((nCRC & 1) ? 0x82F63B78U : 0);
+            anTableTmp[i] = nCRC;
+        }
+        return anTableTmp;
+    }();
+
+    uint32_t nCRC = 0xFFFFFFFFU;
+    for (size_t i = 0; i < nSize; ++i)
+        nCRC = anTable[(nCRC ^ pabyData[i]) & 0xFF] ^ (nCRC >> 8);
+    return nCRC ^ 0xFFFFFFFFU;
+}
+
+/************************************************************************/
+/*                         ZarrV3CodecCRC32C()                          */
+/************************************************************************/
+
+ZarrV3CodecCRC32C::ZarrV3CodecCRC32C() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                ZarrV3CodecCRC32C::InitFromConfiguration()            */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    // byte->byte codec
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    if (configuration.IsValid())
+    {
+        if (configuration.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec crc32c: configuration is not an object");
+            return false;
+        }
+
+        for (const auto &oChild : configuration.GetChildren())
+        {
+            CPLError(
+                CE_Failure, CPLE_AppDefined,
+                "Codec crc32c: configuration contains a unhandled member: %s",
+                oChild.GetName().c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecCRC32C::Clone()                       */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecCRC32C::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecCRC32C>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecCRC32C::Encode()                      */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::Encode(const ZarrByteVectorQuickResize &abySrc,
+                               ZarrByteVectorQuickResize &abyDst) const
+{
+    const size_t nSize = abySrc.size();
+    uint32_t nCRC = ZarrCRC32C(abySrc.data(), nSize);
+    CPL_LSBPTR32(&nCRC);
+    abyDst.resize(nSize + sizeof(nCRC));
+    if (nSize)
+        memcpy(abyDst.data(), abySrc.data(), nSize);
+    memcpy(abyDst.data() + nSize, &nCRC, sizeof(nCRC));
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecCRC32C::Decode()                      */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::Decode(const ZarrByteVectorQuickResize &abySrc,
+                               ZarrByteVectorQuickResize &abyDst) const
+{
+    uint32_t nExpectedCRC = 0;
+    if (abySrc.size() < sizeof(nExpectedCRC))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "crc32c codec: Decode(): input buffer too small");
+        return false;
+    }
+    const size_t nSize = abySrc.size() - sizeof(nExpectedCRC);
+    memcpy(&nExpectedCRC, abySrc.data() + nSize, sizeof(nExpectedCRC));
+    CPL_LSBPTR32(&nExpectedCRC);
+    if (ZarrCRC32C(abySrc.data(), nSize) != nExpectedCRC)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "crc32c codec: Decode(): checksum mismatch");
+        return false;
+    }
+    abyDst.resize(nSize);
+    if (nSize)
+        memcpy(abyDst.data(), abySrc.data(), nSize);
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecShardingIndexed()                     */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed::ZarrV3CodecShardingIndexed() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                    ~ZarrV3CodecShardingIndexed()                     */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed::~ZarrV3CodecShardingIndexed() = default;
+
+/************************************************************************/
+/*                           GetConfiguration()                         */
+/************************************************************************/
+
+/* static */ CPLJSONObject ZarrV3CodecShardingIndexed::GetConfiguration(
+    const std::vector<GUInt64> &anInnerBlockSize,
+    const CPLJSONArray &oInnerCodecs)
+{
+    CPLJSONObject oConfig;
+    CPLJSONArray oChunkShape;
+    for (const auto nSize : anInnerBlockSize)
+        oChunkShape.Add(static_cast<GInt64>(nSize));
+    oConfig.Add("chunk_shape", oChunkShape);
+    oConfig.Add("codecs", oInnerCodecs);
+
+    CPLJSONArray oIndexCodecs;
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecBytes::NAME);
+        oCodec.Add("configuration", ZarrV3CodecBytes::GetConfiguration(true));
+        oIndexCodecs.Add(oCodec);
+    }
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecCRC32C::NAME);
+        oIndexCodecs.Add(oCodec);
+    }
+    oConfig.Add("index_codecs", oIndexCodecs);
+    oConfig.Add("index_location", "end");
+    return oConfig;
+}
+
+/************************************************************************/
+/*             ZarrV3CodecShardingIndexed::InitFromConfiguration()      */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    if (!configuration.IsValid() ||
+        configuration.GetType() != CPLJSONObject::Type::Object)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: configuration missing or not an "
+                 "object");
+        return false;
+    }
+
+    for (const auto &oChild : configuration.GetChildren())
+    {
+        const auto osName = oChild.GetName();
+        if (osName != "chunk_shape" && osName != "codecs" &&
+            osName != "index_codecs" && osName != "index_location")
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: configuration contains a "
+                     "unhandled member: %s",
+                     osName.c_str());
+            return false;
+        }
+    }
+
+    const auto &anShardSize = oInputArrayMetadata.anBlockSizes;
+    const auto oChunkShape = configuration.GetArray("chunk_shape");
+    if (!oChunkShape.IsValid() ||
+        static_cast<size_t>(oChunkShape.Size()) != anShardSize.size())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: chunk_shape missing or not an "
+                 "array with the expected number of elements");
+        return false;
+    }
+    m_anInnerBlockSize.clear();
+    m_nInnerChunkCount = 1;
+    for (int i = 0; i < oChunkShape.Size(); ++i)
+    {
+        const GInt64 nSize = oChunkShape[i].ToLong();
+        if (nSize <= 0 || anShardSize[i] % static_cast<size_t>(nSize) != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: chunk_shape[%d] is not a "
+                     "divisor of the shard shape",
+                     i);
+            return false;
+        }
+        m_anInnerBlockSize.push_back(static_cast<size_t>(nSize));
+        m_nInnerChunkCount *= anShardSize[i] / static_cast<size_t>(nSize);
+    }
+
+    const auto osIndexLocation =
+        configuration.GetString("index_location", "end");
+    if (osIndexLocation != "start" && osIndexLocation != "end")
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: invalid value for index_location");
+        return false;
+    }
+    m_bIndexAtEnd = osIndexLocation == "end";
+
+    ZarrArrayMetadata oInnerArrayMetadata;
+    oInnerArrayMetadata.oElt = oInputArrayMetadata.oElt;
+    oInnerArrayMetadata.anBlockSizes = m_anInnerBlockSize;
+    m_poInnerCodecs =
+        std::make_unique<ZarrV3CodecSequence>(oInnerArrayMetadata);
+    if (!m_poInnerCodecs->InitFromJson(configuration["codecs"]))
+        return false;
+
+    // The index is an array of (offset, nbytes) uint64 pairs, with one
+    // pair per inner chunk.
+    ZarrArrayMetadata oIndexArrayMetadata;
+    oIndexArrayMetadata.oElt.nativeType = DtypeElt::NativeType::UNSIGNED_INT;
+    oIndexArrayMetadata.oElt.nativeSize = sizeof(uint64_t);
+    oIndexArrayMetadata.oElt.gdalType =
+        GDALExtendedDataType::Create(GDT_UInt64);
+    oIndexArrayMetadata.oElt.gdalSize = sizeof(uint64_t);
+    for (size_t i = 0; i < anShardSize.size(); ++i)
+    {
+        oIndexArrayMetadata.anBlockSizes.push_back(anShardSize[i] /
+                                                   m_anInnerBlockSize[i]);
+    }
+    oIndexArrayMetadata.anBlockSizes.push_back(2);
+
+    // Only codecs that produce an encoded index of fixed size are allowed
+    const auto oIndexCodecs = configuration["index_codecs"];
+    m_nEncodedIndexSize = m_nInnerChunkCount * 2 * sizeof(uint64_t);
+    if (oIndexCodecs.GetType() == CPLJSONObject::Type::Array)
+    {
+        for (const auto &oCodec : oIndexCodecs.ToArray())
+        {
+            const auto osName = oCodec.GetString("name");
+            if (osName == ZarrV3CodecCRC32C::NAME)
+            {
+                m_nEncodedIndexSize += sizeof(uint32_t);
+            }
+            else if (osName != ZarrV3CodecBytes::NAME)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Codec sharding_indexed: unsupported index codec: %s",
+                         osName.c_str());
+                return false;
+            }
+        }
+    }
+    m_poIndexCodecs =
+        std::make_unique<ZarrV3CodecSequence>(oIndexArrayMetadata);
+    return m_poIndexCodecs->InitFromJson(oIndexCodecs);
+}
+
+/************************************************************************/
+/*                 ZarrV3CodecShardingIndexed::Clone()                  */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecShardingIndexed::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecShardingIndexed>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*                 ZarrV3CodecShardingIndexed::Encode()                 */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::Encode(const ZarrByteVectorQuickResize &,
+                                        ZarrByteVectorQuickResize &) const
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "sharding_indexed codec: Encode() of a whole shard is not "
+             "supported");
+    return false;
+}
+
+/************************************************************************/
+/*                 ZarrV3CodecShardingIndexed::Decode()                 */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::Decode(const ZarrByteVectorQuickResize &,
+                                        ZarrByteVectorQuickResize &) const
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "sharding_indexed codec: Decode() of a whole shard is not "
+             "supported");
+    return false;
+}
+
+/************************************************************************/
+/*              ZarrV3CodecShardingIndexed::DecodeIndex()               */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::DecodeIndex(
+    ZarrByteVectorQuickResize &abyIndex, std::vector<uint64_t> &anIndex)
+{
+    if (!m_poIndexCodecs->Decode(abyIndex) ||
+        abyIndex.size() != m_nInnerChunkCount * 2 * sizeof(uint64_t))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "sharding_indexed codec: cannot decode shard index");
+        return false;
+    }
+    anIndex.resize(m_nInnerChunkCount * 2);
+    memcpy(anIndex.data(), abyIndex.data(), abyIndex.size());
+    return true;
+}
+
+/************************************************************************/
+/*              ZarrV3CodecShardingIndexed::EncodeIndex()               */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::EncodeIndex(
+    const std::vector<uint64_t> &anIndex, ZarrByteVectorQuickResize &abyIndex)
+{
+    CPLAssert(anIndex.size() == m_nInnerChunkCount * 2);
+    abyIndex.resize(anIndex.size() * sizeof(uint64_t));
+    memcpy(abyIndex.data(), anIndex.data(), abyIndex.size());
+    return m_poIndexCodecs->Encode(abyIndex);
+}
+
 /************************************************************************/
 /*                    ZarrV3CodecSequence::Clone()                      */
 /************************************************************************/
@@ -1036,6 +1404,21 @@ bool ZarrV3CodecSequence::InitFromJson(const CPLJSONObject &oCodecs)
             poCodec = std::make_unique<ZarrV3CodecBytes>();
         else if (osName == "transpose")
             poCodec = std::make_unique<ZarrV3CodecTranspose>();
+        else if (osName == "crc32c")
+            poCodec = std::make_unique<ZarrV3CodecCRC32C>();
+        else if (osName == "sharding_indexed")
+        {
+            // Inner chunks are read and written individually, which is not
+            // compatible with codecs applying to the whole shard
+            if (oCodecsArray.Size() != 1)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "sharding_indexed codec is only supported as the "
+                         "single codec of an array");
+                return false;
+            }
+            poCodec = std::make_unique<ZarrV3CodecShardingIndexed>();
+        }
         else
         {
             CPLError(CE_Failure, CPLE_NotSupported, "Unsupported codec: %s",
@@ -1155,3 +1538,18 @@ bool ZarrV3CodecSequence::Decode(ZarrByteVectorQuickResize &abyBuffer)
     }
     return true;
 }
+
+/************************************************************************/
+/*                ZarrV3CodecSequence::GetShardingCodec()               */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed *ZarrV3CodecSequence::GetShardingCodec() const
+{
+    if (m_apoCodecs.size() == 1 &&
+        m_apoCodecs[0]->GetName() == ZarrV3CodecShardingIndexed::NAME)
+    {
+        return cpl::down_cast<ZarrV3CodecShardingIndexed *>(
+            m_apoCodecs[0].get());
+    }
+    return nullptr;
+}
@@ -550,6 +550,34 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
                                   papszOptions))
         return nullptr;
 
+    // Shards are the chunks of the chunk grid, and blocks are inner chunks
+    std::vector<GUInt64> anShardSize;
+    const char *pszShardSize = CSLFetchNameValue(papszOptions, "SHARD_SIZE");
+    if (pszShardSize)
+    {
+        const auto aszTokens(
+            CPLStringList(CSLTokenizeString2(pszShardSize, ",", 0)));
+        if (static_cast<size_t>(aszTokens.size()) != aoDimensions.size())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid number of values in SHARD_SIZE");
+            return nullptr;
+        }
+        for (size_t i = 0; i < aoDimensions.size(); ++i)
+        {
+            const GUInt64 nSize = static_cast<GUInt64>(
+                CPLAtoGIntBig(aszTokens[static_cast<int>(i)]));
+            if (nSize == 0 || (nSize % anBlockSize[i]) != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "SHARD_SIZE values must be multiple of the "
+                         "corresponding BLOCKSIZE values");
+                return nullptr;
+            }
+            anShardSize.push_back(nSize);
+        }
+    }
+
     const char *pszDimSeparator =
         CSLFetchNameValueDef(papszOptions, "DIM_SEPARATOR", "/");
 
@@ -679,13 +707,25 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
         return nullptr;
     }
 
+    const auto oStructuralCodecs = oCodecs;
+    if (!anShardSize.empty())
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecShardingIndexed::NAME);
+        oCodec.Add("configuration",
+                   ZarrV3CodecShardingIndexed::GetConfiguration(
+                       anBlockSize, oStructuralCodecs));
+        oCodecs = CPLJSONArray();
+        oCodecs.Add(oCodec);
+    }
+
     if (oCodecs.Size() > 0)
     {
         // Byte swapping will be done by the codec chain
         aoDtypeElts.back().needByteSwapping = false;
 
         ZarrArrayMetadata oInputArrayMetadata;
-        for (auto &nSize : anBlockSize)
+        for (auto &nSize : anShardSize.empty() ? anBlockSize : anShardSize)
             oInputArrayMetadata.anBlockSizes.push_back(
                 static_cast<size_t>(nSize));
         oInputArrayMetadata.oElt = aoDtypeElts.back();
@@ -706,11 +746,15 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
     poArray->SetFilename(osFilename);
     poArray->SetDimSeparator(pszDimSeparator);
     poArray->SetDtype(dtype);
-    if (oCodecs.Size() > 0 &&
-        oCodecs[oCodecs.Size() - 1].GetString("name") != "bytes")
+    if (!anShardSize.empty())
+        poArray->SetShardSize(anShardSize);
+    if (oStructuralCodecs.Size() > 0 &&
+        oStructuralCodecs[oStructuralCodecs.Size() - 1].GetString("name") !=
+            "bytes")
     {
         poArray->SetStructuralInfo(
-            "COMPRESSOR", oCodecs[oCodecs.Size() - 1].ToString().c_str());
+            "COMPRESSOR",
+            oStructuralCodecs[oStructuralCodecs.Size() - 1].ToString().c_str());
     }
     if (poCodecs)
         poArray->SetCodecs(std::move(poCodecs));
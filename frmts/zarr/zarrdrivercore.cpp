@@ -136,6 +136,9 @@ void ZARRDriverSetCommonMetadata(GDALDriver *poDriver)
         "description="
         "'Maximum delay in seconds allowed to set the DIM_{dimname}_VALUE band "
         "metadata items'/>"
+        "   <Option name='NUM_THREADS' type='string' description="
+        "'Number of worker threads for compressing and writing tiles. Can be "
+        "set to ALL_CPUS' default='1'/>"
         "</OpenOptionList>");
 
     poDriver->SetMetadataItem(
@@ -883,7 +883,7 @@ class CPL_DLL GDALDataset : public GDALMajorObject
         return papszOpenOptions;
     }
 
-    bool IsThreadSafe(int nScopeFlags) const;
+    virtual bool IsThreadSafe(int nScopeFlags) const;
 
 #ifndef DOXYGEN_SKIP
     /** Return open options.
@@ -2590,6 +2590,33 @@ typedef enum
     GDAL_IDENTIFY_TRUE = 1
 } GDALIdentifyEnum;
 
+/* ******************************************************************** */
+/*                           GDALDecodedImage                           */
+/* ******************************************************************** */
+
+/** Image decoded by GDALDriver::DecodeImage().
+ *
+ * Pixel values are stored band-sequential (all the values of the first band,
+ * then all the values of the second band, etc.), in native byte order.
+ *
+ * @since GDAL 3.12
+ */
+struct GDALDecodedImage
+{
+    /** Width in pixels */
+    int nXSize = 0;
+    /** Height in pixels */
+    int nYSize = 0;
+    /** Number of bands */
+    int nBands = 0;
+    /** Data type of pixel values */
+    GDALDataType eDT = GDT_Unknown;
+    /** Pixel values, of size nXSize * nYSize * nBands * sizeof(eDT) */
+    std::vector<GByte> abyData{};
+    /** Color table of a single-band paletted image, or nullptr */
+    std::unique_ptr<GDALColorTable> poColorTable{};
+};
+
 /* ******************************************************************** */
 /*                              GDALDriver                              */
 /* ******************************************************************** */
@@ -2648,6 +2675,14 @@ class CPL_DLL GDALDriver : public GDALMajorObject
      */
     bool HasOpenOption(const char *pszOpenOptionName) const;
 
+    bool DecodeImage(const void *pSrc, size_t nSrcSize,
+                     CSLConstList papszOptions, GDALDecodedImage &sImage);
+
+    bool EncodeImage(int nXSize, int nYSize, int nBands, GDALDataType eDT,
+                     const void *const *papBandData,
+                     const GDALColorTable *poColorTable,
+                     CSLConstList papszOptions, std::vector<GByte> &abyOut);
+
     GDALDataset *
     VectorTranslateFrom(const char *pszDestName, GDALDataset *poSourceDS,
                         CSLConstList papszVectorTranslateArguments,
@@ -2796,6 +2831,36 @@ class CPL_DLL GDALDriver : public GDALMajorObject
         return pfnInstantiateAlgorithm;
     }
 
+    /** Decode an in-memory encoded image. Must return false without
+     * emitting an error if the content is not recognized by the driver.
+     * See DecodeImage().
+     */
+    typedef bool (*DecodeImageCallback)(const void *pSrc, size_t nSrcSize,
+                                        CSLConstList papszOptions,
+                                        GDALDecodedImage &sImage);
+    DecodeImageCallback pfnDecodeImage = nullptr;
+
+    virtual DecodeImageCallback GetDecodeImageCallback()
+    {
+        return pfnDecodeImage;
+    }
+
+    /** Encode band-sequential pixel values into an in-memory image.
+     * See EncodeImage().
+     */
+    typedef bool (*EncodeImageCallback)(int nXSize, int nYSize, int nBands,
+                                        GDALDataType eDT,
+                                        const void *const *papBandData,
+                                        const GDALColorTable *poColorTable,
+                                        CSLConstList papszOptions,
+                                        std::vector<GByte> &abyOut);
+    EncodeImageCallback pfnEncodeImage = nullptr;
+
+    virtual EncodeImageCallback GetEncodeImageCallback()
+    {
+        return pfnEncodeImage;
+    }
+
     /** Instantiate an algorithm by its full path (omitting leading "gdal").
      * For example {"driver", "pdf", "list-layers"}
      */
@@ -2958,6 +3023,10 @@ class GDALPluginDriverProxy : public GDALDriver
     CopyFilesCallback GetCopyFilesCallback() override;
 
     InstantiateAlgorithmCallback GetInstantiateAlgorithmCallback() override;
+
+    DecodeImageCallback GetDecodeImageCallback() override;
+
+    EncodeImageCallback GetEncodeImageCallback() override;
     //! @endcond
 
     CPLErr SetMetadataItem(const char *pszName, const char *pszValue,
@@ -5013,6 +5082,8 @@ GDALDataset CPL_DLL *GDALFindAssociatedAuxFile(const char *pszBasefile,
 
 int CPL_DLL GDALCheckDatasetDimensions(int nXSize, int nYSize);
 int CPL_DLL GDALCheckBandCount(int nBands, int bIsZeroAllowed);
+bool CPL_DLL GDALCheckDecodedImageSize(int nXSize, int nYSize,
+                                       CSLConstList papszOptions);
 
 /* Internal use only */
 
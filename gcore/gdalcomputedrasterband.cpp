@@ -33,6 +33,8 @@ class GDALComputedDataset final : public GDALDataset
 
     void AddSources(GDALComputedRasterBand *poBand);
 
+    bool IsFusableOperation() const;
+
     static const char *
     OperationToFunctionName(GDALComputedRasterBand::Operation op);
 
@@ -366,6 +368,24 @@ static bool HaveAllBandsSameNoDataValue(GDALRasterBand **apoBands,
     return true;
 }
 
+/************************************************************************/
+/*                 GDALComputedDataset::IsFusableOperation()            */
+/************************************************************************/
+
+/** Return whether the pixel function of this dataset is an associative
+ * operation (sum, mul, min or max) applied without constant, such that
+ * f(f(a, b), c) == f(a, b, c) when f(a, b) is computed as Float64.
+ */
+bool GDALComputedDataset::IsFusableOperation() const
+{
+    const char *pszFunc = m_aosOptions.FetchNameValue("PixelFunctionType");
+    return pszFunc &&
+           (EQUAL(pszFunc, "sum") || EQUAL(pszFunc, "mul") ||
+            EQUAL(pszFunc, "min") || EQUAL(pszFunc, "max")) &&
+           m_aosOptions.FetchNameValue("_PIXELFN_ARG_k") == nullptr &&
+           m_oVRTDS.GetRasterBand(1)->GetRasterDataType() == GDT_Float64;
+}
+
 /************************************************************************/
 /*                  GDALComputedDataset::AddSources()                   */
 /************************************************************************/
@@ -380,6 +400,49 @@ void GDALComputedDataset::AddSources(GDALComputedRasterBand *poBand)
     const bool bSameNDV = HaveAllBandsSameNoDataValue(
         m_poBands.data(), m_poBands.size(), hasAtLeastOneNDV, singleNDV);
 
+    // Fuse chains of the same operation, such as "a + b + c", which is
+    // evaluated as "(a + b) + c", into a single evaluation of the pixel
+    // function over all input bands, to avoid computing "a + b" into a
+    // temporary buffer. This is restricted to the case where there is no
+    // nodata and the intermediate result is Float64, so that the result
+    // is exactly the same. Only the left-most operand is fused, as
+    // floating-point addition and multiplication are not associative, and
+    // min and max do not handle NaN symmetrically. Sources of the fused band
+    // are read as Float64, as the intermediate result was.
+    if (!hasAtLeastOneNDV && IsFusableOperation())
+    {
+        const char *pszFunc = m_aosOptions.FetchNameValue("PixelFunctionType");
+        std::vector<GDALRasterBand *> apoFusedBands;
+        bool bFused = false;
+        for (GDALRasterBand *band : m_poBands)
+        {
+            auto poComputedDS =
+                dynamic_cast<GDALComputedDataset *>(band->GetDataset());
+            if (poComputedDS && apoFusedBands.empty() &&
+                poComputedDS->IsFusableOperation() &&
+                EQUAL(poComputedDS->m_aosOptions.FetchNameValue(
+                          "PixelFunctionType"),
+                      pszFunc))
+            {
+                apoFusedBands.insert(apoFusedBands.end(),
+                                     poComputedDS->m_poBands.begin(),
+                                     poComputedDS->m_poBands.end());
+                bFused = true;
+            }
+            else
+            {
+                apoFusedBands.push_back(band);
+            }
+        }
+        if (bFused)
+        {
+            m_aosOptions.SetNameValue("SourceTransferType", "Float64");
+            cpl::down_cast<VRTDerivedRasterBand *>(poSourcedRasterBand)
+                ->SetSourceTransferType(GDT_Float64);
+        }
+        m_poBands = std::move(apoFusedBands);
+    }
+
     // For inputs that are instances of GDALComputedDataset, clone them
     // to make sure we do not depend on temporary instances,
     // such as "a + b + c", which is evaluated as "(a + b) + c", and the
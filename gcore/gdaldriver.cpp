@@ -853,14 +853,18 @@ GDALDataset *GDALDriver::DefaultCreateCopy(const char *pszFilename,
     /* -------------------------------------------------------------------- */
     if (eErr == CE_None && nDstBands > 0)
     {
-        const char *const apszCopyRasterOptionsSkipHoles[] = {"SKIP_HOLES=YES",
-                                                              nullptr};
-        const bool bSkipHoles = CPLTestBool(
-            CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "FALSE"));
-        eErr = GDALDatasetCopyWholeRaster(
-            poSrcDS, poDstDS,
-            bSkipHoles ? apszCopyRasterOptionsSkipHoles : nullptr, pfnProgress,
-            pProgressData);
+        CPLStringList aosCopyRasterOptions;
+        if (CPLTestBool(
+                CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "FALSE")))
+            aosCopyRasterOptions.SetNameValue("SKIP_HOLES", "YES");
+        // Drivers that go through this code path and declare a NUM_THREADS
+        // creation option also benefit from a pipelined copy.
+        if (const char *pszNumThreads =
+                CSLFetchNameValue(papszOptions, "NUM_THREADS"))
+            aosCopyRasterOptions.SetNameValue("NUM_THREADS", pszNumThreads);
+        eErr = GDALDatasetCopyWholeRaster(poSrcDS, poDstDS,
+                                          aosCopyRasterOptions.List(),
+                                          pfnProgress, pProgressData);
     }
 
     /* -------------------------------------------------------------------- */
@@ -1504,6 +1508,120 @@ bool GDALDriver::HasOpenOption(const char *pszOpenOptionName) const
     return false;
 }
 
+/************************************************************************/
+/*                            DecodeImage()                             */
+/************************************************************************/
+
+/** Decode an in-memory encoded image, without instantiating a dataset.
+ *
+ * This is a lightweight alternative to opening a /vsimem/ file with
+ * GDALDataset::Open(), aimed at drivers that store tiles encoded in formats
+ * such as PNG, JPEG or WEBP. It is only available for drivers that implement
+ * pfnDecodeImage.
+ *
+ * The following options are recognized by all drivers:
+ * <ul>
+ * <li>MAX_XSIZE=n: fail, before allocating the decoded image, if the image is
+ * wider than n pixels.</li>
+ * <li>MAX_YSIZE=n: fail, before allocating the decoded image, if the image is
+ * higher than n pixels.</li>
+ * </ul>
+ *
+ * @param pSrc Encoded image.
+ * @param nSrcSize Size of pSrc in bytes.
+ * @param papszOptions Options, or nullptr.
+ * @param[out] sImage Decoded image, with band-sequential pixel values.
+ * @return true in case of success. false is returned without emitting an
+ * error if the content is not recognized as being in the format of the
+ * driver.
+ * @since GDAL 3.12
+ */
+bool GDALDriver::DecodeImage(const void *pSrc, size_t nSrcSize,
+                             CSLConstList papszOptions,
+                             GDALDecodedImage &sImage)
+{
+    const auto pfnDecodeImageCallback = GetDecodeImageCallback();
+    if (!pfnDecodeImageCallback)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "DecodeImage() not supported by driver %s", GetDescription());
+        return false;
+    }
+    return pfnDecodeImageCallback(pSrc, nSrcSize, papszOptions, sImage);
+}
+
+/************************************************************************/
+/*                     GDALCheckDecodedImageSize()                      */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+/** Check the dimensions read from the header of an image against the
+ * MAX_XSIZE and MAX_YSIZE options of GDALDriver::DecodeImage().
+ *
+ * To be called by the DecodeImage() callback of drivers, before allocating
+ * the decoded image. Emits an error and returns false if they are exceeded.
+ */
+bool GDALCheckDecodedImageSize(int nXSize, int nYSize,
+                               CSLConstList papszOptions)
+{
+    const int nMaxXSize =
+        atoi(CSLFetchNameValueDef(papszOptions, "MAX_XSIZE", "0"));
+    const int nMaxYSize =
+        atoi(CSLFetchNameValueDef(papszOptions, "MAX_YSIZE", "0"));
+    if ((nMaxXSize > 0 && nXSize > nMaxXSize) ||
+        (nMaxYSize > 0 && nYSize > nMaxYSize))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Image dimensions %dx%d exceed the maximum allowed ones",
+                 nXSize, nYSize);
+        return false;
+    }
+    return true;
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                            EncodeImage()                             */
+/************************************************************************/
+
+/** Encode pixel values into an in-memory image, without instantiating a
+ * dataset.
+ *
+ * This is a lightweight alternative to CreateCopy() into a /vsimem/ file, aimed
+ * at drivers that store tiles encoded in formats such as PNG, JPEG or WEBP.
+ * It is only available for drivers that implement pfnEncodeImage.
+ *
+ * @param nXSize Width in pixels.
+ * @param nYSize Height in pixels.
+ * @param nBands Number of bands.
+ * @param eDT Data type of pixel values.
+ * @param papBandData Array of nBands pointers, each to nXSize * nYSize
+ * values of type eDT.
+ * @param poColorTable Color table for a single-band image, or nullptr.
+ * @param papszOptions Driver specific options, generally a subset of its
+ * creation options (e.g. QUALITY), or nullptr.
+ * @param[out] abyOut Encoded image.
+ * @return true in case of success.
+ * @since GDAL 3.12
+ */
+bool GDALDriver::EncodeImage(int nXSize, int nYSize, int nBands,
+                             GDALDataType eDT, const void *const *papBandData,
+                             const GDALColorTable *poColorTable,
+                             CSLConstList papszOptions,
+                             std::vector<GByte> &abyOut)
+{
+    const auto pfnEncodeImageCallback = GetEncodeImageCallback();
+    if (!pfnEncodeImageCallback)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "EncodeImage() not supported by driver %s", GetDescription());
+        return false;
+    }
+    return pfnEncodeImageCallback(nXSize, nYSize, nBands, eDT, papBandData,
+                                  poColorTable, papszOptions, abyOut);
+}
+
 /************************************************************************/
 /*                         VectorTranslateFrom()                        */
 /************************************************************************/
@@ -1321,6 +1321,8 @@ DEFINE_DRIVER_METHOD_GET_CALLBACK(GetRenameCallback, RenameCallback)
 DEFINE_DRIVER_METHOD_GET_CALLBACK(GetCopyFilesCallback, CopyFilesCallback)
 DEFINE_DRIVER_METHOD_GET_CALLBACK(GetInstantiateAlgorithmCallback,
                                   InstantiateAlgorithmCallback)
+DEFINE_DRIVER_METHOD_GET_CALLBACK(GetDecodeImageCallback, DecodeImageCallback)
+DEFINE_DRIVER_METHOD_GET_CALLBACK(GetEncodeImageCallback, EncodeImageCallback)
 
 //! @endcond
 
@@ -754,6 +754,14 @@ class XMMReg2Double
         return reg;
     }
 
+    static inline XMMReg2Double Max(const XMMReg2Double &expr1,
+                                    const XMMReg2Double &expr2)
+    {
+        XMMReg2Double reg;
+        reg.xmm = _mm_max_pd(expr1.xmm, expr2.xmm);
+        return reg;
+    }
+
     inline void nsLoad1ValHighAndLow(const double *ptr)
     {
         xmm = _mm_load1_pd(ptr);
@@ -1116,6 +1124,15 @@ class XMMReg2Double
         return reg;
     }
 
+    static inline XMMReg2Double Max(const XMMReg2Double &expr1,
+                                    const XMMReg2Double &expr2)
+    {
+        XMMReg2Double reg;
+        reg.low = (expr1.low > expr2.low) ? expr1.low : expr2.low;
+        reg.high = (expr1.high > expr2.high) ? expr1.high : expr2.high;
+        return reg;
+    }
+
     static inline XMMReg2Double Load2Val(const double *ptr)
     {
         XMMReg2Double reg;
@@ -1119,6 +1119,16 @@ GDALRasterAttributeTable *GDALThreadSafeRasterBand::GetDefaultRAT()
  * excludes operations on vector layers (OGRLayer) or multidimensional API
  * (GDALGroup, GDALMDArray, etc.)
  *
+ * The default implementation returns true only for datasets opened with
+ * GDAL_OF_THREAD_SAFE. Drivers whose read-only raster operations are natively
+ * thread-safe (for example because they do not use the block cache nor shared
+ * file positions) may override this method to return true for
+ * nScopeFlags == GDAL_OF_RASTER. In that case, GDALGetThreadSafeDataset()
+ * and GDALOpenEx() with GDAL_OF_THREAD_SAFE return the dataset itself instead
+ * of a wrapper holding per-thread clones.
+ *
+ * The implementation of this method must be thread-safe.
+ *
  * This is the same as the C function GDALDatasetIsThreadSafe().
  *
  * @since 3.10
@@ -25,18 +25,24 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
+#include <functional>
 #include <limits>
+#include <mutex>
 #include <stdexcept>
 #include <type_traits>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "gdal_vrt.h"
 #include "gdalwarper.h"
 #include "memdataset.h"
@@ -1001,6 +1007,306 @@ static int GDALRasterIOTransformer(void *pTransformerArg, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*                   GDALRasterIOResampledGetChunks()                   */
+/************************************************************************/
+
+namespace
+{
+// Window of the output buffer processed at once by RasterIOResampled(),
+// and source window read for it.
+struct GDALRasterIOResampledChunk
+{
+    int nDstXOff = 0;
+    int nDstYOff = 0;
+    int nDstXCount = 0;
+    int nDstYCount = 0;
+    int nChunkXOffQueried = 0;
+    int nChunkYOffQueried = 0;
+    int nChunkXSizeQueried = 0;
+    int nChunkYSizeQueried = 0;
+};
+
+// Source buffers of a chunk, and state set when reading it.
+struct GDALRasterIOResampledChunkBuffers
+{
+    std::unique_ptr<void, VSIFreeReleaser> pChunk{};
+    std::unique_ptr<GByte, VSIFreeReleaser> pabyChunkNoDataMask{};
+    bool bSkipResample = false;
+    bool bNoDataMaskFullyOpaque = false;
+};
+}  // namespace
+
+static std::vector<GDALRasterIOResampledChunk> GDALRasterIOResampledGetChunks(
+    int nXOff, int nYOff, int nBufXSize, int nBufYSize, int nDstBlockXSize,
+    int nDstBlockYSize, double dfXRatioDstToSrc, double dfYRatioDstToSrc,
+    int nRasterXSize, int nRasterYSize, int nXMargin, int nYMargin)
+{
+    std::vector<GDALRasterIOResampledChunk> asChunks;
+    for (int nDstYOff = 0; nDstYOff < nBufYSize; nDstYOff += nDstBlockYSize)
+    {
+        const int nDstYCount = std::min(nDstBlockYSize, nBufYSize - nDstYOff);
+
+        const int nChunkYOff =
+            nYOff + static_cast<int>(nDstYOff * dfYRatioDstToSrc);
+        int nChunkYOff2 =
+            nYOff + 1 +
+            static_cast<int>(ceil((nDstYOff + nDstYCount) * dfYRatioDstToSrc));
+        if (nChunkYOff2 > nRasterYSize)
+            nChunkYOff2 = nRasterYSize;
+        const int nYCount = nChunkYOff2 - nChunkYOff;
+
+        int nChunkYOffQueried = nChunkYOff - nYMargin;
+        int nChunkYSizeQueried = nYCount + 2 * nYMargin;
+        if (nChunkYOffQueried < 0)
+        {
+            nChunkYSizeQueried += nChunkYOffQueried;
+            nChunkYOffQueried = 0;
+        }
+        if (nChunkYSizeQueried + nChunkYOffQueried > nRasterYSize)
+            nChunkYSizeQueried = nRasterYSize - nChunkYOffQueried;
+
+        for (int nDstXOff = 0; nDstXOff < nBufXSize; nDstXOff += nDstBlockXSize)
+        {
+            const int nDstXCount =
+                std::min(nDstBlockXSize, nBufXSize - nDstXOff);
+
+            const int nChunkXOff =
+                nXOff + static_cast<int>(nDstXOff * dfXRatioDstToSrc);
+            int nChunkXOff2 =
+                nXOff + 1 +
+                static_cast<int>(
+                    ceil((nDstXOff + nDstXCount) * dfXRatioDstToSrc));
+            if (nChunkXOff2 > nRasterXSize)
+                nChunkXOff2 = nRasterXSize;
+            const int nXCount = nChunkXOff2 - nChunkXOff;
+
+            int nChunkXOffQueried = nChunkXOff - nXMargin;
+            int nChunkXSizeQueried = nXCount + 2 * nXMargin;
+            if (nChunkXOffQueried < 0)
+            {
+                nChunkXSizeQueried += nChunkXOffQueried;
+                nChunkXOffQueried = 0;
+            }
+            if (nChunkXSizeQueried + nChunkXOffQueried > nRasterXSize)
+                nChunkXSizeQueried = nRasterXSize - nChunkXOffQueried;
+
+            GDALRasterIOResampledChunk sChunk;
+            sChunk.nDstXOff = nDstXOff;
+            sChunk.nDstYOff = nDstYOff;
+            sChunk.nDstXCount = nDstXCount;
+            sChunk.nDstYCount = nDstYCount;
+            sChunk.nChunkXOffQueried = nChunkXOffQueried;
+            sChunk.nChunkYOffQueried = nChunkYOffQueried;
+            sChunk.nChunkXSizeQueried = nChunkXSizeQueried;
+            sChunk.nChunkYSizeQueried = nChunkYSizeQueried;
+            asChunks.push_back(sChunk);
+        }
+    }
+    return asChunks;
+}
+
+/************************************************************************/
+/*                 GDALRasterIOResampledCopyToBuffer()                  */
+/************************************************************************/
+
+// Copy a packed nXCount x nYCount resampled buffer to the output buffer.
+// This is what writing it to a MEM band wrapping the output buffer does, but
+// without going through GDALRasterBand::RasterIO(), so that it can be done
+// concurrently for different chunks.
+static void GDALRasterIOResampledCopyToBuffer(const void *pSrc,
+                                              GDALDataType eSrcDT, int nXCount,
+                                              int nYCount, GByte *pabyDst,
+                                              GDALDataType eDstDT,
+                                              GSpacing nPixelSpace,
+                                              GSpacing nLineSpace)
+{
+    const int nSrcDTSize = GDALGetDataTypeSizeBytes(eSrcDT);
+    for (int j = 0; j < nYCount; ++j)
+    {
+        GDALCopyWords64(static_cast<const GByte *>(pSrc) +
+                            static_cast<size_t>(j) * nXCount * nSrcDTSize,
+                        eSrcDT, nSrcDTSize, pabyDst + j * nLineSpace, eDstDT,
+                        static_cast<int>(nPixelSpace), nXCount);
+    }
+}
+
+/************************************************************************/
+/*                 GDALRasterIOResampledProcessChunks()                 */
+/************************************************************************/
+
+// Run the read and resampling steps of each chunk of RasterIOResampled().
+// Read() fills the source buffers of a chunk, and may set bSkipResample if
+// it has directly filled the output buffer. Resample() resamples the source
+// buffers and writes the result in the output buffer.
+// When the GDAL_NUM_THREADS configuration option is set, chunks are resampled
+// by worker threads of the global thread pool, each chunk with its own
+// buffers. Source reads are also done by the worker threads if
+// bThreadSafeRead is true, or by the calling thread otherwise.
+template <class ReadFunc, class ResampleFunc>
+static CPLErr GDALRasterIOResampledProcessChunks(
+    const std::vector<GDALRasterIOResampledChunk> &asChunks,
+    size_t nChunkBufSize, size_t nMaskBufSize, bool bThreadSafeRead,
+    ReadFunc Read, ResampleFunc Resample, GDALRasterIOExtraArg *psExtraArg)
+{
+    const auto AllocBuffers =
+        [nChunkBufSize, nMaskBufSize](GDALRasterIOResampledChunkBuffers &s)
+    {
+        s.pChunk.reset(VSI_MALLOC_VERBOSE(nChunkBufSize));
+        if (nMaskBufSize)
+            s.pabyChunkNoDataMask.reset(
+                static_cast<GByte *>(VSI_MALLOC_VERBOSE(nMaskBufSize)));
+        return s.pChunk && (nMaskBufSize == 0 || s.pabyChunkNoDataMask);
+    };
+
+    const auto ReadAndResample =
+        [&Read, &Resample](const GDALRasterIOResampledChunk &sChunk,
+                           GDALRasterIOResampledChunkBuffers &sBuffers)
+    {
+        CPLErr eErr = Read(sChunk, sBuffers);
+        if (eErr == CE_None && !sBuffers.bSkipResample)
+            eErr = Resample(sChunk, sBuffers);
+        return eErr;
+    };
+
+    const size_t nTotalChunks = asChunks.size();
+    const auto ReportProgress = [psExtraArg, nTotalChunks](size_t nDone)
+    {
+        return psExtraArg->pfnProgress == nullptr ||
+               psExtraArg->pfnProgress(static_cast<double>(nDone) /
+                                           static_cast<double>(nTotalChunks),
+                                       "", psExtraArg->pProgressData);
+    };
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = static_cast<int>(std::min<size_t>(
+        nTotalChunks,
+        std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszThreads)))));
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+
+    if (!poJobQueue)
+    {
+        GDALRasterIOResampledChunkBuffers sBuffers;
+        if (!AllocBuffers(sBuffers))
+            return CE_Failure;
+        CPLErr eErr = CE_None;
+        for (size_t i = 0; i < nTotalChunks && eErr == CE_None; ++i)
+        {
+            eErr = ReadAndResample(asChunks[i], sBuffers);
+            if (eErr == CE_None && !ReportProgress(i + 1))
+                eErr = CE_Failure;
+        }
+        return eErr;
+    }
+
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::vector<std::unique_ptr<GDALRasterIOResampledChunkBuffers>>
+        apoFreeBuffers;
+    int nAllocatedBuffers = 0;
+    size_t nDone = 0;
+    bool bJobFailed = false;
+    CPLErrorAccumulator oErrorAccumulator;
+
+    CPLErr eErr = CE_None;
+    size_t nDoneReported = 0;
+    for (size_t i = 0; i < nTotalChunks && eErr == CE_None; ++i)
+    {
+        // Wait for a free set of buffers, if all threads are busy
+        std::unique_ptr<GDALRasterIOResampledChunkBuffers> poBuffers;
+        size_t nCurDone;
+        {
+            std::unique_lock<std::mutex> oLock(oMutex);
+            oCV.wait(oLock,
+                     [&]
+                     {
+                         return bJobFailed || !apoFreeBuffers.empty() ||
+                                nAllocatedBuffers < nThreads;
+                     });
+            if (bJobFailed)
+            {
+                eErr = CE_Failure;
+                break;
+            }
+            if (!apoFreeBuffers.empty())
+            {
+                poBuffers = std::move(apoFreeBuffers.back());
+                apoFreeBuffers.pop_back();
+            }
+            else
+            {
+                ++nAllocatedBuffers;
+            }
+            nCurDone = nDone;
+        }
+        if (!poBuffers)
+        {
+            poBuffers = std::make_unique<GDALRasterIOResampledChunkBuffers>();
+            if (!AllocBuffers(*poBuffers))
+            {
+                eErr = CE_Failure;
+                break;
+            }
+        }
+
+        if (nCurDone > nDoneReported)
+        {
+            nDoneReported = nCurDone;
+            if (!ReportProgress(nDoneReported))
+            {
+                eErr = CE_Failure;
+                break;
+            }
+        }
+
+        if (!bThreadSafeRead)
+        {
+            eErr = Read(asChunks[i], *poBuffers);
+            if (eErr != CE_None)
+                break;
+        }
+
+        auto psBuffers = poBuffers.release();
+        const auto Job = [&, i, psBuffers]()
+        {
+            const auto &sChunk = asChunks[i];
+            CPLErr eErrJob = CE_None;
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                if (bThreadSafeRead)
+                    eErrJob = ReadAndResample(sChunk, *psBuffers);
+                else if (!psBuffers->bSkipResample)
+                    eErrJob = Resample(sChunk, *psBuffers);
+            }
+
+            std::lock_guard<std::mutex> oLock(oMutex);
+            apoFreeBuffers.emplace_back(psBuffers);
+            ++nDone;
+            if (eErrJob != CE_None)
+                bJobFailed = true;
+            oCV.notify_one();
+        };
+        if (!poJobQueue->SubmitJob(Job))
+            Job();
+    }
+
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    if (eErr == CE_None && bJobFailed)
+        eErr = CE_Failure;
+    if (eErr == CE_None && nDoneReported < nTotalChunks &&
+        !ReportProgress(nTotalChunks))
+        eErr = CE_Failure;
+    return eErr;
+}
+
 /************************************************************************/
 /*                          RasterIOResampled()                         */
 /************************************************************************/
@@ -1279,209 +1585,137 @@ CPLErr GDALRasterBand::RasterIOResampled(
         if (nFullResYSizeQueried > nRasterYSize)
             nFullResYSizeQueried = nRasterYSize;
 
-        void *pChunk =
-            VSI_MALLOC3_VERBOSE(GDALGetDataTypeSizeBytes(eWrkDataType),
-                                nFullResXSizeQueried, nFullResYSizeQueried);
-        GByte *pabyChunkNoDataMask = nullptr;
-
         GDALRasterBand *poMaskBand = GetMaskBand();
-        int l_nMaskFlags = GetMaskFlags();
-
-        bool bUseNoDataMask = ((l_nMaskFlags & GMF_ALL_VALID) == 0);
-        if (bUseNoDataMask)
+        const int l_nMaskFlags = GetMaskFlags();
+        const bool bUseNoDataMask = ((l_nMaskFlags & GMF_ALL_VALID) == 0);
+        const GDALColorTable *poColorTable = GetColorTable();
+        GDALRasterBand *poMEMBand = GDALRasterBand::FromHandle(hMEMBand);
+
+        const auto asChunks = GDALRasterIOResampledGetChunks(
+            nXOff, nYOff, nBufXSize, nBufYSize, nDstBlockXSize, nDstBlockYSize,
+            dfXRatioDstToSrc, dfYRatioDstToSrc, nRasterXSize, nRasterYSize,
+            nKernelRadius * nOvrXFactor, nKernelRadius * nOvrYFactor);
+
+        const auto Read = [&](const GDALRasterIOResampledChunk &sChunk,
+                              GDALRasterIOResampledChunkBuffers &sBuffers)
         {
-            pabyChunkNoDataMask = static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
-                nFullResXSizeQueried, nFullResYSizeQueried));
-        }
-        if (pChunk == nullptr ||
-            (bUseNoDataMask && pabyChunkNoDataMask == nullptr))
-        {
-            GDALClose(poMEMDS);
-            CPLFree(pChunk);
-            CPLFree(pabyChunkNoDataMask);
-            VSIFree(pTempBuffer);
-            return CE_Failure;
-        }
+            sBuffers.bSkipResample = false;
+            sBuffers.bNoDataMaskFullyOpaque = false;
 
-        const int nTotalBlocks = DIV_ROUND_UP(nBufXSize, nDstBlockXSize) *
-                                 DIV_ROUND_UP(nBufYSize, nDstBlockYSize);
-        int nBlocksDone = 0;
+            // Read the source buffers.
+            CPLErr eErrRead = RasterIO(
+                GF_Read, sChunk.nChunkXOffQueried, sChunk.nChunkYOffQueried,
+                sChunk.nChunkXSizeQueried, sChunk.nChunkYSizeQueried,
+                sBuffers.pChunk.get(), sChunk.nChunkXSizeQueried,
+                sChunk.nChunkYSizeQueried, eWrkDataType, 0, 0, nullptr);
 
-        int nDstYOff;
-        for (nDstYOff = 0; nDstYOff < nBufYSize && eErr == CE_None;
-             nDstYOff += nDstBlockYSize)
-        {
-            int nDstYCount;
-            if (nDstYOff + nDstBlockYSize <= nBufYSize)
-                nDstYCount = nDstBlockYSize;
-            else
-                nDstYCount = nBufYSize - nDstYOff;
-
-            int nChunkYOff =
-                nYOff + static_cast<int>(nDstYOff * dfYRatioDstToSrc);
-            int nChunkYOff2 = nYOff + 1 +
-                              static_cast<int>(ceil((nDstYOff + nDstYCount) *
-                                                    dfYRatioDstToSrc));
-            if (nChunkYOff2 > nRasterYSize)
-                nChunkYOff2 = nRasterYSize;
-            int nYCount = nChunkYOff2 - nChunkYOff;
-            CPLAssert(nYCount <= nFullResYChunk);
-
-            int nChunkYOffQueried = nChunkYOff - nKernelRadius * nOvrYFactor;
-            int nChunkYSizeQueried = nYCount + 2 * nKernelRadius * nOvrYFactor;
-            if (nChunkYOffQueried < 0)
+            if (eErrRead == CE_None && bUseNoDataMask)
             {
-                nChunkYSizeQueried += nChunkYOffQueried;
-                nChunkYOffQueried = 0;
-            }
-            if (nChunkYSizeQueried + nChunkYOffQueried > nRasterYSize)
-                nChunkYSizeQueried = nRasterYSize - nChunkYOffQueried;
-            CPLAssert(nChunkYSizeQueried <= nFullResYSizeQueried);
-
-            int nDstXOff = 0;
-            for (nDstXOff = 0; nDstXOff < nBufXSize && eErr == CE_None;
-                 nDstXOff += nDstBlockXSize)
-            {
-                int nDstXCount = 0;
-                if (nDstXOff + nDstBlockXSize <= nBufXSize)
-                    nDstXCount = nDstBlockXSize;
-                else
-                    nDstXCount = nBufXSize - nDstXOff;
-
-                int nChunkXOff =
-                    nXOff + static_cast<int>(nDstXOff * dfXRatioDstToSrc);
-                int nChunkXOff2 =
-                    nXOff + 1 +
-                    static_cast<int>(
-                        ceil((nDstXOff + nDstXCount) * dfXRatioDstToSrc));
-                if (nChunkXOff2 > nRasterXSize)
-                    nChunkXOff2 = nRasterXSize;
-                int nXCount = nChunkXOff2 - nChunkXOff;
-                CPLAssert(nXCount <= nFullResXChunk);
-
-                int nChunkXOffQueried =
-                    nChunkXOff - nKernelRadius * nOvrXFactor;
-                int nChunkXSizeQueried =
-                    nXCount + 2 * nKernelRadius * nOvrXFactor;
-                if (nChunkXOffQueried < 0)
+                GByte *pabyChunkNoDataMask = sBuffers.pabyChunkNoDataMask.get();
+                eErrRead = poMaskBand->RasterIO(
+                    GF_Read, sChunk.nChunkXOffQueried, sChunk.nChunkYOffQueried,
+                    sChunk.nChunkXSizeQueried, sChunk.nChunkYSizeQueried,
+                    pabyChunkNoDataMask, sChunk.nChunkXSizeQueried,
+                    sChunk.nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
+
+                /* Optimizations if mask if fully opaque or transparent */
+                const int nPixels =
+                    sChunk.nChunkXSizeQueried * sChunk.nChunkYSizeQueried;
+                const GByte bVal = pabyChunkNoDataMask[0];
+                int i = 1;
+                for (; i < nPixels; i++)
                 {
-                    nChunkXSizeQueried += nChunkXOffQueried;
-                    nChunkXOffQueried = 0;
+                    if (pabyChunkNoDataMask[i] != bVal)
+                        break;
                 }
-                if (nChunkXSizeQueried + nChunkXOffQueried > nRasterXSize)
-                    nChunkXSizeQueried = nRasterXSize - nChunkXOffQueried;
-                CPLAssert(nChunkXSizeQueried <= nFullResXSizeQueried);
-
-                // Read the source buffers.
-                eErr = RasterIO(GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                                nChunkXSizeQueried, nChunkYSizeQueried, pChunk,
-                                nChunkXSizeQueried, nChunkYSizeQueried,
-                                eWrkDataType, 0, 0, nullptr);
-
-                bool bSkipResample = false;
-                bool bNoDataMaskFullyOpaque = false;
-                if (eErr == CE_None && bUseNoDataMask)
+                if (eErrRead == CE_None && i == nPixels)
                 {
-                    eErr = poMaskBand->RasterIO(
-                        GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                        nChunkXSizeQueried, nChunkYSizeQueried,
-                        pabyChunkNoDataMask, nChunkXSizeQueried,
-                        nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
-
-                    /* Optimizations if mask if fully opaque or transparent */
-                    int nPixels = nChunkXSizeQueried * nChunkYSizeQueried;
-                    GByte bVal = pabyChunkNoDataMask[0];
-                    int i = 1;
-                    for (; i < nPixels; i++)
+                    if (bVal == 0)
                     {
-                        if (pabyChunkNoDataMask[i] != bVal)
-                            break;
-                    }
-                    if (i == nPixels)
-                    {
-                        if (bVal == 0)
+                        for (int j = 0; j < sChunk.nDstYCount; j++)
                         {
-                            for (int j = 0; j < nDstYCount; j++)
-                            {
-                                GDALCopyWords64(&dfNoDataValue, GDT_Float64, 0,
-                                                static_cast<GByte *>(pDataMem) +
-                                                    nLSMem * (j + nDstYOff) +
-                                                    nDstXOff * nPSMem,
-                                                eDTMem,
-                                                static_cast<int>(nPSMem),
-                                                nDstXCount);
-                            }
-                            bSkipResample = true;
-                        }
-                        else
-                        {
-                            bNoDataMaskFullyOpaque = true;
+                            GDALCopyWords64(
+                                &dfNoDataValue, GDT_Float64, 0,
+                                static_cast<GByte *>(pDataMem) +
+                                    nLSMem * (j + sChunk.nDstYOff) +
+                                    sChunk.nDstXOff * nPSMem,
+                                eDTMem, static_cast<int>(nPSMem),
+                                sChunk.nDstXCount);
                         }
+                        sBuffers.bSkipResample = true;
                     }
-                }
-
-                if (!bSkipResample && eErr == CE_None)
-                {
-                    const bool bPropagateNoData = false;
-                    void *pDstBuffer = nullptr;
-                    GDALDataType eDstBufferDataType = GDT_Unknown;
-                    GDALRasterBand *poMEMBand =
-                        GDALRasterBand::FromHandle(hMEMBand);
-                    GDALOverviewResampleArgs args;
-                    args.eSrcDataType = eDataType;
-                    args.eOvrDataType = poMEMBand->GetRasterDataType();
-                    args.nOvrXSize = poMEMBand->GetXSize();
-                    args.nOvrYSize = poMEMBand->GetYSize();
-                    args.nOvrNBITS = nNBITS;
-                    args.dfXRatioDstToSrc = dfXRatioDstToSrc;
-                    args.dfYRatioDstToSrc = dfYRatioDstToSrc;
-                    args.dfSrcXDelta =
-                        dfXOff - nXOff; /* == 0 if bHasXOffVirtual */
-                    args.dfSrcYDelta =
-                        dfYOff - nYOff; /* == 0 if bHasYOffVirtual */
-                    args.eWrkDataType = eWrkDataType;
-                    args.pabyChunkNodataMask =
-                        bNoDataMaskFullyOpaque ? nullptr : pabyChunkNoDataMask;
-                    args.nChunkXOff =
-                        nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff);
-                    args.nChunkXSize = nChunkXSizeQueried;
-                    args.nChunkYOff =
-                        nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff);
-                    args.nChunkYSize = nChunkYSizeQueried;
-                    args.nDstXOff = nDstXOff + nDestXOffVirtual;
-                    args.nDstXOff2 = nDstXOff + nDestXOffVirtual + nDstXCount;
-                    args.nDstYOff = nDstYOff + nDestYOffVirtual;
-                    args.nDstYOff2 = nDstYOff + nDestYOffVirtual + nDstYCount;
-                    args.pszResampling = pszResampling;
-                    args.bHasNoData = bHasNoData;
-                    args.dfNoDataValue = dfNoDataValue;
-                    args.poColorTable = GetColorTable();
-                    args.bPropagateNoData = bPropagateNoData;
-                    eErr = pfnResampleFunc(args, pChunk, &pDstBuffer,
-                                           &eDstBufferDataType);
-                    if (eErr == CE_None)
+                    else
                     {
-                        eErr = poMEMBand->RasterIO(
-                            GF_Write, nDstXOff + nDestXOffVirtual,
-                            nDstYOff + nDestYOffVirtual, nDstXCount, nDstYCount,
-                            pDstBuffer, nDstXCount, nDstYCount,
-                            eDstBufferDataType, 0, 0, nullptr);
+                        sBuffers.bNoDataMaskFullyOpaque = true;
                     }
-                    CPLFree(pDstBuffer);
-                }
-
-                nBlocksDone++;
-                if (eErr == CE_None && psExtraArg->pfnProgress != nullptr &&
-                    !psExtraArg->pfnProgress(1.0 * nBlocksDone / nTotalBlocks,
-                                             "", psExtraArg->pProgressData))
-                {
-                    eErr = CE_Failure;
                 }
             }
-        }
+            return eErrRead;
+        };
 
-        CPLFree(pChunk);
-        CPLFree(pabyChunkNoDataMask);
+        const auto Resample =
+            [&](const GDALRasterIOResampledChunk &sChunk,
+                const GDALRasterIOResampledChunkBuffers &sBuffers)
+        {
+            const bool bPropagateNoData = false;
+            void *pDstBuffer = nullptr;
+            GDALDataType eDstBufferDataType = GDT_Unknown;
+            GDALOverviewResampleArgs args;
+            args.eSrcDataType = eDataType;
+            args.eOvrDataType = poMEMBand->GetRasterDataType();
+            args.nOvrXSize = poMEMBand->GetXSize();
+            args.nOvrYSize = poMEMBand->GetYSize();
+            args.nOvrNBITS = nNBITS;
+            args.dfXRatioDstToSrc = dfXRatioDstToSrc;
+            args.dfYRatioDstToSrc = dfYRatioDstToSrc;
+            args.dfSrcXDelta = dfXOff - nXOff; /* == 0 if bHasXOffVirtual */
+            args.dfSrcYDelta = dfYOff - nYOff; /* == 0 if bHasYOffVirtual */
+            args.eWrkDataType = eWrkDataType;
+            args.pabyChunkNodataMask = sBuffers.bNoDataMaskFullyOpaque
+                                           ? nullptr
+                                           : sBuffers.pabyChunkNoDataMask.get();
+            args.nChunkXOff =
+                sChunk.nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff);
+            args.nChunkXSize = sChunk.nChunkXSizeQueried;
+            args.nChunkYOff =
+                sChunk.nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff);
+            args.nChunkYSize = sChunk.nChunkYSizeQueried;
+            args.nDstXOff = sChunk.nDstXOff + nDestXOffVirtual;
+            args.nDstXOff2 =
+                sChunk.nDstXOff + nDestXOffVirtual + sChunk.nDstXCount;
+            args.nDstYOff = sChunk.nDstYOff + nDestYOffVirtual;
+            args.nDstYOff2 =
+                sChunk.nDstYOff + nDestYOffVirtual + sChunk.nDstYCount;
+            args.pszResampling = pszResampling;
+            args.bHasNoData = bHasNoData;
+            args.dfNoDataValue = dfNoDataValue;
+            args.poColorTable = poColorTable;
+            args.bPropagateNoData = bPropagateNoData;
+            CPLErr eErrResample = pfnResampleFunc(
+                args, sBuffers.pChunk.get(), &pDstBuffer, &eDstBufferDataType);
+            if (eErrResample == CE_None)
+            {
+                GDALRasterIOResampledCopyToBuffer(
+                    pDstBuffer, eDstBufferDataType, sChunk.nDstXCount,
+                    sChunk.nDstYCount,
+                    static_cast<GByte *>(pDataMem) + nLSMem * sChunk.nDstYOff +
+                        nPSMem * sChunk.nDstXOff,
+                    eDTMem, nPSMem, nLSMem);
+            }
+            CPLFree(pDstBuffer);
+            return eErrResample;
+        };
+
+        const bool bThreadSafeRead =
+            poDS != nullptr && poDS->IsThreadSafe(GDAL_OF_RASTER);
+        eErr = GDALRasterIOResampledProcessChunks(
+            asChunks,
+            static_cast<size_t>(GDALGetDataTypeSizeBytes(eWrkDataType)) *
+                nFullResXSizeQueried * nFullResYSizeQueried,
+            bUseNoDataMask ? static_cast<size_t>(nFullResXSizeQueried) *
+                                 nFullResYSizeQueried
+                           : 0,
+            bThreadSafeRead, Read, Resample, psExtraArg);
     }
 
     if (eBufType != eDataType)
@@ -1746,256 +1980,187 @@ CPLErr GDALDataset::RasterIOResampled(
         if (nFullResYSizeQueried > nRasterYSize)
             nFullResYSizeQueried = nRasterYSize;
 
-        void *pChunk = VSI_MALLOC3_VERBOSE(
-            cpl::fits_on<int>(GDALGetDataTypeSizeBytes(eWrkDataType) *
-                              nBandCount),
-            nFullResXSizeQueried, nFullResYSizeQueried);
-        GByte *pabyChunkNoDataMask = nullptr;
-
         GDALRasterBand *poMaskBand = poFirstSrcBand->GetMaskBand();
-        int nMaskFlags = poFirstSrcBand->GetMaskFlags();
-
-        bool bUseNoDataMask = ((nMaskFlags & GMF_ALL_VALID) == 0);
-        if (bUseNoDataMask)
-        {
-            pabyChunkNoDataMask = static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
-                nFullResXSizeQueried, nFullResYSizeQueried));
-        }
-        if (pChunk == nullptr ||
-            (bUseNoDataMask && pabyChunkNoDataMask == nullptr))
-        {
-            GDALClose(poMEMDS);
-            CPLFree(pChunk);
-            CPLFree(pabyChunkNoDataMask);
-            CPLFree(papoDstBands);
-            return CE_Failure;
-        }
+        const int nMaskFlags = poFirstSrcBand->GetMaskFlags();
+        const bool bUseNoDataMask = ((nMaskFlags & GMF_ALL_VALID) == 0);
 
-        const int nTotalBlocks = DIV_ROUND_UP(nBufXSize, nDstBlockXSize) *
-                                 DIV_ROUND_UP(nBufYSize, nDstBlockYSize);
-        int nBlocksDone = 0;
+        const auto asChunks = GDALRasterIOResampledGetChunks(
+            nXOff, nYOff, nBufXSize, nBufYSize, nDstBlockXSize, nDstBlockYSize,
+            dfXRatioDstToSrc, dfYRatioDstToSrc, nRasterXSize, nRasterYSize,
+            nKernelRadius * nOvrFactor, nKernelRadius * nOvrFactor);
 
-        int nDstYOff;
-        for (nDstYOff = 0; nDstYOff < nBufYSize && eErr == CE_None;
-             nDstYOff += nDstBlockYSize)
+        const auto Read = [&](const GDALRasterIOResampledChunk &sChunk,
+                              GDALRasterIOResampledChunkBuffers &sBuffers)
         {
-            int nDstYCount;
-            if (nDstYOff + nDstBlockYSize <= nBufYSize)
-                nDstYCount = nDstBlockYSize;
-            else
-                nDstYCount = nBufYSize - nDstYOff;
-
-            int nChunkYOff =
-                nYOff + static_cast<int>(nDstYOff * dfYRatioDstToSrc);
-            int nChunkYOff2 = nYOff + 1 +
-                              static_cast<int>(ceil((nDstYOff + nDstYCount) *
-                                                    dfYRatioDstToSrc));
-            if (nChunkYOff2 > nRasterYSize)
-                nChunkYOff2 = nRasterYSize;
-            int nYCount = nChunkYOff2 - nChunkYOff;
-            CPLAssert(nYCount <= nFullResYChunk);
-
-            int nChunkYOffQueried = nChunkYOff - nKernelRadius * nOvrFactor;
-            int nChunkYSizeQueried = nYCount + 2 * nKernelRadius * nOvrFactor;
-            if (nChunkYOffQueried < 0)
-            {
-                nChunkYSizeQueried += nChunkYOffQueried;
-                nChunkYOffQueried = 0;
-            }
-            if (nChunkYSizeQueried + nChunkYOffQueried > nRasterYSize)
-                nChunkYSizeQueried = nRasterYSize - nChunkYOffQueried;
-            CPLAssert(nChunkYSizeQueried <= nFullResYSizeQueried);
+            sBuffers.bSkipResample = false;
+            sBuffers.bNoDataMaskFullyOpaque = false;
 
-            int nDstXOff;
-            for (nDstXOff = 0; nDstXOff < nBufXSize && eErr == CE_None;
-                 nDstXOff += nDstBlockXSize)
+            CPLErr eErrRead = CE_None;
+            if (bUseNoDataMask)
             {
-                int nDstXCount;
-                if (nDstXOff + nDstBlockXSize <= nBufXSize)
-                    nDstXCount = nDstBlockXSize;
-                else
-                    nDstXCount = nBufXSize - nDstXOff;
-
-                int nChunkXOff =
-                    nXOff + static_cast<int>(nDstXOff * dfXRatioDstToSrc);
-                int nChunkXOff2 =
-                    nXOff + 1 +
-                    static_cast<int>(
-                        ceil((nDstXOff + nDstXCount) * dfXRatioDstToSrc));
-                if (nChunkXOff2 > nRasterXSize)
-                    nChunkXOff2 = nRasterXSize;
-                int nXCount = nChunkXOff2 - nChunkXOff;
-                CPLAssert(nXCount <= nFullResXChunk);
-
-                int nChunkXOffQueried = nChunkXOff - nKernelRadius * nOvrFactor;
-                int nChunkXSizeQueried =
-                    nXCount + 2 * nKernelRadius * nOvrFactor;
-                if (nChunkXOffQueried < 0)
+                GByte *pabyChunkNoDataMask = sBuffers.pabyChunkNoDataMask.get();
+                eErrRead = poMaskBand->RasterIO(
+                    GF_Read, sChunk.nChunkXOffQueried, sChunk.nChunkYOffQueried,
+                    sChunk.nChunkXSizeQueried, sChunk.nChunkYSizeQueried,
+                    pabyChunkNoDataMask, sChunk.nChunkXSizeQueried,
+                    sChunk.nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
+
+                /* Optimizations if mask if fully opaque or transparent */
+                const int nPixels =
+                    sChunk.nChunkXSizeQueried * sChunk.nChunkYSizeQueried;
+                const GByte bVal = pabyChunkNoDataMask[0];
+                int i = 1;  // Used after for.
+                for (; i < nPixels; i++)
                 {
-                    nChunkXSizeQueried += nChunkXOffQueried;
-                    nChunkXOffQueried = 0;
+                    if (pabyChunkNoDataMask[i] != bVal)
+                        break;
                 }
-                if (nChunkXSizeQueried + nChunkXOffQueried > nRasterXSize)
-                    nChunkXSizeQueried = nRasterXSize - nChunkXOffQueried;
-                CPLAssert(nChunkXSizeQueried <= nFullResXSizeQueried);
-
-                bool bSkipResample = false;
-                bool bNoDataMaskFullyOpaque = false;
-                if (eErr == CE_None && bUseNoDataMask)
+                if (eErrRead == CE_None && i == nPixels)
                 {
-                    eErr = poMaskBand->RasterIO(
-                        GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                        nChunkXSizeQueried, nChunkYSizeQueried,
-                        pabyChunkNoDataMask, nChunkXSizeQueried,
-                        nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
-
-                    /* Optimizations if mask if fully opaque or transparent */
-                    const int nPixels = nChunkXSizeQueried * nChunkYSizeQueried;
-                    const GByte bVal = pabyChunkNoDataMask[0];
-                    int i = 1;  // Used after for.
-                    for (; i < nPixels; i++)
-                    {
-                        if (pabyChunkNoDataMask[i] != bVal)
-                            break;
-                    }
-                    if (i == nPixels)
+                    if (bVal == 0)
                     {
-                        if (bVal == 0)
+                        GByte abyZero[16] = {0};
+                        for (int iBand = 0; iBand < nBandCount; iBand++)
                         {
-                            GByte abyZero[16] = {0};
-                            for (int iBand = 0; iBand < nBandCount; iBand++)
+                            for (int j = 0; j < sChunk.nDstYCount; j++)
                             {
-                                for (int j = 0; j < nDstYCount; j++)
-                                {
-                                    GDALCopyWords64(
-                                        abyZero, GDT_Byte, 0,
-                                        static_cast<GByte *>(pData) +
-                                            iBand * nBandSpace +
-                                            nLineSpace * (j + nDstYOff) +
-                                            nDstXOff * nPixelSpace,
-                                        eBufType, static_cast<int>(nPixelSpace),
-                                        nDstXCount);
-                                }
+                                GDALCopyWords64(
+                                    abyZero, GDT_Byte, 0,
+                                    static_cast<GByte *>(pData) +
+                                        iBand * nBandSpace +
+                                        nLineSpace * (j + sChunk.nDstYOff) +
+                                        sChunk.nDstXOff * nPixelSpace,
+                                    eBufType, static_cast<int>(nPixelSpace),
+                                    sChunk.nDstXCount);
                             }
-                            bSkipResample = true;
-                        }
-                        else
-                        {
-                            bNoDataMaskFullyOpaque = true;
                         }
+                        sBuffers.bSkipResample = true;
+                    }
+                    else
+                    {
+                        sBuffers.bNoDataMaskFullyOpaque = true;
                     }
                 }
+            }
 
-                if (!bSkipResample && eErr == CE_None)
-                {
-                    /* Read the source buffers */
-                    eErr = RasterIO(
-                        GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                        nChunkXSizeQueried, nChunkYSizeQueried, pChunk,
-                        nChunkXSizeQueried, nChunkYSizeQueried, eWrkDataType,
-                        nBandCount, panBandMap, 0, 0, 0, nullptr);
-                }
+            if (!sBuffers.bSkipResample && eErrRead == CE_None)
+            {
+                /* Read the source buffers */
+                eErrRead = RasterIO(
+                    GF_Read, sChunk.nChunkXOffQueried, sChunk.nChunkYOffQueried,
+                    sChunk.nChunkXSizeQueried, sChunk.nChunkYSizeQueried,
+                    sBuffers.pChunk.get(), sChunk.nChunkXSizeQueried,
+                    sChunk.nChunkYSizeQueried, eWrkDataType, nBandCount,
+                    panBandMap, 0, 0, 0, nullptr);
+            }
+            return eErrRead;
+        };
 
+        const auto Resample =
+            [&](const GDALRasterIOResampledChunk &sChunk,
+                const GDALRasterIOResampledChunkBuffers &sBuffers)
+        {
+            CPLErr eErrResample = CE_None;
+            const GByte *pabyChunkNoDataMask =
+                sBuffers.bNoDataMaskFullyOpaque
+                    ? nullptr
+                    : sBuffers.pabyChunkNoDataMask.get();
 #ifdef GDAL_ENABLE_RESAMPLING_MULTIBAND
-                if (pfnResampleFuncMultiBands && !bSkipResample &&
-                    eErr == CE_None)
-                {
-                    eErr = pfnResampleFuncMultiBands(
-                        dfXRatioDstToSrc, dfYRatioDstToSrc,
-                        dfXOff - nXOff, /* == 0 if bHasXOffVirtual */
-                        dfYOff - nYOff, /* == 0 if bHasYOffVirtual */
-                        eWrkDataType, (GByte *)pChunk, nBandCount,
-                        bNoDataMaskFullyOpaque ? nullptr : pabyChunkNoDataMask,
-                        nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff),
-                        nChunkXSizeQueried,
-                        nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff),
-                        nChunkYSizeQueried, nDstXOff + nDestXOffVirtual,
-                        nDstXOff + nDestXOffVirtual + nDstXCount,
-                        nDstYOff + nDestYOffVirtual,
-                        nDstYOff + nDestYOffVirtual + nDstYCount, papoDstBands,
-                        pszResampling, FALSE /*bHasNoData*/,
-                        0.0 /* dfNoDataValue */, nullptr /* color table*/,
-                        eDataType);
-                }
-                else
+            if (pfnResampleFuncMultiBands)
+            {
+                eErrResample = pfnResampleFuncMultiBands(
+                    dfXRatioDstToSrc, dfYRatioDstToSrc,
+                    dfXOff - nXOff, /* == 0 if bHasXOffVirtual */
+                    dfYOff - nYOff, /* == 0 if bHasYOffVirtual */
+                    eWrkDataType, (GByte *)sBuffers.pChunk.get(), nBandCount,
+                    pabyChunkNoDataMask,
+                    sChunk.nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff),
+                    sChunk.nChunkXSizeQueried,
+                    sChunk.nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff),
+                    sChunk.nChunkYSizeQueried,
+                    sChunk.nDstXOff + nDestXOffVirtual,
+                    sChunk.nDstXOff + nDestXOffVirtual + sChunk.nDstXCount,
+                    sChunk.nDstYOff + nDestYOffVirtual,
+                    sChunk.nDstYOff + nDestYOffVirtual + sChunk.nDstYCount,
+                    papoDstBands, pszResampling, FALSE /*bHasNoData*/,
+                    0.0 /* dfNoDataValue */, nullptr /* color table*/,
+                    eDataType);
+            }
+            else
 #endif
+            {
+                const size_t nChunkBandOffset =
+                    static_cast<size_t>(sChunk.nChunkXSizeQueried) *
+                    sChunk.nChunkYSizeQueried *
+                    GDALGetDataTypeSizeBytes(eWrkDataType);
+                for (int i = 0; i < nBandCount && eErrResample == CE_None;
+                     i++)
                 {
-                    size_t nChunkBandOffset =
-                        static_cast<size_t>(nChunkXSizeQueried) *
-                        nChunkYSizeQueried *
-                        GDALGetDataTypeSizeBytes(eWrkDataType);
-                    for (int i = 0;
-                         i < nBandCount && !bSkipResample && eErr == CE_None;
-                         i++)
+                    const bool bPropagateNoData = false;
+                    void *pDstBuffer = nullptr;
+                    GDALDataType eDstBufferDataType = GDT_Unknown;
+                    GDALRasterBand *poMEMBand = poMEMDS->GetRasterBand(i + 1);
+                    GDALOverviewResampleArgs args;
+                    args.eSrcDataType = eDataType;
+                    args.eOvrDataType = poMEMBand->GetRasterDataType();
+                    args.nOvrXSize = poMEMBand->GetXSize();
+                    args.nOvrYSize = poMEMBand->GetYSize();
+                    args.nOvrNBITS = nNBITS;
+                    args.dfXRatioDstToSrc = dfXRatioDstToSrc;
+                    args.dfYRatioDstToSrc = dfYRatioDstToSrc;
+                    args.dfSrcXDelta =
+                        dfXOff - nXOff; /* == 0 if bHasXOffVirtual */
+                    args.dfSrcYDelta =
+                        dfYOff - nYOff; /* == 0 if bHasYOffVirtual */
+                    args.eWrkDataType = eWrkDataType;
+                    args.pabyChunkNodataMask = pabyChunkNoDataMask;
+                    args.nChunkXOff = sChunk.nChunkXOffQueried -
+                                      (bHasXOffVirtual ? 0 : nXOff);
+                    args.nChunkXSize = sChunk.nChunkXSizeQueried;
+                    args.nChunkYOff = sChunk.nChunkYOffQueried -
+                                      (bHasYOffVirtual ? 0 : nYOff);
+                    args.nChunkYSize = sChunk.nChunkYSizeQueried;
+                    args.nDstXOff = sChunk.nDstXOff + nDestXOffVirtual;
+                    args.nDstXOff2 =
+                        sChunk.nDstXOff + nDestXOffVirtual + sChunk.nDstXCount;
+                    args.nDstYOff = sChunk.nDstYOff + nDestYOffVirtual;
+                    args.nDstYOff2 =
+                        sChunk.nDstYOff + nDestYOffVirtual + sChunk.nDstYCount;
+                    args.pszResampling = pszResampling;
+                    args.bHasNoData = false;
+                    args.dfNoDataValue = 0.0;
+                    args.poColorTable = nullptr;
+                    args.bPropagateNoData = bPropagateNoData;
+
+                    eErrResample = pfnResampleFunc(
+                        args,
+                        static_cast<GByte *>(sBuffers.pChunk.get()) +
+                            i * nChunkBandOffset,
+                        &pDstBuffer, &eDstBufferDataType);
+                    if (eErrResample == CE_None)
                     {
-                        const bool bPropagateNoData = false;
-                        void *pDstBuffer = nullptr;
-                        GDALDataType eDstBufferDataType = GDT_Unknown;
-                        GDALRasterBand *poMEMBand =
-                            poMEMDS->GetRasterBand(i + 1);
-                        GDALOverviewResampleArgs args;
-                        args.eSrcDataType = eDataType;
-                        args.eOvrDataType = poMEMBand->GetRasterDataType();
-                        args.nOvrXSize = poMEMBand->GetXSize();
-                        args.nOvrYSize = poMEMBand->GetYSize();
-                        args.nOvrNBITS = nNBITS;
-                        args.dfXRatioDstToSrc = dfXRatioDstToSrc;
-                        args.dfYRatioDstToSrc = dfYRatioDstToSrc;
-                        args.dfSrcXDelta =
-                            dfXOff - nXOff; /* == 0 if bHasXOffVirtual */
-                        args.dfSrcYDelta =
-                            dfYOff - nYOff; /* == 0 if bHasYOffVirtual */
-                        args.eWrkDataType = eWrkDataType;
-                        args.pabyChunkNodataMask = bNoDataMaskFullyOpaque
-                                                       ? nullptr
-                                                       : pabyChunkNoDataMask;
-                        args.nChunkXOff =
-                            nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff);
-                        args.nChunkXSize = nChunkXSizeQueried;
-                        args.nChunkYOff =
-                            nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff);
-                        args.nChunkYSize = nChunkYSizeQueried;
-                        args.nDstXOff = nDstXOff + nDestXOffVirtual;
-                        args.nDstXOff2 =
-                            nDstXOff + nDestXOffVirtual + nDstXCount;
-                        args.nDstYOff = nDstYOff + nDestYOffVirtual;
-                        args.nDstYOff2 =
-                            nDstYOff + nDestYOffVirtual + nDstYCount;
-                        args.pszResampling = pszResampling;
-                        args.bHasNoData = false;
-                        args.dfNoDataValue = 0.0;
-                        args.poColorTable = nullptr;
-                        args.bPropagateNoData = bPropagateNoData;
-
-                        eErr =
-                            pfnResampleFunc(args,
-                                            reinterpret_cast<GByte *>(pChunk) +
-                                                i * nChunkBandOffset,
-                                            &pDstBuffer, &eDstBufferDataType);
-                        if (eErr == CE_None)
-                        {
-                            eErr = poMEMBand->RasterIO(
-                                GF_Write, nDstXOff + nDestXOffVirtual,
-                                nDstYOff + nDestYOffVirtual, nDstXCount,
-                                nDstYCount, pDstBuffer, nDstXCount, nDstYCount,
-                                eDstBufferDataType, 0, 0, nullptr);
-                        }
-                        CPLFree(pDstBuffer);
+                        GDALRasterIOResampledCopyToBuffer(
+                            pDstBuffer, eDstBufferDataType, sChunk.nDstXCount,
+                            sChunk.nDstYCount,
+                            static_cast<GByte *>(pData) + i * nBandSpace +
+                                nLineSpace * sChunk.nDstYOff +
+                                nPixelSpace * sChunk.nDstXOff,
+                            eBufType, nPixelSpace, nLineSpace);
                     }
-                }
-
-                nBlocksDone++;
-                if (eErr == CE_None && psExtraArg->pfnProgress != nullptr &&
-                    !psExtraArg->pfnProgress(1.0 * nBlocksDone / nTotalBlocks,
-                                             "", psExtraArg->pProgressData))
-                {
-                    eErr = CE_Failure;
+                    CPLFree(pDstBuffer);
                 }
             }
-        }
+            return eErrResample;
+        };
 
-        CPLFree(pChunk);
-        CPLFree(pabyChunkNoDataMask);
+        eErr = GDALRasterIOResampledProcessChunks(
+            asChunks,
+            static_cast<size_t>(GDALGetDataTypeSizeBytes(eWrkDataType)) *
+                nBandCount * nFullResXSizeQueried * nFullResYSizeQueried,
+            bUseNoDataMask ? static_cast<size_t>(nFullResXSizeQueried) *
+                                 nFullResYSizeQueried
+                           : 0,
+            IsThreadSafe(GDAL_OF_RASTER), Read, Resample, psExtraArg);
     }
 
     CPLFree(papoDstBands);
@@ -4697,6 +4862,260 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
     *pnSwathLines = nSwathLines;
 }
 
+/************************************************************************/
+/*              GDALDatasetCopyWholeRasterMultiThreaded()               */
+/************************************************************************/
+
+namespace
+{
+struct GDALCopyWholeRasterSwath
+{
+    int nBand = 0;  // 0 for all bands (pixel interleaved case)
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+};
+}  // namespace
+
+// Pipelined version of GDALDatasetCopyWholeRaster(), where source swaths are
+// read by worker threads, while the calling thread writes the previously
+// read ones, in the same order as the single-threaded code path.
+// Several swaths are read concurrently only if the source dataset is
+// thread-safe. Worker threads never wait: a new read is submitted, either by
+// the calling thread or by the job that completes, when a swath buffer is
+// free.
+static CPLErr GDALDatasetCopyWholeRasterMultiThreaded(
+    GDALDataset *poSrcDS, GDALDataset *poDstDS, GDALDataType eDT,
+    bool bInterleave, bool bCheckHoles, int nSwathCols, int nSwathLines,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nXSize = poDstDS->GetRasterXSize();
+    const int nYSize = poDstDS->GetRasterYSize();
+    const int nBandCount = poDstDS->GetRasterCount();
+
+    std::vector<GDALCopyWholeRasterSwath> asSwaths;
+    for (int iBand = 0; iBand < (bInterleave ? 1 : nBandCount); iBand++)
+    {
+        for (int iY = 0; iY < nYSize; iY += nSwathLines)
+        {
+            for (int iX = 0; iX < nXSize; iX += nSwathCols)
+            {
+                GDALCopyWholeRasterSwath sSwath;
+                sSwath.nBand = bInterleave ? 0 : iBand + 1;
+                sSwath.nXOff = iX;
+                sSwath.nYOff = iY;
+                sSwath.nXSize = std::min(nSwathCols, nXSize - iX);
+                sSwath.nYSize = std::min(nSwathLines, nYSize - iY);
+                asSwaths.push_back(sSwath);
+            }
+        }
+    }
+    const size_t nSwaths = asSwaths.size();
+
+    const int nPixelSize =
+        GDALGetDataTypeSizeBytes(eDT) * (bInterleave ? nBandCount : 1);
+    // Cannot overflow: the caller checked that two swaths fit in the block
+    // cache.
+    const size_t nSwathBufSize =
+        static_cast<size_t>(nSwathCols) * nSwathLines * nPixelSize;
+
+    const int nMaxConcurrentReads =
+        poSrcDS->IsThreadSafe(GDAL_OF_RASTER) ? nThreads : 1;
+    // One buffer per concurrent read, plus the one being written, but do not
+    // use more memory than the block cache size.
+    const int nBuffers = static_cast<int>(std::max<GIntBig>(
+        2, std::min<GIntBig>(nMaxConcurrentReads + 1,
+                             GDALGetCacheMax64() /
+                                 std::max<size_t>(1, nSwathBufSize))));
+
+    std::vector<std::unique_ptr<GByte, VSIFreeReleaser>> apabyBuffers;
+    for (int i = 0; i < nBuffers; ++i)
+    {
+        apabyBuffers.emplace_back(static_cast<GByte *>(
+            VSI_MALLOC_VERBOSE(std::max<size_t>(1, nSwathBufSize))));
+        if (!apabyBuffers.back())
+            return CE_Failure;
+    }
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return CE_Failure;
+    auto poQueue = poThreadPool->CreateJobQueue();
+
+    CPLDebug("GDAL",
+             "GDALDatasetCopyWholeRaster(): using %d concurrent reads and "
+             "%d swath buffers",
+             nMaxConcurrentReads, nBuffers);
+
+    enum class SwathStatus
+    {
+        PENDING,
+        DATA,
+        EMPTY,
+        FAILED
+    };
+
+    struct State
+    {
+        std::mutex oMutex{};
+        std::condition_variable oCV{};
+        std::vector<SwathStatus> aeStatus{};
+        size_t nNextToRead = 0;
+        size_t nWritten = 0;
+        int nReadsInFlight = 0;
+        bool bStop = false;
+        CPLErrorAccumulator oErrorAccumulator{};
+    };
+
+    State sState;
+    sState.aeStatus.resize(nSwaths, SwathStatus::PENDING);
+
+    // Must not be called with sState.oMutex locked, as SubmitJob() may run
+    // the job synchronously when called from a worker thread of the pool.
+    std::function<void()> SubmitReads;
+    SubmitReads = [&]()
+    {
+        std::vector<size_t> anSwathsToRead;
+        {
+            std::lock_guard<std::mutex> oLock(sState.oMutex);
+            while (!sState.bStop &&
+                   sState.nReadsInFlight < nMaxConcurrentReads &&
+                   sState.nNextToRead < nSwaths &&
+                   sState.nNextToRead < sState.nWritten + nBuffers)
+            {
+                anSwathsToRead.push_back(sState.nNextToRead);
+                ++sState.nNextToRead;
+                ++sState.nReadsInFlight;
+            }
+        }
+
+        for (const size_t iSwath : anSwathsToRead)
+        {
+            const auto ReadJob = [&, iSwath]()
+            {
+                const auto &sSwath = asSwaths[iSwath];
+                GByte *pabyBuffer = apabyBuffers[iSwath % nBuffers].get();
+                SwathStatus eStatus = SwathStatus::DATA;
+                {
+                    auto oAccumulator =
+                        sState.oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+
+                    if (bCheckHoles)
+                    {
+                        int nStatus = 0;
+                        for (int iBand = 0; iBand < nBandCount; iBand++)
+                        {
+                            if (sSwath.nBand != 0 && sSwath.nBand != iBand + 1)
+                                continue;
+                            nStatus |=
+                                poSrcDS->GetRasterBand(iBand + 1)
+                                    ->GetDataCoverageStatus(
+                                        sSwath.nXOff, sSwath.nYOff,
+                                        sSwath.nXSize, sSwath.nYSize,
+                                        GDAL_DATA_COVERAGE_STATUS_DATA);
+                            if (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA)
+                                break;
+                        }
+                        if (!(nStatus & GDAL_DATA_COVERAGE_STATUS_DATA))
+                            eStatus = SwathStatus::EMPTY;
+                    }
+                    if (eStatus == SwathStatus::DATA)
+                    {
+                        int nBand = sSwath.nBand;
+                        if (poSrcDS->RasterIO(
+                                GF_Read, sSwath.nXOff, sSwath.nYOff,
+                                sSwath.nXSize, sSwath.nYSize, pabyBuffer,
+                                sSwath.nXSize, sSwath.nYSize, eDT,
+                                nBand ? 1 : nBandCount,
+                                nBand ? &nBand : nullptr, 0, 0, 0,
+                                nullptr) != CE_None)
+                        {
+                            eStatus = SwathStatus::FAILED;
+                        }
+                    }
+                }
+
+                {
+                    std::lock_guard<std::mutex> oLock(sState.oMutex);
+                    sState.aeStatus[iSwath] = eStatus;
+                    --sState.nReadsInFlight;
+                    if (eStatus == SwathStatus::FAILED)
+                        sState.bStop = true;
+                    sState.oCV.notify_one();
+                }
+                SubmitReads();
+            };
+            if (!poQueue->SubmitJob(ReadJob))
+            {
+                std::lock_guard<std::mutex> oLock(sState.oMutex);
+                --sState.nReadsInFlight;
+                sState.aeStatus[iSwath] = SwathStatus::FAILED;
+                sState.bStop = true;
+                sState.oCV.notify_one();
+            }
+        }
+    };
+
+    SubmitReads();
+
+    CPLErr eErr = CE_None;
+    for (size_t iSwath = 0; iSwath < nSwaths && eErr == CE_None; ++iSwath)
+    {
+        SwathStatus eStatus;
+        {
+            std::unique_lock<std::mutex> oLock(sState.oMutex);
+            sState.oCV.wait(oLock,
+                            [&sState, iSwath]
+                            {
+                                return sState.aeStatus[iSwath] !=
+                                           SwathStatus::PENDING ||
+                                       (sState.bStop &&
+                                        sState.nReadsInFlight == 0);
+                            });
+            eStatus = sState.aeStatus[iSwath];
+        }
+
+        if (eStatus == SwathStatus::DATA)
+        {
+            const auto &sSwath = asSwaths[iSwath];
+            int nBand = sSwath.nBand;
+            eErr = poDstDS->RasterIO(
+                GF_Write, sSwath.nXOff, sSwath.nYOff, sSwath.nXSize,
+                sSwath.nYSize, apabyBuffers[iSwath % nBuffers].get(),
+                sSwath.nXSize, sSwath.nYSize, eDT, nBand ? 1 : nBandCount,
+                nBand ? &nBand : nullptr, 0, 0, 0, nullptr);
+        }
+        else if (eStatus != SwathStatus::EMPTY)
+        {
+            eErr = CE_Failure;
+        }
+
+        if (eErr == CE_None &&
+            !pfnProgress(static_cast<double>(iSwath + 1) / nSwaths, nullptr,
+                         pProgressData))
+        {
+            eErr = CE_Failure;
+            CPLError(CE_Failure, CPLE_UserInterrupt,
+                     "User terminated CreateCopy()");
+        }
+
+        {
+            std::lock_guard<std::mutex> oLock(sState.oMutex);
+            ++sState.nWritten;
+            if (eErr != CE_None)
+                sState.bStop = true;
+        }
+        SubmitReads();
+    }
+
+    poQueue->WaitCompletion();
+    sState.oErrorAccumulator.ReplayErrors();
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                     GDALDatasetCopyWholeRaster()                     */
 /************************************************************************/
@@ -4722,6 +5141,11 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
  * sizes to achieve best compression.</li> <li>"SKIP_HOLES=YES" to skip chunks
  * for which GDALGetDataCoverageStatus() returns GDAL_DATA_COVERAGE_STATUS_EMPTY
  * (GDAL &gt;= 2.2)</li>
+ * <li>"NUM_THREADS=integer or ALL_CPUS" to read source swaths in worker
+ * threads, while the calling thread writes the previously read ones. Several
+ * swaths are read concurrently if the source dataset is thread-safe. The
+ * destination dataset is only accessed from the calling thread.
+ * (GDAL &gt;= 3.12)</li>
  * </ul>
  * More options may be supported in the future.
  *
@@ -4841,12 +5265,6 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     if (bInterleave)
         nPixelSize *= nBandCount;
 
-    void *pSwathBuf = VSI_MALLOC3_VERBOSE(nSwathCols, nSwathLines, nPixelSize);
-    if (pSwathBuf == nullptr)
-    {
-        return CE_Failure;
-    }
-
     CPLDebug("GDAL",
              "GDALDatasetCopyWholeRaster(): %d*%d swaths, bInterleave=%d",
              nSwathCols, nSwathLines, static_cast<int>(bInterleave));
@@ -4857,12 +5275,47 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     poSrcDS->AdviseRead(0, 0, nXSize, nYSize, nXSize, nYSize, eDT, nBandCount,
                         nullptr, nullptr);
 
+    const bool bCheckHoles =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
+
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads)
+    {
+        const int nThreads =
+            EQUAL(pszNumThreads, "ALL_CPUS")
+                ? CPLGetNumCPUs()
+                : std::max(1, std::min(atoi(pszNumThreads), 1024));
+        // The pipelined copy needs at least two swath buffers, which must
+        // fit in the block cache. Otherwise use the single-threaded path.
+        const GIntBig nSwathPixels =
+            static_cast<GIntBig>(nSwathCols) * nSwathLines;
+        if (nThreads > 1 &&
+            nSwathPixels > GDALGetCacheMax64() / 2 / nPixelSize)
+        {
+            CPLDebug("GDAL",
+                     "GDALDatasetCopyWholeRaster(): two swaths of %d*%d "
+                     "pixels do not fit in the block cache. Not using "
+                     "multithreading",
+                     nSwathCols, nSwathLines);
+        }
+        else if (nThreads > 1)
+        {
+            return GDALDatasetCopyWholeRasterMultiThreaded(
+                poSrcDS, poDstDS, eDT, bInterleave, bCheckHoles, nSwathCols,
+                nSwathLines, nThreads, pfnProgress, pProgressData);
+        }
+    }
+
+    void *pSwathBuf = VSI_MALLOC3_VERBOSE(nSwathCols, nSwathLines, nPixelSize);
+    if (pSwathBuf == nullptr)
+    {
+        return CE_Failure;
+    }
+
     /* ==================================================================== */
     /*      Band oriented (uninterleaved) case.                             */
     /* ==================================================================== */
     CPLErr eErr = CE_None;
-    const bool bCheckHoles =
-        CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
 
     if (!bInterleave)
     {
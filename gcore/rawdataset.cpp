@@ -26,6 +26,7 @@
 #endif
 #include <algorithm>
 #include <limits>
+#include <typeinfo>
 #include <vector>
 
 #include "cpl_conv.h"
@@ -34,6 +35,7 @@
 #include "cpl_string.h"
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 #include "cpl_safemaths.hpp"
 #include "gdal.h"
 #include "gdal_priv.h"
@@ -333,6 +335,32 @@ RawRasterBand::~RawRasterBand()
     CPLFree(pLineBuffer);
 }
 
+/************************************************************************/
+/*                       CanBeReadConcurrently()                        */
+/************************************************************************/
+
+/** Return whether the read code paths of this band only depend on the
+ * RawRasterBand implementation, and can thus be served with positional
+ * reads from several threads at once.
+ *
+ * Subclasses that do not override IReadBlock() or IRasterIO() can override
+ * this method to return true.
+ */
+bool RawRasterBand::CanBeReadConcurrently() const
+{
+    return typeid(*this) == typeid(RawRasterBand);
+}
+
+/************************************************************************/
+/*                          IsThreadSafeRead()                          */
+/************************************************************************/
+
+bool RawRasterBand::IsThreadSafeRead() const
+{
+    const auto poRawDS = dynamic_cast<const RawDataset *>(poDS);
+    return poRawDS != nullptr && poRawDS->AreReadsThreadSafe();
+}
+
 /************************************************************************/
 /*                              IsBIP()                                 */
 /************************************************************************/
@@ -643,6 +671,9 @@ CPLErr RawRasterBand::IReadBlock(CPL_UNUSED int nBlockXOff, int nBlockYOff,
 {
     CPLAssert(nBlockXOff == 0);
 
+    if (IsThreadSafeRead())
+        return ReadLineConcurrently(nBlockYOff, pImage);
+
     const CPLErr eErr = AccessLine(nBlockYOff);
     if (eErr == CE_Failure)
         return eErr;
@@ -683,6 +714,53 @@ CPLErr RawRasterBand::IReadBlock(CPL_UNUSED int nBlockXOff, int nBlockYOff,
     return eErr;
 }
 
+/************************************************************************/
+/*                        ReadLineConcurrently()                        */
+/************************************************************************/
+
+/** Read a scanline of this band with a positional read into a temporary
+ * buffer, instead of going through the shared line buffer and file position,
+ * so that it can be called from several threads at once.
+ */
+CPLErr RawRasterBand::ReadLineConcurrently(int iLine, void *pImage)
+{
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const int nAbsPixelOffset = std::abs(nPixelOffset);
+    const size_t nBytesToRead =
+        static_cast<size_t>(nAbsPixelOffset) * (nBlockXSize - 1) + nDTSize;
+    std::unique_ptr<GByte, VSIFreeReleaser> pabyLine(
+        static_cast<GByte *>(VSI_MALLOC_VERBOSE(nBytesToRead)));
+    if (!pabyLine)
+        return CE_Failure;
+
+    const vsi_l_offset nReadStart = ComputeFileOffset(iLine);
+    const size_t nBytesActuallyRead =
+        fpRawL->PRead(pabyLine.get(), nBytesToRead, nReadStart);
+    if (nBytesActuallyRead < nBytesToRead)
+    {
+        // ENVI datasets might be sparse (see #915)
+        if (poDS->GetMetadata("ENVI") == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Failed to read scanline %d.",
+                     iLine);
+            return CE_Failure;
+        }
+        memset(pabyLine.get() + nBytesActuallyRead, 0,
+               nBytesToRead - nBytesActuallyRead);
+    }
+
+    if (NeedsByteOrderChange())
+        DoByteSwap(pabyLine.get(), nBlockXSize, nAbsPixelOffset, true);
+
+    const GByte *pabyStart = pabyLine.get();
+    if (nPixelOffset < 0)
+        pabyStart += static_cast<size_t>(nAbsPixelOffset) * (nBlockXSize - 1);
+    GDALCopyWords64(pabyStart, eDataType, nPixelOffset, pImage, eDataType,
+                    nDTSize, nBlockXSize);
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                           BIPWriteBlock()                            */
 /************************************************************************/
@@ -918,15 +996,24 @@ bool RawRasterBand::FlushCurrentLine(bool bNeedUsableBufferAfter)
 CPLErr RawRasterBand::AccessBlock(vsi_l_offset nBlockOff, size_t nBlockSize,
                                   void *pData, size_t nValues)
 {
-    // Seek to the correct block.
-    if (Seek(nBlockOff, SEEK_SET) == -1)
+    size_t nBytesActuallyRead;
+    if (IsThreadSafeRead())
     {
-        memset(pData, 0, nBlockSize);
-        return CE_None;
+        // Positional read, that does not alter the shared file position.
+        nBytesActuallyRead = fpRawL->PRead(pData, nBlockSize, nBlockOff);
     }
+    else
+    {
+        // Seek to the correct block.
+        if (Seek(nBlockOff, SEEK_SET) == -1)
+        {
+            memset(pData, 0, nBlockSize);
+            return CE_None;
+        }
 
-    // Read the block.
-    const size_t nBytesActuallyRead = Read(pData, 1, nBlockSize);
+        // Read the block.
+        nBytesActuallyRead = Read(pData, 1, nBlockSize);
+    }
     if (nBytesActuallyRead < nBlockSize)
     {
 
@@ -1069,8 +1156,25 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 #endif
     const int nBufDataSize = GDALGetDataTypeSizeBytes(eBufType);
 
-    if (!CanUseDirectIO(nXOff, nYOff, nXSize, nYSize, eBufType, psExtraArg))
+    // For thread-safe datasets, non-resampled reads bypass the block cache.
+    const bool bThreadSafeRead = eRWFlag == GF_Read && IsThreadSafeRead();
+    const bool bThreadSafeDirectIO =
+        bThreadSafeRead && nXSize == nBufXSize && nYSize == nBufYSize &&
+        nPixelOffset >= 0 &&
+        !(psExtraArg->bFloatingPointWindowValidity &&
+          psExtraArg->eResampleAlg != GRIORA_NearestNeighbour &&
+          (nXOff != psExtraArg->dfXOff || nYOff != psExtraArg->dfYOff));
+    if (!bThreadSafeDirectIO &&
+        !CanUseDirectIO(nXOff, nYOff, nXSize, nYSize, eBufType, psExtraArg))
     {
+        // Other reads go through the block cache, which cannot be accessed
+        // concurrently.
+        std::unique_lock<std::recursive_mutex> oLock;
+        if (bThreadSafeRead)
+        {
+            oLock = std::unique_lock<std::recursive_mutex>(
+                cpl::down_cast<RawDataset *>(poDS)->m_oGenericReadMutex);
+        }
         return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
                                          pData, nBufXSize, nBufYSize, eBufType,
                                          nPixelSpace, nLineSpace, psExtraArg);
@@ -1662,21 +1766,34 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
             const bool bNeedsByteOrderChange =
                 poFirstBand->NeedsByteOrderChange();
+            const bool bThreadSafeRead = AreReadsThreadSafe();
             for (int iY = 0; iY < nYSize; ++iY)
             {
                 GByte *pabyOut = static_cast<GByte *>(pData) + iY * nLineSpace;
-                VSIFSeekL(poFirstBand->fpRawL,
-                          poFirstBand->nImgOffset +
-                              static_cast<vsi_l_offset>(nYOff + iY) *
-                                  poFirstBand->nLineOffset +
-                              static_cast<vsi_l_offset>(nXOff) *
-                                  poFirstBand->nPixelOffset,
-                          SEEK_SET);
-                if (VSIFReadL(pabyOut,
-                              static_cast<size_t>(nXSize * nPixelSpace), 1,
-                              poFirstBand->fpRawL) != 1)
+                const vsi_l_offset nOffset =
+                    poFirstBand->nImgOffset +
+                    static_cast<vsi_l_offset>(nYOff + iY) *
+                        poFirstBand->nLineOffset +
+                    static_cast<vsi_l_offset>(nXOff) *
+                        poFirstBand->nPixelOffset;
+                const size_t nBytesToRead =
+                    static_cast<size_t>(nXSize * nPixelSpace);
+                if (bThreadSafeRead)
                 {
-                    return CE_Failure;
+                    if (poFirstBand->fpRawL->PRead(pabyOut, nBytesToRead,
+                                                   nOffset) != nBytesToRead)
+                    {
+                        return CE_Failure;
+                    }
+                }
+                else
+                {
+                    VSIFSeekL(poFirstBand->fpRawL, nOffset, SEEK_SET);
+                    if (VSIFReadL(pabyOut, nBytesToRead, 1,
+                                  poFirstBand->fpRawL) != 1)
+                    {
+                        return CE_Failure;
+                    }
                 }
                 if (bNeedsByteOrderChange)
                 {
@@ -1728,6 +1845,18 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         }
     }
 
+    // In thread-safe read mode, GDALDataset::IRasterIO() may use the block
+    // cache through BlockBasedRasterIO() or resampled reads. Band-by-band
+    // requests are left to RawRasterBand::IRasterIO().
+    std::unique_lock<std::recursive_mutex> oLock;
+    if (eRWFlag == GF_Read && AreReadsThreadSafe() &&
+        (nXSize != nBufXSize || nYSize != nBufYSize ||
+         (nBandCount > 1 && pszInterleave != nullptr &&
+          EQUAL(pszInterleave, "PIXEL"))))
+    {
+        oLock = std::unique_lock<std::recursive_mutex>(m_oGenericReadMutex);
+    }
+
     return GDALDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize, pData,
                                   nBufXSize, nBufYSize, eBufType, nBandCount,
                                   panBandMap, nPixelSpace, nLineSpace,
@@ -1912,3 +2041,108 @@ void RawDataset::ClearCachedConfigOption(void)
 {
     cachedCPLOneBigReadOption = 0;
 }
+
+/************************************************************************/
+/*                      EvaluateThreadSafeReads()                       */
+/************************************************************************/
+
+/** Return 1 if all bands can be read concurrently, 0 if not, and -1 if this
+ * cannot be determined yet, because the dataset is still being opened.
+ */
+int RawDataset::EvaluateThreadSafeReads()
+{
+    // Drivers initialize the overview manager at the end of Open(), once
+    // bands and PAM metadata are set.
+    if (nBands == 0 || !oOvManager.IsInitialized())
+        return -1;
+
+    for (int i = 0; i < nBands; ++i)
+    {
+        auto poBand = dynamic_cast<RawRasterBand *>(papoBands[i]);
+        if (poBand == nullptr || !poBand->CanBeReadConcurrently() ||
+            poBand->fpRawL == nullptr || !poBand->fpRawL->HasPRead())
+        {
+            return 0;
+        }
+
+        // Overviews and .msk masks are served by other drivers.
+        if (poBand->GetOverviewCount() > 0)
+            return 0;
+
+        // This also instantiates the mask band, which is done lazily
+        // otherwise.
+        if ((poBand->GetMaskFlags() &
+             (GMF_ALL_VALID | GMF_NODATA | GMF_ALPHA)) == 0)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/************************************************************************/
+/*                         AreReadsThreadSafe()                         */
+/************************************************************************/
+
+bool RawDataset::AreReadsThreadSafe() const
+{
+    if (eAccess != GA_ReadOnly)
+        return false;
+
+    int nState = m_nThreadSafeReadState.load();
+    if (nState < 0)
+    {
+        std::lock_guard oLock(m_oThreadSafeReadMutex);
+        nState = m_nThreadSafeReadState.load();
+        if (nState < 0)
+        {
+            // Re-entrant calls from EvaluateThreadSafeReads() will see 0
+            m_nThreadSafeReadState = 0;
+            nState =
+                const_cast<RawDataset *>(this)->EvaluateThreadSafeReads();
+            m_nThreadSafeReadState = nState;
+        }
+    }
+    return nState == 1;
+}
+
+/************************************************************************/
+/*                            IsThreadSafe()                            */
+/************************************************************************/
+
+/** Implements GDALDataset::IsThreadSafe()
+ *
+ * Datasets opened in read-only mode, whose bands are all plain
+ * RawRasterBand (or opt in through CanBeReadConcurrently()) on a file handle
+ * supporting positional reads, are thread-safe for raster reads.
+ */
+bool RawDataset::IsThreadSafe(int nScopeFlags) const
+{
+    if (nScopeFlags == GDAL_OF_RASTER && AreReadsThreadSafe())
+        return true;
+    return GDALPamDataset::IsThreadSafe(nScopeFlags);
+}
+
+/************************************************************************/
+/*                          IBuildOverviews()                           */
+/************************************************************************/
+
+CPLErr RawDataset::IBuildOverviews(const char *pszResampling, int nOverviews,
+                                   const int *panOverviewList, int nListBands,
+                                   const int *panBandList,
+                                   GDALProgressFunc pfnProgress,
+                                   void *pProgressData,
+                                   CSLConstList papszOptions)
+{
+    const CPLErr eErr = GDALPamDataset::IBuildOverviews(
+        pszResampling, nOverviews, panOverviewList, nListBands, panBandList,
+        pfnProgress, pProgressData, papszOptions);
+
+    // Overviews are served by other drivers: re-evaluate whether reads are
+    // thread-safe.
+    std::lock_guard oLock(m_oThreadSafeReadMutex);
+    m_nThreadSafeReadState = -1;
+
+    return eErr;
+}
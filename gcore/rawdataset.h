@@ -18,6 +18,7 @@
 #include "gdal_pam.h"
 
 #include <atomic>
+#include <mutex>
 #include <utility>
 
 /************************************************************************/
@@ -56,8 +57,29 @@ class CPL_DLL RawDataset : public GDALPamDataset
     bool GetRawBinaryLayout(GDALDataset::RawBinaryLayout &) override;
     void ClearCachedConfigOption(void);
 
+    bool IsThreadSafe(int nScopeFlags) const override;
+
+    CPLErr IBuildOverviews(const char *pszResampling, int nOverviews,
+                           const int *panOverviewList, int nListBands,
+                           const int *panBandList, GDALProgressFunc pfnProgress,
+                           void *pProgressData,
+                           CSLConstList papszOptions) override;
+
   private:
     CPL_DISALLOW_COPY_ASSIGN(RawDataset)
+
+    // -1: not evaluated yet, 0: not thread-safe, 1: thread-safe reads
+    mutable std::atomic<int> m_nThreadSafeReadState{-1};
+    mutable std::mutex m_oThreadSafeReadMutex{};
+
+    // Serializes, in thread-safe read mode, the read code paths that cannot
+    // be served with positional reads, because they go through the block
+    // cache. Recursive, as dataset level reads call band level ones.
+    std::recursive_mutex m_oGenericReadMutex{};
+
+    int EvaluateThreadSafeReads();
+    bool AreReadsThreadSafe() const;
+
   protected:
     std::atomic<int> cachedCPLOneBigReadOption = {
         0};  // [0-7] bits are "valid", [8-15] bits are "value"
@@ -135,6 +157,8 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
     int CanUseDirectIO(int nXOff, int nYOff, int nXSize, int nYSize,
                        GDALDataType eBufType, GDALRasterIOExtraArg *psExtraArg);
 
+    virtual bool CanBeReadConcurrently() const;
+
   public:
     enum class OwnFP
     {
@@ -243,6 +267,8 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
     void DoByteSwap(void *pBuffer, size_t nValues, int nByteSkip,
                     bool bDiskToCPU) const;
     bool IsBIP() const;
+    bool IsThreadSafeRead() const;
+    CPLErr ReadLineConcurrently(int iLine, void *pImage);
     vsi_l_offset ComputeFileOffset(int iLine) const;
     bool FlushCurrentLine(bool bNeedUsableBufferAfter);
     CPLErr BIPWriteBlock(int nBlockYOff, int nCallingBand, const void *pImage);
@@ -10,6 +10,8 @@
 #include "ogr_geometry.h"
 #include "ogr_spatialref.h"
 
+#include <atomic>
+
 static OGRPoint *OGRGeoJSONReadPoint(json_object *poObj);
 static OGRMultiPoint *OGRGeoJSONReadMultiPoint(json_object *poObj);
 static OGRLineString *OGRGeoJSONReadLineString(json_object *poObj,
@@ -284,12 +286,19 @@ static bool OGRGeoJSONReadRawPoint(json_object *poObj, OGRPoint &point)
         {
             if (nSize > GeoJSONObject::eMaxCoordinateDimension)
             {
-                CPLErrorOnce(CE_Warning, CPLE_AppDefined,
+                // Not CPLErrorOnce(), as this may run concurrently on
+                // GeoJSONSeq worker threads
+                static std::atomic<bool> bWarned{false};
+                if (!bWarned.exchange(true))
+                {
+                    CPLError(CE_Warning, CPLE_AppDefined,
                              "OGRGeoJSONReadRawPoint(): too many members in "
                              "array '%s': %d. At most %d are handled. Ignoring "
-                             "extra members.",
+                             "extra members. Further messages of this type "
+                             "will be suppressed.",
                              json_object_to_json_string(poObj), nSize,
                              GeoJSONObject::eMaxCoordinateDimension);
+                }
             }
             // Don't *expect* mixed-dimension geometries, although the
             // spec doesn't explicitly forbid this.
@@ -10,6 +10,7 @@
 #include "ogr_geometry.h"
 #include "ogr_p.h"
 
+#include <atomic>
 #include <cmath>
 
 /************************************************************************/
@@ -307,10 +308,9 @@ OGRFieldType GeoJSONPropertyToFieldType(json_object *poObject,
         {
             if (nVal == MY_INT64_MIN || nVal == MY_INT64_MAX)
             {
-                static bool bWarned = false;
-                if (!bWarned)
+                static std::atomic<bool> bWarned{false};
+                if (!bWarned.exchange(true))
                 {
-                    bWarned = true;
                     CPLError(
                         CE_Warning, CPLE_AppDefined,
                         "Integer values probably ranging out of 64bit integer "
@@ -23,6 +23,12 @@
 #include <limits>
 #include <new>
 
+// Restrict to 64bit processors because they are guaranteed to have SSE2
+#if defined(__x86_64) || defined(_M_X64)
+#define USE_SSE2
+#include "gdalsse_priv.h"
+#endif
+
 namespace
 {
 
@@ -2090,8 +2096,39 @@ double OGRSimpleCurve::get_Length() const
 
 {
     double dfLength = 0.0;
+    int i = 0;
+
+#ifdef USE_SSE2
+    // Process 2 segments at a time: each point is loaded as a (x, y) pair,
+    // and the squared lengths of both segments are computed in the 2 lanes
+    // of a single register.
+    // Even and odd segments are summed separately, so the result may differ
+    // in the last bits from a purely sequential summation.
+    if (nPointCount >= 3)
+    {
+        __m128d xmmSum = _mm_setzero_pd();
+        __m128d xmmPrev = _mm_loadu_pd(&(paoPoints[0].x));
+        for (; i + 2 < nPointCount; i += 2)
+        {
+            const __m128d xmmP1 = _mm_loadu_pd(&(paoPoints[i + 1].x));
+            const __m128d xmmP2 = _mm_loadu_pd(&(paoPoints[i + 2].x));
+            const __m128d xmmD0 = _mm_sub_pd(xmmP1, xmmPrev);
+            const __m128d xmmD1 = _mm_sub_pd(xmmP2, xmmP1);
+            const __m128d xmmSq0 = _mm_mul_pd(xmmD0, xmmD0);
+            const __m128d xmmSq1 = _mm_mul_pd(xmmD1, xmmD1);
+            const __m128d xmmSqLen =
+                _mm_add_pd(_mm_unpacklo_pd(xmmSq0, xmmSq1),
+                           _mm_unpackhi_pd(xmmSq0, xmmSq1));
+            xmmSum = _mm_add_pd(xmmSum, _mm_sqrt_pd(xmmSqLen));
+            xmmPrev = xmmP2;
+        }
+        double adfSum[2];
+        _mm_storeu_pd(adfSum, xmmSum);
+        dfLength = adfSum[0] + adfSum[1];
+    }
+#endif
 
-    for (int i = 0; i < nPointCount - 1; i++)
+    for (; i < nPointCount - 1; i++)
     {
 
         const double dfDeltaX = paoPoints[i + 1].x - paoPoints[i].x;
@@ -2446,6 +2483,44 @@ void OGRSimpleCurve::getEnvelope(OGREnvelope *psEnvelope) const
         return;
     }
 
+#ifdef USE_SSE2
+    // Each point is loaded as a (x, y) pair, so X and Y extents are computed
+    // simultaneously. Two accumulators are used to shorten dependency chains.
+    // Min(val, acc) and Max(val, acc) return acc when val is NaN, which
+    // matches the behavior of the scalar code.
+    auto oMin0 = XMMReg2Double::Load2Val(&(paoPoints[0].x));
+    auto oMax0 = oMin0;
+    auto oMin1 = oMin0;
+    auto oMax1 = oMin0;
+    int iPoint = 1;
+    for (; iPoint + 1 < nPointCount; iPoint += 2)
+    {
+        const auto oXY0 = XMMReg2Double::Load2Val(&(paoPoints[iPoint].x));
+        const auto oXY1 = XMMReg2Double::Load2Val(&(paoPoints[iPoint + 1].x));
+        oMin0 = XMMReg2Double::Min(oXY0, oMin0);
+        oMax0 = XMMReg2Double::Max(oXY0, oMax0);
+        oMin1 = XMMReg2Double::Min(oXY1, oMin1);
+        oMax1 = XMMReg2Double::Max(oXY1, oMax1);
+    }
+    if (iPoint < nPointCount)
+    {
+        const auto oXY0 = XMMReg2Double::Load2Val(&(paoPoints[iPoint].x));
+        oMin0 = XMMReg2Double::Min(oXY0, oMin0);
+        oMax0 = XMMReg2Double::Max(oXY0, oMax0);
+    }
+    oMin0 = XMMReg2Double::Min(oMin1, oMin0);
+    oMax0 = XMMReg2Double::Max(oMax1, oMax0);
+
+    double adfMin[2];
+    double adfMax[2];
+    oMin0.Store2Val(adfMin);
+    oMax0.Store2Val(adfMax);
+
+    psEnvelope->MinX = adfMin[0];
+    psEnvelope->MaxX = adfMax[0];
+    psEnvelope->MinY = adfMin[1];
+    psEnvelope->MaxY = adfMax[1];
+#else
     double dfMinX = paoPoints[0].x;
     double dfMaxX = paoPoints[0].x;
     double dfMinY = paoPoints[0].y;
@@ -2467,6 +2542,7 @@ void OGRSimpleCurve::getEnvelope(OGREnvelope *psEnvelope) const
     psEnvelope->MaxX = dfMaxX;
     psEnvelope->MinY = dfMinY;
     psEnvelope->MaxY = dfMaxY;
+#endif
 }
 
 /************************************************************************/
@@ -2487,8 +2563,34 @@ void OGRSimpleCurve::getEnvelope(OGREnvelope3D *psEnvelope) const
 
     double dfMinZ = padfZ[0];
     double dfMaxZ = padfZ[0];
+    int iPoint = 1;
 
-    for (int iPoint = 1; iPoint < nPointCount; iPoint++)
+#ifdef USE_SSE2
+    if (nPointCount >= 3)
+    {
+        const auto oInit = XMMReg2Double::Load1ValHighAndLow(padfZ);
+        auto oMin = oInit;
+        auto oMax = oInit;
+        for (; iPoint + 1 < nPointCount; iPoint += 2)
+        {
+            const auto oZ = XMMReg2Double::Load2Val(padfZ + iPoint);
+            oMin = XMMReg2Double::Min(oZ, oMin);
+            oMax = XMMReg2Double::Max(oZ, oMax);
+        }
+        double adfMin[2];
+        double adfMax[2];
+        oMin.Store2Val(adfMin);
+        oMax.Store2Val(adfMax);
+        dfMinZ = adfMin[0];
+        if (dfMinZ > adfMin[1])
+            dfMinZ = adfMin[1];
+        dfMaxZ = adfMax[0];
+        if (dfMaxZ < adfMax[1])
+            dfMaxZ = adfMax[1];
+    }
+#endif
+
+    for (; iPoint < nPointCount; iPoint++)
     {
         if (dfMinZ > padfZ[iPoint])
             dfMinZ = padfZ[iPoint];
@@ -2840,7 +2942,18 @@ bool OGRSimpleCurve::segmentize(double dfMaxLength)
 
 void OGRSimpleCurve::swapXY()
 {
-    for (int i = 0; i < nPointCount; i++)
+    int i = 0;
+#ifdef USE_SSE2
+    for (; i + 1 < nPointCount; i += 2)
+    {
+        const __m128d xmmXY0 = _mm_loadu_pd(&(paoPoints[i].x));
+        const __m128d xmmXY1 = _mm_loadu_pd(&(paoPoints[i + 1].x));
+        _mm_storeu_pd(&(paoPoints[i].x), _mm_shuffle_pd(xmmXY0, xmmXY0, 1));
+        _mm_storeu_pd(&(paoPoints[i + 1].x),
+                      _mm_shuffle_pd(xmmXY1, xmmXY1, 1));
+    }
+#endif
+    for (; i < nPointCount; i++)
     {
         std::swap(paoPoints[i].x, paoPoints[i].y);
     }
@@ -3023,7 +3136,37 @@ double OGRSimpleCurve::get_LinearArea() const
     double dfAreaSum =
         paoPoints[0].x * (paoPoints[1].y - paoPoints[nPointCount - 1].y);
 
-    for (int i = 1; i < nPointCount - 1; i++)
+    int i = 1;
+#ifdef USE_SSE2
+    // Process the terms of index i and i+1 at once, by deinterleaving
+    // (x[i], x[i+1]), (y[i-1], y[i]) and (y[i+1], y[i+2]) from the
+    // 4 points (i-1) to (i+2).
+    // As in get_Length(), the summation order differs from the scalar loop,
+    // which may change the last bits of the result.
+    if (nPointCount >= 4)
+    {
+        __m128d xmmSum = _mm_setzero_pd();
+        __m128d xmmPrev0 = _mm_loadu_pd(&(paoPoints[0].x));
+        __m128d xmmPrev1 = _mm_loadu_pd(&(paoPoints[1].x));
+        for (; i + 2 < nPointCount; i += 2)
+        {
+            const __m128d xmmNext0 = _mm_loadu_pd(&(paoPoints[i + 1].x));
+            const __m128d xmmNext1 = _mm_loadu_pd(&(paoPoints[i + 2].x));
+            const __m128d xmmX = _mm_unpacklo_pd(xmmPrev1, xmmNext0);
+            const __m128d xmmYBefore = _mm_unpackhi_pd(xmmPrev0, xmmPrev1);
+            const __m128d xmmYAfter = _mm_unpackhi_pd(xmmNext0, xmmNext1);
+            xmmSum = _mm_add_pd(
+                xmmSum, _mm_mul_pd(xmmX, _mm_sub_pd(xmmYAfter, xmmYBefore)));
+            xmmPrev0 = xmmNext0;
+            xmmPrev1 = xmmNext1;
+        }
+        double adfSum[2];
+        _mm_storeu_pd(adfSum, xmmSum);
+        dfAreaSum += adfSum[0] + adfSum[1];
+    }
+#endif
+
+    for (; i < nPointCount - 1; i++)
     {
         dfAreaSum += paoPoints[i].x * (paoPoints[i + 1].y - paoPoints[i - 1].y);
     }
@@ -0,0 +1,428 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implements OGRSpatialIndexedLayer class
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef DOXYGEN_SKIP
+
+#include "ogrspatialindexedlayer.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+/************************************************************************/
+/*                       OGRSpatialIndexedLayer()                       */
+/************************************************************************/
+
+OGRSpatialIndexedLayer::OGRSpatialIndexedLayer(OGRLayer *poDecoratedLayer,
+                                               bool bTakeOwnership)
+    : OGRLayerDecorator(poDecoratedLayer, bTakeOwnership)
+{
+    SetDescription(poDecoratedLayer->GetDescription());
+
+    // Make sure that the first sequential read starts from the beginning,
+    // so that it can be used to build the spatial index.
+    poDecoratedLayer->ResetReading();
+}
+
+/************************************************************************/
+/*                      ~OGRSpatialIndexedLayer()                       */
+/************************************************************************/
+
+OGRSpatialIndexedLayer::~OGRSpatialIndexedLayer()
+{
+    if (m_hQuadTree)
+        CPLQuadTreeDestroy(m_hQuadTree);
+}
+
+/************************************************************************/
+/*                       InvalidateSpatialIndex()                       */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::InvalidateSpatialIndex()
+{
+    if (m_eSpatialIndexState != SPI_INVALID)
+        m_eSpatialIndexState = SPI_NONE;
+    if (m_hQuadTree)
+    {
+        CPLQuadTreeDestroy(m_hQuadTree);
+        m_hQuadTree = nullptr;
+    }
+    m_anIndexedFIDs.clear();
+    m_asIndexedEnvelopes.clear();
+    m_bUseSpatialIndex = false;
+    m_anCandidates.clear();
+    m_iCurCandidate = 0;
+}
+
+/************************************************************************/
+/*                     StartSpatialIndexBuilding()                      */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::StartSpatialIndexBuilding()
+{
+    CPLAssert(m_eSpatialIndexState == SPI_NONE);
+
+    OGRFeatureDefn *poDefn = m_poDecoratedLayer->GetLayerDefn();
+    if (!m_poDecoratedLayer->TestCapability(OLCRandomRead) ||
+        poDefn->GetGeomFieldCount() == 0)
+    {
+        m_eSpatialIndexState = SPI_INVALID;
+        return;
+    }
+
+    // Build the index on the geometry field of the current spatial
+    // filter, or the first one if there is none.
+    m_iIndexedGeomField = m_poFilterGeom ? m_iGeomFieldFilter : 0;
+    if (!poDefn->GetGeomFieldDefn(m_iIndexedGeomField)->IsIgnored())
+    {
+        m_eSpatialIndexState = SPI_IN_BUILDING;
+    }
+}
+
+/************************************************************************/
+/*                         AddToSpatialIndex()                          */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::AddToSpatialIndex(const OGRFeature *poFeature)
+{
+    const GIntBig nFID = poFeature->GetFID();
+    if (nFID == OGRNullFID)
+    {
+        CPLDebug("OGR", "%s: feature without FID. Cannot build spatial index",
+                 GetDescription());
+        InvalidateSpatialIndex();
+        m_eSpatialIndexState = SPI_INVALID;
+        return;
+    }
+
+    const OGRGeometry *poGeom =
+        poFeature->GetGeomFieldRef(m_iIndexedGeomField);
+    if (poGeom == nullptr || poGeom->IsEmpty())
+        return;
+
+    OGREnvelope sEnvelope;
+    poGeom->getEnvelope(&sEnvelope);
+    try
+    {
+        m_anIndexedFIDs.push_back(nFID);
+        m_asIndexedEnvelopes.push_back(sEnvelope);
+    }
+    catch (const std::exception &)
+    {
+        CPLDebug("OGR", "%s: out of memory. Cannot build spatial index",
+                 GetDescription());
+        InvalidateSpatialIndex();
+        m_eSpatialIndexState = SPI_INVALID;
+    }
+}
+
+/************************************************************************/
+/*                        FinalizeSpatialIndex()                        */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::FinalizeSpatialIndex()
+{
+    CPLAssert(m_hQuadTree == nullptr);
+
+    m_eSpatialIndexState = SPI_COMPLETED;
+    if (m_asIndexedEnvelopes.empty())
+        return;
+
+    OGREnvelope sGlobalEnvelope;
+    for (const auto &sEnvelope : m_asIndexedEnvelopes)
+        sGlobalEnvelope.Merge(sEnvelope);
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = sGlobalEnvelope.MinX;
+    sGlobalBounds.miny = sGlobalEnvelope.MinY;
+    sGlobalBounds.maxx = sGlobalEnvelope.MaxX;
+    sGlobalBounds.maxy = sGlobalEnvelope.MaxY;
+    m_hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    const int nExpectedFeatures = static_cast<int>(std::min<size_t>(
+        m_asIndexedEnvelopes.size(), std::numeric_limits<int>::max()));
+    CPLQuadTreeSetMaxDepth(m_hQuadTree,
+                           CPLQuadTreeGetAdvisedMaxDepth(nExpectedFeatures));
+    for (size_t i = 0; i < m_asIndexedEnvelopes.size(); ++i)
+    {
+        const auto &sEnvelope = m_asIndexedEnvelopes[i];
+        CPLRectObj sRect;
+        sRect.minx = sEnvelope.MinX;
+        sRect.miny = sEnvelope.MinY;
+        sRect.maxx = sEnvelope.MaxX;
+        sRect.maxy = sEnvelope.MaxY;
+        // m_hQuadTree stores indices in m_anIndexedFIDs as void*
+        CPLQuadTreeInsertWithBounds(m_hQuadTree,
+                                    reinterpret_cast<void *>(i), &sRect);
+    }
+
+    CPLDebug("OGR", "%s: in-memory spatial index built with %u features",
+             GetDescription(),
+             static_cast<unsigned>(m_asIndexedEnvelopes.size()));
+
+    // Not needed anymore
+    m_asIndexedEnvelopes.clear();
+    m_asIndexedEnvelopes.shrink_to_fit();
+}
+
+/************************************************************************/
+/*                          EvaluateFilters()                           */
+/************************************************************************/
+
+bool OGRSpatialIndexedLayer::EvaluateFilters(OGRFeature *poFeature)
+{
+    return (m_poFilterGeom == nullptr ||
+            FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
+           (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature));
+}
+
+/************************************************************************/
+/*                          GetSpatialFilter()                          */
+/************************************************************************/
+
+OGRGeometry *OGRSpatialIndexedLayer::GetSpatialFilter()
+{
+    return m_poFilterGeom;
+}
+
+/************************************************************************/
+/*                         ISetSpatialFilter()                          */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::ISetSpatialFilter(int iGeomField,
+                                                 const OGRGeometry *poGeom)
+{
+    // Do not forward to the decorated layer: the filter is evaluated
+    // by GetNextFeature(), so that the decorated layer returns all features
+    // while the spatial index is built.
+    return OGRLayer::ISetSpatialFilter(iGeomField, poGeom);
+}
+
+/************************************************************************/
+/*                         SetAttributeFilter()                         */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::SetAttributeFilter(const char *pszFilter)
+{
+    return OGRLayer::SetAttributeFilter(pszFilter);
+}
+
+/************************************************************************/
+/*                            ResetReading()                            */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::ResetReading()
+{
+    m_poDecoratedLayer->ResetReading();
+
+    m_bSequentialReadStarted = false;
+    m_bUseSpatialIndex = false;
+    m_anCandidates.clear();
+    m_iCurCandidate = 0;
+
+    if (m_eSpatialIndexState == SPI_IN_BUILDING)
+    {
+        // Previous sequential read was interrupted
+        InvalidateSpatialIndex();
+    }
+
+    if (m_eSpatialIndexState == SPI_COMPLETED)
+    {
+        if (m_poFilterGeom != nullptr &&
+            m_iGeomFieldFilter == m_iIndexedGeomField)
+        {
+            m_bUseSpatialIndex = true;
+            if (m_hQuadTree)
+            {
+                CPLRectObj sAOI;
+                sAOI.minx = m_sFilterEnvelope.MinX;
+                sAOI.miny = m_sFilterEnvelope.MinY;
+                sAOI.maxx = m_sFilterEnvelope.MaxX;
+                sAOI.maxy = m_sFilterEnvelope.MaxY;
+                int nCount = 0;
+                void **pahResults =
+                    CPLQuadTreeSearch(m_hQuadTree, &sAOI, &nCount);
+                m_anCandidates.reserve(nCount);
+                for (int i = 0; i < nCount; ++i)
+                {
+                    m_anCandidates.push_back(
+                        reinterpret_cast<size_t>(pahResults[i]));
+                }
+                CPLFree(pahResults);
+                // Return features in the same order as a sequential read
+                std::sort(m_anCandidates.begin(), m_anCandidates.end());
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRSpatialIndexedLayer::GetNextFeature()
+{
+    if (m_bUseSpatialIndex)
+    {
+        while (m_iCurCandidate < m_anCandidates.size())
+        {
+            const GIntBig nFID =
+                m_anIndexedFIDs[m_anCandidates[m_iCurCandidate++]];
+            auto poFeature = std::unique_ptr<OGRFeature>(
+                m_poDecoratedLayer->GetFeature(nFID));
+            if (poFeature && EvaluateFilters(poFeature.get()))
+                return poFeature.release();
+        }
+        return nullptr;
+    }
+
+    if (!m_bSequentialReadStarted)
+    {
+        m_bSequentialReadStarted = true;
+        if (m_eSpatialIndexState == SPI_NONE)
+            StartSpatialIndexBuilding();
+    }
+
+    while (true)
+    {
+        auto poFeature =
+            std::unique_ptr<OGRFeature>(m_poDecoratedLayer->GetNextFeature());
+        if (!poFeature)
+        {
+            if (m_eSpatialIndexState == SPI_IN_BUILDING)
+                FinalizeSpatialIndex();
+            return nullptr;
+        }
+        if (m_eSpatialIndexState == SPI_IN_BUILDING)
+            AddToSpatialIndex(poFeature.get());
+        if (EvaluateFilters(poFeature.get()))
+            return poFeature.release();
+    }
+}
+
+/************************************************************************/
+/*                           SetNextByIndex()                           */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::SetNextByIndex(GIntBig nIndex)
+{
+    // Use the generic implementation based on GetNextFeature(), so that
+    // filters are honored and the spatial index can still be built.
+    return OGRLayer::SetNextByIndex(nIndex);
+}
+
+/************************************************************************/
+/*                             GetFeature()                             */
+/************************************************************************/
+
+OGRFeature *OGRSpatialIndexedLayer::GetFeature(GIntBig nFID)
+{
+    // Random reading might alter the position of the sequential reading
+    // of the decorated layer.
+    if (m_eSpatialIndexState == SPI_IN_BUILDING)
+        InvalidateSpatialIndex();
+    return OGRLayerDecorator::GetFeature(nFID);
+}
+
+/************************************************************************/
+/*                            ISetFeature()                             */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::ISetFeature(OGRFeature *poFeature)
+{
+    InvalidateSpatialIndex();
+    return OGRLayerDecorator::ISetFeature(poFeature);
+}
+
+/************************************************************************/
+/*                           ICreateFeature()                           */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::ICreateFeature(OGRFeature *poFeature)
+{
+    InvalidateSpatialIndex();
+    return OGRLayerDecorator::ICreateFeature(poFeature);
+}
+
+/************************************************************************/
+/*                           IUpsertFeature()                           */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::IUpsertFeature(OGRFeature *poFeature)
+{
+    InvalidateSpatialIndex();
+    return OGRLayerDecorator::IUpsertFeature(poFeature);
+}
+
+/************************************************************************/
+/*                           IUpdateFeature()                           */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::IUpdateFeature(
+    OGRFeature *poFeature, int nUpdatedFieldsCount,
+    const int *panUpdatedFieldsIdx, int nUpdatedGeomFieldsCount,
+    const int *panUpdatedGeomFieldsIdx, bool bUpdateStyleString)
+{
+    if (nUpdatedGeomFieldsCount > 0)
+        InvalidateSpatialIndex();
+    return OGRLayerDecorator::IUpdateFeature(
+        poFeature, nUpdatedFieldsCount, panUpdatedFieldsIdx,
+        nUpdatedGeomFieldsCount, panUpdatedGeomFieldsIdx, bUpdateStyleString);
+}
+
+/************************************************************************/
+/*                           DeleteFeature()                            */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::DeleteFeature(GIntBig nFID)
+{
+    InvalidateSpatialIndex();
+    return OGRLayerDecorator::DeleteFeature(nFID);
+}
+
+/************************************************************************/
+/*                          GetFeatureCount()                           */
+/************************************************************************/
+
+GIntBig OGRSpatialIndexedLayer::GetFeatureCount(int bForce)
+{
+    if (m_poFilterGeom == nullptr && m_poAttrQuery == nullptr)
+        return m_poDecoratedLayer->GetFeatureCount(bForce);
+    return OGRLayer::GetFeatureCount(bForce);
+}
+
+/************************************************************************/
+/*                           GetArrowStream()                           */
+/************************************************************************/
+
+bool OGRSpatialIndexedLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
+                                            CSLConstList papszOptions)
+{
+    // Go through GetNextFeature() so that filters are honored
+    return OGRLayer::GetArrowStream(out_stream, papszOptions);
+}
+
+/************************************************************************/
+/*                           TestCapability()                           */
+/************************************************************************/
+
+int OGRSpatialIndexedLayer::TestCapability(const char *pszCapability)
+{
+    if (EQUAL(pszCapability, OLCFastSpatialFilter))
+        return m_eSpatialIndexState == SPI_COMPLETED;
+    if (EQUAL(pszCapability, OLCFastFeatureCount))
+        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr &&
+               m_poDecoratedLayer->TestCapability(pszCapability);
+    if (EQUAL(pszCapability, OLCFastSetNextByIndex))
+        return FALSE;
+    return OGRLayerDecorator::TestCapability(pszCapability);
+}
+
+#endif /* #ifndef DOXYGEN_SKIP */
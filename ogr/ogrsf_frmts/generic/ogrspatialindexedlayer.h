@@ -0,0 +1,110 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Defines OGRSpatialIndexedLayer class
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGRSPATIALINDEXEDLAYER_H_INCLUDED
+#define OGRSPATIALINDEXEDLAYER_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "ogrlayerdecorator.h"
+#include "cpl_quad_tree.h"
+
+#include <vector>
+
+/************************************************************************/
+/*                        OGRSpatialIndexedLayer                        */
+/************************************************************************/
+
+/** Layer decorator that builds an in-memory spatial index of the feature
+ * envelopes of the decorated layer during its first complete sequential
+ * read, and uses it for subsequent reads with a spatial filter, by fetching
+ * only the candidate features with GetFeature().
+ *
+ * This is only useful for layers that have no native spatial index, but
+ * support random reading by FID, and whose FIDs are unique and stable.
+ * Spatial and attribute filters are evaluated by the decorator, and are
+ * not forwarded to the decorated layer.
+ */
+class CPL_DLL OGRSpatialIndexedLayer final : public OGRLayerDecorator
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRSpatialIndexedLayer)
+
+    typedef enum
+    {
+        SPI_NONE,
+        SPI_IN_BUILDING,
+        SPI_COMPLETED,
+        SPI_INVALID,
+    } SPIState;
+
+    SPIState m_eSpatialIndexState = SPI_NONE;
+
+    //! Geometry field on which the spatial index is built
+    int m_iIndexedGeomField = 0;
+
+    //! FID of each indexed feature. The quad tree stores indices in it.
+    std::vector<GIntBig> m_anIndexedFIDs{};
+
+    //! Envelopes of m_anIndexedFIDs. Only used while building the index.
+    std::vector<OGREnvelope> m_asIndexedEnvelopes{};
+
+    CPLQuadTree *m_hQuadTree = nullptr;
+
+    //! Whether GetNextFeature() has been called since the last ResetReading()
+    bool m_bSequentialReadStarted = false;
+
+    //! Whether the current read is driven by the spatial index
+    bool m_bUseSpatialIndex = false;
+
+    //! Indices in m_anIndexedFIDs of the features to read, when
+    //! m_bUseSpatialIndex is set.
+    std::vector<size_t> m_anCandidates{};
+    size_t m_iCurCandidate = 0;
+
+    void InvalidateSpatialIndex();
+    void StartSpatialIndexBuilding();
+    void AddToSpatialIndex(const OGRFeature *poFeature);
+    void FinalizeSpatialIndex();
+    bool EvaluateFilters(OGRFeature *poFeature);
+
+  public:
+    OGRSpatialIndexedLayer(OGRLayer *poDecoratedLayer, bool bTakeOwnership);
+    ~OGRSpatialIndexedLayer() override;
+
+    OGRGeometry *GetSpatialFilter() override;
+    OGRErr ISetSpatialFilter(int iGeomField, const OGRGeometry *) override;
+    OGRErr SetAttributeFilter(const char *) override;
+
+    void ResetReading() override;
+    OGRFeature *GetNextFeature() override;
+    OGRErr SetNextByIndex(GIntBig nIndex) override;
+    OGRFeature *GetFeature(GIntBig nFID) override;
+
+    OGRErr ISetFeature(OGRFeature *poFeature) override;
+    OGRErr ICreateFeature(OGRFeature *poFeature) override;
+    OGRErr IUpsertFeature(OGRFeature *poFeature) override;
+    OGRErr DeleteFeature(GIntBig nFID) override;
+    OGRErr IUpdateFeature(OGRFeature *poFeature, int nUpdatedFieldsCount,
+                          const int *panUpdatedFieldsIdx,
+                          int nUpdatedGeomFieldsCount,
+                          const int *panUpdatedGeomFieldsIdx,
+                          bool bUpdateStyleString) override;
+
+    GIntBig GetFeatureCount(int bForce = TRUE) override;
+    bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                        CSLConstList papszOptions = nullptr) override;
+
+    int TestCapability(const char *) override;
+};
+
+#endif /* #ifndef DOXYGEN_SKIP */
+
+#endif  // OGRSPATIALINDEXEDLAYER_H_INCLUDED
@@ -19,6 +19,7 @@
 #include "memdataset.h"
 
 #include <cstdio>
+#include <memory>
 #include <vector>  // Used by OGRGeoJSONLayer.
 #include "ogrgeojsonutils.h"
 #include "ogrgeojsonwriter.h"
@@ -352,6 +353,10 @@ class OGRGeoJSONDataSource final : public GDALDataset
     bool m_bSupportsMGeometries = false;
     bool m_bSupportsZGeometries = true;
 
+    //! Whether to expose layers through OGRSpatialIndexedLayer
+    bool m_bInMemorySpatialIndex = false;
+    std::vector<std::unique_ptr<OGRLayer>> m_apoSpatialIndexedLayers{};
+
     //
     // Private utility functions
     //
@@ -41,6 +41,7 @@
 #include "ogrgeojsonwriter.h"
 #include "ogrsf_frmts.h"
 #include "ogr_schema_override.h"
+#include "ogrspatialindexedlayer.h"
 
 // #include "symbol_renames.h"
 
@@ -296,6 +297,11 @@ int OGRGeoJSONDataSource::Open(GDALOpenInfo *poOpenInfo,
     SetDescription(poOpenInfo->pszFilename);
     LoadLayers(poOpenInfo, nSrcType, pszUnprefixed, pszJSonFlavor);
 
+    m_bInMemorySpatialIndex =
+        !bUpdatable_ &&
+        CPLTestBool(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                         "IN_MEMORY_SPATIAL_INDEX", "NO"));
+
     if (!DealWithOgrSchemaOpenOption(poOpenInfo))
     {
         Clear();
@@ -348,7 +354,21 @@ OGRLayer *OGRGeoJSONDataSource::GetLayer(int nLayer)
     if (0 <= nLayer && nLayer < nLayers_)
     {
         if (papoLayers_)
+        {
+            if (m_bInMemorySpatialIndex)
+            {
+                if (m_apoSpatialIndexedLayers.empty())
+                    m_apoSpatialIndexedLayers.resize(nLayers_);
+                auto &poLayer = m_apoSpatialIndexedLayers[nLayer];
+                if (!poLayer)
+                {
+                    poLayer = std::make_unique<OGRSpatialIndexedLayer>(
+                        papoLayers_[nLayer], /* bTakeOwnership = */ false);
+                }
+                return poLayer.get();
+            }
             return papoLayers_[nLayer];
+        }
         else
             return papoLayersWriter_[nLayer];
     }
@@ -828,6 +848,8 @@ void OGRGeoJSONDataSource::SetAttributesTranslation(AttributesTranslation type)
 
 bool OGRGeoJSONDataSource::Clear()
 {
+    m_apoSpatialIndexedLayers.clear();
+
     for (int i = 0; i < nLayers_; i++)
     {
         if (papoLayers_ != nullptr)
@@ -721,6 +721,10 @@ void RegisterOGRGeoJSON()
         "creating the layer. "
         "The overrides are defined as a JSON list of field definitions. "
         "This can be a filename or a JSON string or a URL.'/>"
+        "  <Option name='IN_MEMORY_SPATIAL_INDEX' type='boolean' "
+        "description='Whether to build an in-memory spatial index of feature "
+        "envelopes during the first full read of a layer, to speed up "
+        "subsequent reads with a spatial filter' default='NO'/>"
         "</OpenOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST,
@@ -19,6 +19,7 @@
 #include "ogrjsoncollectionstreamingparser.h"
 #include "ogr_api.h"
 
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <set>
@@ -237,6 +238,9 @@ OGRGeoJSONReaderStreamingParser::OGRGeoJSONReaderStreamingParser(
           OGRGeoJSONReaderStreamingParserGetMaxObjectSize()),
       m_oReader(oReader), m_poLayer(poLayer)
 {
+    // Undocumented: for testing purposes only
+    SetDirectGeometry(CPLTestBool(
+        CPLGetConfigOption("OGR_GEOJSON_DIRECT_GEOMETRY_DECODING", "YES")));
 }
 
 /************************************************************************/
@@ -278,15 +282,18 @@ void OGRGeoJSONReaderStreamingParser::GotFeature(json_object *poObj,
     if (bFirstPass)
     {
         if (!m_oReader.GenerateFeatureDefn(m_oMapFieldNameToIdx, m_apoFieldDefn,
-                                           m_dag, m_poLayer, poObj))
+                                           m_dag, m_poLayer, poObj,
+                                           GetDirectGeometry()))
         {
         }
         m_poLayer->IncFeatureCount();
     }
     else
     {
-        OGRFeature *poFeat =
-            m_oReader.ReadFeature(m_poLayer, poObj, osJson.c_str());
+        auto psDirectGeom = GetDirectGeometry();
+        OGRFeature *poFeat = m_oReader.ReadFeature(
+            m_poLayer, poObj, osJson.c_str(),
+            psDirectGeom ? std::move(psDirectGeom->poGeom) : nullptr);
         if (poFeat)
         {
             GIntBig nFID = poFeat->GetFID();
@@ -1610,7 +1617,7 @@ bool OGRGeoJSONBaseReader::GenerateFeatureDefn(
     std::map<std::string, int> &oMapFieldNameToIdx,
     std::vector<std::unique_ptr<OGRFieldDefn>> &apoFieldDefn,
     gdal::DirectedAcyclicGraph<int, std::string> &dag, OGRLayer *poLayer,
-    json_object *poObj)
+    json_object *poObj, const OGRJSONDirectGeometry *psDirectGeom)
 {
     /* -------------------------------------------------------------------- */
     /*      Read collection of properties.                                  */
@@ -1631,12 +1638,19 @@ bool OGRGeoJSONBaseReader::GenerateFeatureDefn(
     json_object *poGeomObj = CPL_json_object_object_get(poObj, "geometry");
     if (poGeomObj && json_object_get_type(poGeomObj) == json_type_object)
     {
-        const auto eType = OGRGeoJSONGetOGRGeometryType(poGeomObj);
+        const auto eType = psDirectGeom
+                               ? psDirectGeom->eType
+                               : OGRGeoJSONGetOGRGeometryType(poGeomObj);
 
         OGRGeoJSONUpdateLayerGeomType(m_bFirstGeometry, eType,
                                       m_eLayerGeomType);
 
-        if (eType != wkbNone && eType != wkbUnknown)
+        if (psDirectGeom)
+        {
+            m_oEnvelope3D.Merge(psDirectGeom->sExtent);
+            m_bExtentRead = true;
+        }
+        else if (eType != wkbNone && eType != wkbUnknown)
         {
             // This is maybe too optimistic: it assumes that the geometry
             // coordinates array is in the correct format
@@ -1947,8 +1961,31 @@ bool OGRGeoJSONReader::AddFeature(OGRGeoJSONLayer *poLayer,
 OGRGeometry *OGRGeoJSONBaseReader::ReadGeometry(json_object *poObj,
                                                 OGRSpatialReference *poLayerSRS)
 {
-    OGRGeometry *poGeometry = OGRGeoJSONReadGeometry(poObj, poLayerSRS);
+    return WrapGeometry(OGRGeoJSONReadGeometry(poObj, poLayerSRS));
+}
+
+/************************************************************************/
+/*                           ReadGeometry                               */
+/************************************************************************/
+
+/** Variant of ReadGeometry() for a geometry decoded directly by the streaming
+ * parser, from a geometry object without "crs" member. */
+OGRGeometry *
+OGRGeoJSONBaseReader::ReadGeometry(std::unique_ptr<OGRGeometry> poGeometry,
+                                   OGRSpatialReference *poLayerSRS)
+{
+    // Same logic as OGRGeoJSONReadGeometry()
+    poGeometry->assignSpatialReference(
+        poLayerSRS ? poLayerSRS : OGRSpatialReference::GetWGS84SRS());
+    return WrapGeometry(poGeometry.release());
+}
 
+/************************************************************************/
+/*                           WrapGeometry                               */
+/************************************************************************/
+
+OGRGeometry *OGRGeoJSONBaseReader::WrapGeometry(OGRGeometry *poGeometry)
+{
     /* -------------------------------------------------------------------- */
     /*      Wrap geometry with GeometryCollection as a common denominator.  */
     /*      Sometimes a GeoJSON text may consist of objects of different    */
@@ -2154,9 +2191,10 @@ void OGRGeoJSONReaderSetField(OGRLayer *poLayer, OGRFeature *poFeature,
 /*                           ReadFeature()                              */
 /************************************************************************/
 
-OGRFeature *OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer,
-                                              json_object *poObj,
-                                              const char *pszSerializedObj)
+OGRFeature *
+OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer, json_object *poObj,
+                                  const char *pszSerializedObj,
+                                  std::unique_ptr<OGRGeometry> poDirectGeom)
 {
     CPLAssert(nullptr != poObj);
 
@@ -2372,8 +2410,10 @@ OGRFeature *OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer,
         // NOTE: If geometry can not be parsed or read correctly
         //       then NULL geometry is assigned to a feature and
         //       geometry type for layer is classified as wkbUnknown.
+        OGRSpatialReference *poLayerSRS = poLayer->GetSpatialRef();
         OGRGeometry *poGeometry =
-            ReadGeometry(poObjGeom, poLayer->GetSpatialRef());
+            poDirectGeom ? ReadGeometry(std::move(poDirectGeom), poLayerSRS)
+                         : ReadGeometry(poObjGeom, poLayerSRS);
         if (nullptr != poGeometry)
         {
             poFeature->SetGeometryDirectly(poGeometry);
@@ -2381,10 +2421,10 @@ OGRFeature *OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer,
     }
     else
     {
-        static bool bWarned = false;
-        if (!bWarned)
+        // ReadFeature() may run concurrently on GeoJSONSeq worker threads
+        static std::atomic<bool> bWarned{false};
+        if (!bWarned.exchange(true))
         {
-            bWarned = true;
             CPLDebug(
                 "GeoJSON",
                 "Non conformant Feature object. Missing \'geometry\' member.");
@@ -21,6 +21,7 @@
 #include "ogrgeojsonutils.h"
 #include "directedacyclicgraph.hpp"
 
+#include <memory>
 #include <utility>
 #include <map>
 #include <set>
@@ -43,6 +44,7 @@ class OGRGeometryCollection;
 class OGRFeature;
 class OGRGeoJSONLayer;
 class OGRSpatialReference;
+struct OGRJSONDirectGeometry;
 
 /************************************************************************/
 /*                        OGRGeoJSONBaseReader                          */
@@ -78,13 +80,18 @@ class OGRGeoJSONBaseReader
         std::map<std::string, int> &oMapFieldNameToIdx,
         std::vector<std::unique_ptr<OGRFieldDefn>> &apoFieldDefn,
         gdal::DirectedAcyclicGraph<int, std::string> &dag, OGRLayer *poLayer,
-        json_object *poObj);
+        json_object *poObj,
+        const OGRJSONDirectGeometry *psDirectGeom = nullptr);
     void FinalizeLayerDefn(OGRLayer *poLayer, CPLString &osFIDColumn);
 
     OGRGeometry *ReadGeometry(json_object *poObj,
                               OGRSpatialReference *poLayerSRS);
-    OGRFeature *ReadFeature(OGRLayer *poLayer, json_object *poObj,
-                            const char *pszSerializedObj);
+    OGRGeometry *ReadGeometry(std::unique_ptr<OGRGeometry> poGeometry,
+                              OGRSpatialReference *poLayerSRS);
+    OGRFeature *
+    ReadFeature(OGRLayer *poLayer, json_object *poObj,
+                const char *pszSerializedObj,
+                std::unique_ptr<OGRGeometry> poDirectGeom = nullptr);
 
     bool ExtentRead() const;
 
@@ -104,6 +111,8 @@ class OGRGeoJSONBaseReader
   private:
     std::set<int> aoSetUndeterminedTypeFields_;
 
+    OGRGeometry *WrapGeometry(OGRGeometry *poGeometry);
+
     // bFlatten... is a tri-state boolean with -1 being unset.
     int bFlattenGeocouchSpatiallistFormat = -1;
 
@@ -20,12 +20,138 @@
 #include "ogrgeojsonreader.h"
 #include "ogrgeojsonwriter.h"
 #include "ogrgeojsongeometry.h"
+#include "ogrjsoncollectionstreamingparser.h"
+
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <memory>
+#include <utility>
+#include <vector>
 
 constexpr char RS = '\x1e';
 
+/************************************************************************/
+/*                       OGRGeoJSONSeqRecordParser                      */
+/************************************************************************/
+
+/** Parser of a single GeoJSONSeq record, which decodes the geometry of
+ * Feature objects without building json_object instances for its
+ * coordinates.
+ */
+class OGRGeoJSONSeqRecordParser final : public OGRJSONCollectionStreamingParser
+{
+    json_object *m_poFeatureObj = nullptr;
+    bool m_bInvalid = false;
+    bool m_bHasDirectGeometry = false;
+    OGRJSONDirectGeometry m_oDirectGeometry{};
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONSeqRecordParser)
+
+  protected:
+    void GotFeature(json_object *poObj, bool /* bFirstPass */,
+                    const std::string & /* osJson */) override
+    {
+        if (m_poFeatureObj)
+        {
+            m_bInvalid = true;
+            return;
+        }
+        m_poFeatureObj = json_object_get(poObj);
+        if (auto psDirectGeom = GetDirectGeometry())
+        {
+            m_bHasDirectGeometry = true;
+            m_oDirectGeometry.eType = psDirectGeom->eType;
+            m_oDirectGeometry.sExtent = psDirectGeom->sExtent;
+            m_oDirectGeometry.poGeom = std::move(psDirectGeom->poGeom);
+        }
+    }
+
+    // The size of records is checked by the layer
+    void TooComplex() override
+    {
+    }
+
+    // Errors are reported when parsing again the record with OGRJSonParse()
+    void Exception(const char * /* pszMessage */) override
+    {
+    }
+
+  public:
+    explicit OGRGeoJSONSeqRecordParser(bool bFirstPass)
+        : OGRJSONCollectionStreamingParser(bFirstPass,
+                                           /* bStoreNativeData = */ false,
+                                           /* nMaxObjectSize = */ 0)
+    {
+        SetDirectGeometry(true);
+    }
+
+    ~OGRGeoJSONSeqRecordParser() override
+    {
+        if (m_poFeatureObj)
+            json_object_put(m_poFeatureObj);
+    }
+
+    /** Parse a record, and return the Feature object it contains (possibly
+     * without its geometry coordinates, see GetRecordDirectGeometry()), or
+     * nullptr if it is not a valid Feature object.
+     */
+    json_object *ParseRecord(const std::string &osRecord)
+    {
+        if (m_poFeatureObj)
+            json_object_put(m_poFeatureObj);
+        m_poFeatureObj = nullptr;
+        m_bInvalid = false;
+        m_bHasDirectGeometry = false;
+        m_oDirectGeometry.poGeom.reset();
+
+        StartSingleFeature();
+        if (!Parse(osRecord.data(), osRecord.size(), true) || m_bInvalid)
+        {
+            if (m_poFeatureObj)
+                json_object_put(m_poFeatureObj);
+            m_poFeatureObj = nullptr;
+            m_bHasDirectGeometry = false;
+            m_oDirectGeometry.poGeom.reset();
+        }
+        return std::exchange(m_poFeatureObj, nullptr);
+    }
+
+    /** Return the geometry decoded for the last record, or nullptr. */
+    OGRJSONDirectGeometry *GetRecordDirectGeometry()
+    {
+        return m_bHasDirectGeometry ? &m_oDirectGeometry : nullptr;
+    }
+};
+
+/************************************************************************/
+/*                          OGRGeoJSONSeqRecord                         */
+/************************************************************************/
+
+/** Record of a batch processed by a worker thread in multi-threaded reading.
+ */
+struct OGRGeoJSONSeqRecord
+{
+    //! Text of the record, freed once it has been processed.
+    std::string osText{};
+
+    //! Errors emitted while processing the record, replayed when it is
+    //! returned.
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+
+    //! Parsed object. Only set in the first pass.
+    JsonObjectUniquePtr poObj{};
+
+    //! Directly decoded geometry of poObj. Only set in the first pass.
+    std::unique_ptr<OGRJSONDirectGeometry> poDirectGeometry{};
+
+    //! Translated feature, or nullptr if the record must be skipped. Only
+    //! set in the second pass.
+    std::unique_ptr<OGRFeature> poFeature{};
+};
+
 /************************************************************************/
 /*                        OGRGeoJSONSeqDataSource                       */
 /************************************************************************/
@@ -90,7 +216,29 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     OGRGeometryFactory::TransformWithOptionsCache m_oTransformCache;
     OGRGeoJSONWriteOptions m_oWriteOptions;
 
+    bool m_bDirectGeometry = false;
+    std::unique_ptr<OGRGeoJSONSeqRecordParser> m_poRecordParser{};
+
+    // Multi-threaded reading
+    int m_nNumThreads = 1;
+    bool m_bParallelFirstPass = false;
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::vector<OGRGeoJSONSeqRecord> m_aoCurBatch{};
+    std::vector<OGRGeoJSONSeqRecord> m_aoNextBatch{};
+    size_t m_iCurRecord = 0;
+    bool m_bNextBatchSubmitted = false;
+
+    bool GetNextRecord();
     json_object *GetNextObject(bool bLooseIdentification);
+    OGRJSONDirectGeometry *GetDirectGeometry();
+    OGRFeature *TranslateObject(json_object *poObject,
+                                OGRJSONDirectGeometry *psDirectGeom);
+
+    bool SubmitNextBatch();
+    void ProcessRecords(OGRGeoJSONSeqRecord *pasRecords, size_t nRecords,
+                        bool bFirstPass);
+    OGRGeoJSONSeqRecord *GetNextProcessedRecord();
+    void StopProcessing();
 
   public:
     OGRGeoJSONSeqLayer(OGRGeoJSONSeqDataSource *poDS, const char *pszName);
@@ -369,6 +517,7 @@ OGRGeoJSONSeqLayer::OGRGeoJSONSeqLayer(
 
 OGRGeoJSONSeqLayer::~OGRGeoJSONSeqLayer()
 {
+    StopProcessing();
     m_poFeatureDefn->Release();
 }
 
@@ -407,6 +556,38 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
 
     ResetReading();
 
+    // Undocumented: for testing purposes only
+    m_bDirectGeometry = CPLTestBool(
+        CPLGetConfigOption("OGR_GEOJSON_DIRECT_GEOMETRY_DECODING", "YES"));
+    if (m_bDirectGeometry)
+    {
+        m_poRecordParser = std::make_unique<OGRGeoJSONSeqRecordParser>(
+            /* bFirstPass = */ true);
+    }
+
+    // Records are parsed and translated by worker threads, which access the
+    // layer definition, so this is restricted to read-only datasets.
+    if (bEstablishLayerDefn && !bLooseIdentification &&
+        m_poDS->GetAccess() == GA_ReadOnly)
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("OGR_GEOJSONSEQ_NUM_THREADS", nullptr);
+        m_nNumThreads =
+            pszNumThreads == nullptr ? std::min(4, CPLGetNumCPUs())
+            : EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                               : atoi(pszNumThreads);
+        m_nNumThreads = std::min(m_nNumThreads, 128);
+        if (m_nNumThreads > 1)
+        {
+            auto poThreadPool = GDALGetGlobalThreadPool(m_nNumThreads);
+            if (poThreadPool)
+                m_poJobQueue = poThreadPool->CreateJobQueue();
+            else
+                m_nNumThreads = 1;
+        }
+    }
+    m_bParallelFirstPass = true;
+
     std::map<std::string, int> oMapFieldNameToIdx;
     std::vector<std::unique_ptr<OGRFieldDefn>> apoFieldDefn;
     gdal::DirectedAcyclicGraph<int, std::string> dag;
@@ -414,14 +595,30 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
 
     while (true)
     {
-        auto poObject = GetNextObject(bLooseIdentification);
-        if (!poObject)
-            break;
+        json_object *poObject = nullptr;
+        OGRJSONDirectGeometry *psDirectGeom = nullptr;
+        if (m_poJobQueue)
+        {
+            auto psRecord = GetNextProcessedRecord();
+            if (!psRecord)
+                break;
+            if (!psRecord->poObj)
+                continue;
+            poObject = psRecord->poObj.release();
+            psDirectGeom = psRecord->poDirectGeometry.get();
+        }
+        else
+        {
+            poObject = GetNextObject(bLooseIdentification);
+            if (!poObject)
+                break;
+            psDirectGeom = GetDirectGeometry();
+        }
         const auto eObjectType = OGRGeoJSONGetType(poObject);
         if (bEstablishLayerDefn && eObjectType == GeoJSONObject::eFeature)
         {
             m_oReader.GenerateFeatureDefn(oMapFieldNameToIdx, apoFieldDefn, dag,
-                                          this, poObject);
+                                          this, poObject, psDirectGeom);
         }
         json_object_put(poObject);
         if (!bEstablishLayerDefn)
@@ -446,7 +643,14 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
         m_oReader.FinalizeLayerDefn(this, m_osFIDColumn);
     }
 
+    if (m_bDirectGeometry)
+    {
+        m_poRecordParser = std::make_unique<OGRGeoJSONSeqRecordParser>(
+            /* bFirstPass = */ false);
+    }
+
     ResetReading();
+    m_bParallelFirstPass = false;
 
     m_nFileSize = 0;
     m_nIter = 0;
@@ -466,6 +670,8 @@ void OGRGeoJSONSeqLayer::ResetReading()
         return;
     }
 
+    StopProcessing();
+
     m_poDS->m_bAtEOF = false;
     VSIFSeekL(m_poDS->m_fp, 0, SEEK_SET);
     // Undocumented: for testing purposes only
@@ -483,10 +689,12 @@ void OGRGeoJSONSeqLayer::ResetReading()
 }
 
 /************************************************************************/
-/*                           GetNextObject()                            */
+/*                           GetNextRecord()                            */
 /************************************************************************/
 
-json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
+/** Read the next non-empty record in m_osFeatureBuffer. Returns false at end
+ * of file or on error. */
+bool OGRGeoJSONSeqLayer::GetNextRecord()
 {
     m_osFeatureBuffer.clear();
     while (true)
@@ -496,7 +704,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
         {
             if (m_nBufferValidSize < m_osBuffer.size())
             {
-                return nullptr;
+                return false;
             }
             m_nBufferValidSize =
                 VSIFReadL(&m_osBuffer[0], 1, m_osBuffer.size(), m_poDS->m_fp);
@@ -520,7 +728,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
             }
             if (m_nPosInBuffer >= m_nBufferValidSize)
             {
-                return nullptr;
+                return false;
             }
         }
 
@@ -548,7 +756,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
                          "for larger features, or 0 to remove any size limit.",
                          static_cast<unsigned>(m_osFeatureBuffer.size() / 1024 /
                                                1024));
-                return nullptr;
+                return false;
             }
             m_nPosInBuffer = m_nBufferValidSize;
             if (m_nBufferValidSize == m_osBuffer.size())
@@ -565,21 +773,246 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
         }
         if (!m_osFeatureBuffer.empty())
         {
-            json_object *poObject = nullptr;
-            CPL_IGNORE_RET_VAL(
-                OGRJSonParse(m_osFeatureBuffer.c_str(), &poObject));
-            m_osFeatureBuffer.clear();
-            if (json_object_get_type(poObject) == json_type_object)
+            return true;
+        }
+    }
+}
+
+/************************************************************************/
+/*                      OGRGeoJSONSeqParseRecord()                      */
+/************************************************************************/
+
+static json_object *
+OGRGeoJSONSeqParseRecord(OGRGeoJSONSeqRecordParser *poRecordParser,
+                         const std::string &osRecord)
+{
+    json_object *poObject =
+        poRecordParser ? poRecordParser->ParseRecord(osRecord) : nullptr;
+    if (!poObject)
+    {
+        CPL_IGNORE_RET_VAL(OGRJSonParse(osRecord.c_str(), &poObject));
+    }
+    return poObject;
+}
+
+/************************************************************************/
+/*                           GetNextObject()                            */
+/************************************************************************/
+
+json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
+{
+    while (GetNextRecord())
+    {
+        json_object *poObject =
+            OGRGeoJSONSeqParseRecord(m_poRecordParser.get(), m_osFeatureBuffer);
+        m_osFeatureBuffer.clear();
+        if (json_object_get_type(poObject) == json_type_object)
+        {
+            return poObject;
+        }
+        json_object_put(poObject);
+        if (bLooseIdentification)
+        {
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                         GetDirectGeometry()                          */
+/************************************************************************/
+
+/** Return the geometry of the object returned by the last GetNextObject()
+ * call, when it has been decoded without building json_object instances for
+ * its coordinates, or nullptr. */
+OGRJSONDirectGeometry *OGRGeoJSONSeqLayer::GetDirectGeometry()
+{
+    return m_poRecordParser ? m_poRecordParser->GetRecordDirectGeometry()
+                            : nullptr;
+}
+
+/************************************************************************/
+/*                          TranslateObject()                           */
+/************************************************************************/
+
+/** Translate a parsed object, whose ownership is taken, into a feature.
+ * Returns nullptr if the object must be skipped.
+ *
+ * This may be called concurrently from several worker threads, once the
+ * layer definition has been established.
+ */
+OGRFeature *
+OGRGeoJSONSeqLayer::TranslateObject(json_object *poObject,
+                                    OGRJSONDirectGeometry *psDirectGeom)
+{
+    OGRFeature *poFeature = nullptr;
+    auto type = OGRGeoJSONGetType(poObject);
+    if (type == GeoJSONObject::eFeature)
+    {
+        poFeature = m_oReader.ReadFeature(
+            this, poObject, "",
+            psDirectGeom ? std::move(psDirectGeom->poGeom) : nullptr);
+    }
+    else if (type != GeoJSONObject::eFeatureCollection &&
+             type != GeoJSONObject::eUnknown)
+    {
+        OGRGeometry *poGeom = m_oReader.ReadGeometry(poObject, GetSpatialRef());
+        if (poGeom)
+        {
+            poFeature = new OGRFeature(m_poFeatureDefn);
+            poFeature->SetGeometryDirectly(poGeom);
+        }
+    }
+    json_object_put(poObject);
+    return poFeature;
+}
+
+/************************************************************************/
+/*                           ProcessRecords()                           */
+/************************************************************************/
+
+/** Parse, and in the second pass translate, records. Run by worker
+ * threads. */
+void OGRGeoJSONSeqLayer::ProcessRecords(OGRGeoJSONSeqRecord *pasRecords,
+                                        size_t nRecords, bool bFirstPass)
+{
+    std::unique_ptr<OGRGeoJSONSeqRecordParser> poRecordParser;
+    if (m_bDirectGeometry)
+        poRecordParser =
+            std::make_unique<OGRGeoJSONSeqRecordParser>(bFirstPass);
+
+    for (size_t i = 0; i < nRecords; ++i)
+    {
+        auto &sRecord = pasRecords[i];
+        CPLErrorAccumulator oErrorAccumulator;
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            json_object *poObject =
+                OGRGeoJSONSeqParseRecord(poRecordParser.get(), sRecord.osText);
+            if (json_object_get_type(poObject) != json_type_object)
             {
-                return poObject;
+                json_object_put(poObject);
             }
-            json_object_put(poObject);
-            if (bLooseIdentification)
+            else
             {
-                return nullptr;
+                OGRJSONDirectGeometry *psDirectGeom =
+                    poRecordParser ? poRecordParser->GetRecordDirectGeometry()
+                                   : nullptr;
+                if (bFirstPass)
+                {
+                    sRecord.poObj.reset(poObject);
+                    if (psDirectGeom)
+                    {
+                        sRecord.poDirectGeometry =
+                            std::make_unique<OGRJSONDirectGeometry>(
+                                std::move(*psDirectGeom));
+                    }
+                }
+                else
+                {
+                    sRecord.poFeature.reset(
+                        TranslateObject(poObject, psDirectGeom));
+                }
             }
         }
+        sRecord.aoErrors = oErrorAccumulator.GetErrors();
+        std::string().swap(sRecord.osText);
+    }
+}
+
+/************************************************************************/
+/*                          SubmitNextBatch()                           */
+/************************************************************************/
+
+/** Read the next batch of records, and submit it to worker threads.
+ * Returns false if there is no record left. */
+bool OGRGeoJSONSeqLayer::SubmitNextBatch()
+{
+    // Limits of the size of a batch, per thread
+    constexpr size_t MAX_RECORDS_PER_THREAD = 1000;
+    constexpr size_t MAX_BYTES_PER_THREAD = 1024 * 1024;
+
+    const size_t nMaxRecords = MAX_RECORDS_PER_THREAD * m_nNumThreads;
+    const size_t nMaxBytes = MAX_BYTES_PER_THREAD * m_nNumThreads;
+    size_t nBytes = 0;
+    m_aoNextBatch.clear();
+    while (m_aoNextBatch.size() < nMaxRecords && nBytes < nMaxBytes &&
+           GetNextRecord())
+    {
+        nBytes += m_osFeatureBuffer.size();
+        m_aoNextBatch.emplace_back();
+        m_aoNextBatch.back().osText.swap(m_osFeatureBuffer);
+        m_osFeatureBuffer.clear();
+    }
+    if (m_aoNextBatch.empty())
+        return false;
+
+    // Split the batch in one job per thread. Pointers to records remain
+    // valid when m_aoNextBatch is swapped with m_aoCurBatch.
+    const size_t nRecords = m_aoNextBatch.size();
+    const size_t nJobs =
+        std::min(static_cast<size_t>(m_nNumThreads), nRecords);
+    const bool bFirstPass = m_bParallelFirstPass;
+    for (size_t iJob = 0; iJob < nJobs; ++iJob)
+    {
+        const size_t iStart = iJob * nRecords / nJobs;
+        const size_t iEnd = (iJob + 1) * nRecords / nJobs;
+        OGRGeoJSONSeqRecord *pasRecords = m_aoNextBatch.data() + iStart;
+        m_poJobQueue->SubmitJob(
+            [this, pasRecords, iStart, iEnd, bFirstPass]()
+            { ProcessRecords(pasRecords, iEnd - iStart, bFirstPass); });
+    }
+    m_bNextBatchSubmitted = true;
+    return true;
+}
+
+/************************************************************************/
+/*                       GetNextProcessedRecord()                       */
+/************************************************************************/
+
+/** Return the next record processed by worker threads, in file order, after
+ * having replayed the errors emitted while processing it. Returns nullptr
+ * when there is no record left. */
+OGRGeoJSONSeqRecord *OGRGeoJSONSeqLayer::GetNextProcessedRecord()
+{
+    while (m_iCurRecord == m_aoCurBatch.size())
+    {
+        if (!m_bNextBatchSubmitted && !SubmitNextBatch())
+            return nullptr;
+        m_poJobQueue->WaitCompletion();
+        m_bNextBatchSubmitted = false;
+        std::swap(m_aoCurBatch, m_aoNextBatch);
+        m_iCurRecord = 0;
+
+        // Process the next batch while the current one is consumed
+        SubmitNextBatch();
+    }
+
+    auto &sRecord = m_aoCurBatch[m_iCurRecord++];
+    for (const auto &sError : sRecord.aoErrors)
+    {
+        CPLError(sError.type, sError.no, "%s", sError.msg.c_str());
     }
+    sRecord.aoErrors.clear();
+    return &sRecord;
+}
+
+/************************************************************************/
+/*                           StopProcessing()                           */
+/************************************************************************/
+
+/** Wait for pending jobs and discard the records being processed. */
+void OGRGeoJSONSeqLayer::StopProcessing()
+{
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+    m_aoCurBatch.clear();
+    m_aoNextBatch.clear();
+    m_iCurRecord = 0;
+    m_bNextBatchSubmitted = false;
 }
 
 /************************************************************************/
@@ -602,35 +1035,23 @@ OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
     GetLayerDefn();  // force scan if not already done
     while (true)
     {
-        auto poObject = GetNextObject(false);
-        if (!poObject)
-            return nullptr;
         OGRFeature *poFeature;
-        auto type = OGRGeoJSONGetType(poObject);
-        if (type == GeoJSONObject::eFeature)
+        if (m_poJobQueue)
         {
-            poFeature = m_oReader.ReadFeature(this, poObject,
-                                              m_osFeatureBuffer.c_str());
-            json_object_put(poObject);
-        }
-        else if (type == GeoJSONObject::eFeatureCollection ||
-                 type == GeoJSONObject::eUnknown)
-        {
-            json_object_put(poObject);
-            continue;
+            auto psRecord = GetNextProcessedRecord();
+            if (!psRecord)
+                return nullptr;
+            poFeature = psRecord->poFeature.release();
         }
         else
         {
-            OGRGeometry *poGeom =
-                m_oReader.ReadGeometry(poObject, GetSpatialRef());
-            json_object_put(poObject);
-            if (!poGeom)
-            {
-                continue;
-            }
-            poFeature = new OGRFeature(m_poFeatureDefn);
-            poFeature->SetGeometryDirectly(poGeom);
+            auto poObject = GetNextObject(false);
+            if (!poObject)
+                return nullptr;
+            poFeature = TranslateObject(poObject, GetDirectGeometry());
         }
+        if (!poFeature)
+            continue;
 
         if (poFeature->GetFID() == OGRNullFID)
         {
@@ -25,6 +25,7 @@
 #include <json_object_private.h>  // just for sizeof(struct json_object)
 #endif
 
+#include <cmath>
 #include <limits>
 
 #if (!defined(JSON_C_VERSION_NUM)) || (JSON_C_VERSION_NUM < JSON_C_VER_013)
@@ -104,6 +105,404 @@ void OGRJSONCollectionStreamingParser::AppendObject(json_object *poNewObj)
     }
 }
 
+/************************************************************************/
+/*                       MaterializeCoordinates()                       */
+/************************************************************************/
+
+/** Convert the coordinates captured in compact form into json_object
+ * instances, attached as the "coordinates" member of their geometry object.
+ * If the capture is still in progress, the arrays that are still open are
+ * pushed on the object stack, so that parsing can go on the regular way.
+ */
+void OGRJSONCollectionStreamingParser::MaterializeCoordinates()
+{
+    CPLAssert(m_poCoordsOwnerObj);
+
+    std::vector<json_object *> apoStack;
+    json_object *poCoordinates = nullptr;
+    size_t iValue = 0;
+    for (const char chToken : m_achCoordTokens)
+    {
+        if (chToken == ']')
+        {
+            apoStack.pop_back();
+            continue;
+        }
+
+        json_object *poNewObj;
+        if (chToken == '[')
+            poNewObj = json_object_new_array();
+        else if (chToken == 'i')
+            poNewObj = json_object_new_int64(
+                static_cast<GIntBig>(m_adfCoordValues[iValue++]));
+        else
+            poNewObj = json_object_new_double(m_adfCoordValues[iValue++]);
+
+        if (apoStack.empty())
+            poCoordinates = poNewObj;
+        else
+            json_object_array_add(apoStack.back(), poNewObj);
+        if (chToken == '[')
+            apoStack.push_back(poNewObj);
+    }
+    json_object_object_add(m_poCoordsOwnerObj, "coordinates", poCoordinates);
+    m_apoCurObj.insert(m_apoCurObj.end(), apoStack.begin(), apoStack.end());
+
+    m_poCoordsOwnerObj = nullptr;
+    m_nCoordArrayDepth = 0;
+    m_achCoordTokens.clear();
+    m_adfCoordValues.clear();
+}
+
+/************************************************************************/
+/*                  OGRJSONGetMemberIfUnambiguous()                     */
+/************************************************************************/
+
+/** Return whether poObj has a single member whose key is equal to pszKey in
+ * a case insensitive way, and that it is equal to it in a case sensitive
+ * way, so that all lookup methods used by the GeoJSON readers agree.
+ */
+static bool OGRJSONGetMemberIfUnambiguous(json_object *poObj,
+                                          const char *pszKey,
+                                          json_object *&poVal)
+{
+    lh_entry *psFound = nullptr;
+    for (lh_entry *psEntry = json_object_get_object(poObj)->head; psEntry;
+         psEntry = psEntry->next)
+    {
+        if (EQUAL(static_cast<const char *>(psEntry->k), pszKey))
+        {
+            if (psFound)
+                return false;
+            psFound = psEntry;
+        }
+    }
+    if (!psFound || strcmp(static_cast<const char *>(psFound->k), pszKey) != 0)
+        return false;
+    poVal = static_cast<json_object *>(const_cast<void *>(psFound->v));
+    return true;
+}
+
+/************************************************************************/
+/*                     OGRJSONCoordinatesDecoder                        */
+/************************************************************************/
+
+namespace
+{
+/** Decode the compact form of the "coordinates" member of a GeoJSON
+ * geometry.
+ *
+ * Only regular arrays are handled: no empty array, positions with 2 or 3
+ * members, and the same number of members for all positions of the geometry.
+ * This ensures that the result is exactly the same as the one of
+ * OGRGeoJSONReadGeometry(), OGRGeoJSONGetOGRGeometryType() and
+ * OGRGeoJSONGetExtent3D() on the equivalent json_object.
+ */
+class OGRJSONCoordinatesDecoder
+{
+    const std::vector<char> &m_achTokens;
+    const std::vector<double> &m_adfValues;
+    OGREnvelope3D &m_sExtent;
+    size_t m_iToken = 0;
+    size_t m_iValue = 0;
+
+    bool Consume(char chToken)
+    {
+        if (m_iToken == m_achTokens.size() || m_achTokens[m_iToken] != chToken)
+            return false;
+        ++m_iToken;
+        return true;
+    }
+
+    bool StartNonEmptyArray()
+    {
+        return Consume('[') && m_iToken < m_achTokens.size() &&
+               m_achTokens[m_iToken] != ']';
+    }
+
+  public:
+    int m_nDim = 0;
+
+    OGRJSONCoordinatesDecoder(const std::vector<char> &achTokens,
+                              const std::vector<double> &adfValues,
+                              OGREnvelope3D &sExtent)
+        : m_achTokens(achTokens), m_adfValues(adfValues), m_sExtent(sExtent)
+    {
+    }
+
+    bool IsAtEnd() const
+    {
+        return m_iToken == m_achTokens.size();
+    }
+
+    bool ReadPosition(double adfXYZ[3]);
+    bool ReadMultiPoint(OGRMultiPoint *poMP);
+    bool ReadCurve(OGRSimpleCurve *poCurve);
+    bool ReadMultiLineString(OGRMultiLineString *poMLS);
+    bool ReadPolygon(OGRPolygon *poPoly);
+    bool ReadMultiPolygon(OGRMultiPolygon *poMP);
+};
+
+bool OGRJSONCoordinatesDecoder::ReadPosition(double adfXYZ[3])
+{
+    if (!Consume('['))
+        return false;
+    int nDim = 0;
+    while (m_iToken < m_achTokens.size() &&
+           (m_achTokens[m_iToken] == 'i' || m_achTokens[m_iToken] == 'd'))
+    {
+        if (nDim == 3)
+            return false;
+        adfXYZ[nDim++] = m_adfValues[m_iValue++];
+        ++m_iToken;
+    }
+    if (!Consume(']') || nDim < 2 || (m_nDim != 0 && nDim != m_nDim))
+        return false;
+    m_nDim = nDim;
+
+    if (!std::isnan(adfXYZ[0]) && !std::isnan(adfXYZ[1]))
+    {
+        if (nDim == 2 || std::isnan(adfXYZ[2]))
+            static_cast<OGREnvelope &>(m_sExtent).Merge(adfXYZ[0], adfXYZ[1]);
+        else
+            m_sExtent.Merge(adfXYZ[0], adfXYZ[1], adfXYZ[2]);
+    }
+    return true;
+}
+
+bool OGRJSONCoordinatesDecoder::ReadMultiPoint(OGRMultiPoint *poMP)
+{
+    if (!StartNonEmptyArray())
+        return false;
+    while (!Consume(']'))
+    {
+        double adfXYZ[3];
+        if (!ReadPosition(adfXYZ))
+            return false;
+        if (poMP)
+        {
+            if (m_nDim == 3)
+                poMP->addGeometryDirectly(
+                    new OGRPoint(adfXYZ[0], adfXYZ[1], adfXYZ[2]));
+            else
+                poMP->addGeometryDirectly(new OGRPoint(adfXYZ[0], adfXYZ[1]));
+        }
+    }
+    return true;
+}
+
+bool OGRJSONCoordinatesDecoder::ReadCurve(OGRSimpleCurve *poCurve)
+{
+    if (!StartNonEmptyArray())
+        return false;
+    while (!Consume(']'))
+    {
+        double adfXYZ[3];
+        if (!ReadPosition(adfXYZ))
+            return false;
+        if (poCurve)
+        {
+            if (m_nDim == 3)
+                poCurve->addPoint(adfXYZ[0], adfXYZ[1], adfXYZ[2]);
+            else
+                poCurve->addPoint(adfXYZ[0], adfXYZ[1]);
+        }
+    }
+    return true;
+}
+
+bool OGRJSONCoordinatesDecoder::ReadMultiLineString(OGRMultiLineString *poMLS)
+{
+    if (!StartNonEmptyArray())
+        return false;
+    while (!Consume(']'))
+    {
+        std::unique_ptr<OGRLineString> poLS;
+        if (poMLS)
+            poLS = std::make_unique<OGRLineString>();
+        if (!ReadCurve(poLS.get()))
+            return false;
+        if (poMLS)
+            poMLS->addGeometryDirectly(poLS.release());
+    }
+    return true;
+}
+
+bool OGRJSONCoordinatesDecoder::ReadPolygon(OGRPolygon *poPoly)
+{
+    if (!StartNonEmptyArray())
+        return false;
+    while (!Consume(']'))
+    {
+        std::unique_ptr<OGRLinearRing> poRing;
+        if (poPoly)
+            poRing = std::make_unique<OGRLinearRing>();
+        if (!ReadCurve(poRing.get()))
+            return false;
+        if (poPoly)
+            poPoly->addRingDirectly(poRing.release());
+    }
+    return true;
+}
+
+bool OGRJSONCoordinatesDecoder::ReadMultiPolygon(OGRMultiPolygon *poMP)
+{
+    if (!StartNonEmptyArray())
+        return false;
+    while (!Consume(']'))
+    {
+        std::unique_ptr<OGRPolygon> poPoly;
+        if (poMP)
+            poPoly = std::make_unique<OGRPolygon>();
+        if (!ReadPolygon(poPoly.get()))
+            return false;
+        if (poMP)
+            poMP->addGeometryDirectly(poPoly.release());
+    }
+    return true;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                       FinalizeDirectGeometry()                       */
+/************************************************************************/
+
+/** Called at the end of a feature whose geometry coordinates have been
+ * captured in compact form, to decode them, or materialize them as
+ * json_object if they cannot be decoded directly.
+ */
+void OGRJSONCollectionStreamingParser::FinalizeDirectGeometry()
+{
+    CPLAssert(m_nCoordArrayDepth == 0);
+
+    // The geometry object must be the one that all code paths of the readers
+    // would pick, and have nothing else that would influence the decoding.
+    json_object *poGeomObj = nullptr;
+    json_object *poType = nullptr;
+    const char *pszType = nullptr;
+    if (OGRJSONGetMemberIfUnambiguous(m_poCurObj, "geometry", poGeomObj) &&
+        poGeomObj == m_poCoordsOwnerObj &&
+        OGRJSONGetMemberIfUnambiguous(m_poCoordsOwnerObj, "type", poType) &&
+        json_object_get_type(poType) == json_type_string &&
+        !OGRGeoJSONFindMemberByName(m_poCoordsOwnerObj, "coordinates") &&
+        !OGRGeoJSONFindMemberByName(m_poCoordsOwnerObj, "crs"))
+    {
+        pszType = json_object_get_string(poType);
+    }
+
+    OGRJSONDirectGeometry &oDG = m_oDirectGeometry;
+    oDG.sExtent = OGREnvelope3D();
+    oDG.poGeom.reset();
+    OGRJSONCoordinatesDecoder oDecoder(m_achCoordTokens, m_adfCoordValues,
+                                       oDG.sExtent);
+    const bool bBuild = !m_bFirstPass;
+    bool bOK = false;
+    if (pszType == nullptr)
+    {
+        // do nothing
+    }
+    else if (EQUAL(pszType, "Point"))
+    {
+        double adfXYZ[3];
+        bOK = oDecoder.ReadPosition(adfXYZ);
+        oDG.eType = wkbPoint;
+        if (bOK && bBuild)
+        {
+            if (oDecoder.m_nDim == 3)
+                oDG.poGeom = std::make_unique<OGRPoint>(adfXYZ[0], adfXYZ[1],
+                                                        adfXYZ[2]);
+            else
+                oDG.poGeom = std::make_unique<OGRPoint>(adfXYZ[0], adfXYZ[1]);
+        }
+    }
+    else if (EQUAL(pszType, "LineString"))
+    {
+        auto poLS = bBuild ? std::make_unique<OGRLineString>() : nullptr;
+        bOK = oDecoder.ReadCurve(poLS.get());
+        oDG.eType = wkbLineString;
+        oDG.poGeom = std::move(poLS);
+    }
+    else if (EQUAL(pszType, "Polygon"))
+    {
+        auto poPoly = bBuild ? std::make_unique<OGRPolygon>() : nullptr;
+        bOK = oDecoder.ReadPolygon(poPoly.get());
+        oDG.eType = wkbPolygon;
+        oDG.poGeom = std::move(poPoly);
+    }
+    else if (EQUAL(pszType, "MultiPoint"))
+    {
+        auto poMP = bBuild ? std::make_unique<OGRMultiPoint>() : nullptr;
+        bOK = oDecoder.ReadMultiPoint(poMP.get());
+        oDG.eType = wkbMultiPoint;
+        oDG.poGeom = std::move(poMP);
+    }
+    else if (EQUAL(pszType, "MultiLineString"))
+    {
+        auto poMLS = bBuild ? std::make_unique<OGRMultiLineString>() : nullptr;
+        bOK = oDecoder.ReadMultiLineString(poMLS.get());
+        oDG.eType = wkbMultiLineString;
+        oDG.poGeom = std::move(poMLS);
+    }
+    else if (EQUAL(pszType, "MultiPolygon"))
+    {
+        auto poMP = bBuild ? std::make_unique<OGRMultiPolygon>() : nullptr;
+        bOK = oDecoder.ReadMultiPolygon(poMP.get());
+        oDG.eType = wkbMultiPolygon;
+        oDG.poGeom = std::move(poMP);
+    }
+
+    if (bOK && oDecoder.IsAtEnd())
+    {
+        if (oDecoder.m_nDim == 3)
+            oDG.eType = OGR_GT_SetZ(oDG.eType);
+        m_bHasDirectGeometry = true;
+        m_poCoordsOwnerObj = nullptr;
+        m_achCoordTokens.clear();
+        m_adfCoordValues.clear();
+    }
+    else
+    {
+        oDG.poGeom.reset();
+        MaterializeCoordinates();
+    }
+}
+
+/************************************************************************/
+/*                         StartSingleFeature()                         */
+/************************************************************************/
+
+/** Prepare the parser to consume a single top-level Feature object (for
+ * example a GeoJSONSeq record), instead of a FeatureCollection.
+ * May be called several times, for each new object.
+ */
+void OGRJSONCollectionStreamingParser::StartSingleFeature()
+{
+    Reset();
+    if (m_poCurObj && m_poCurObj != m_poRootObj)
+        json_object_put(m_poCurObj);
+    m_poCurObj = nullptr;
+    m_apoCurObj.clear();
+    m_abFirstMember.clear();
+    m_osJson.clear();
+    m_nCurObjMemEstimate = 0;
+    m_bKeySet = false;
+    m_osCurKey.clear();
+    m_bInCoordinates = false;
+    m_poGeometryObj = nullptr;
+    m_poCoordsOwnerObj = nullptr;
+    m_nCoordArrayDepth = 0;
+    m_achCoordTokens.clear();
+    m_adfCoordValues.clear();
+    m_bHasDirectGeometry = false;
+    m_oDirectGeometry.poGeom.reset();
+
+    // Pretend we are in the "features" array of a FeatureCollection
+    m_nDepth = 2;
+    m_bInFeatures = true;
+    m_bInFeaturesArray = true;
+}
+
 /************************************************************************/
 /*                            StartObject()                             */
 /************************************************************************/
@@ -116,6 +515,9 @@ void OGRJSONCollectionStreamingParser::StartObject()
         return;
     }
 
+    if (m_nCoordArrayDepth > 0)
+        MaterializeCoordinates();
+
     if (m_bInFeaturesArray && m_nDepth == 2)
     {
         m_poCurObj = json_object_new_object();
@@ -138,6 +540,11 @@ void OGRJSONCollectionStreamingParser::StartObject()
         m_nCurObjMemEstimate += ESTIMATE_OBJECT_SIZE;
 
         json_object *poNewObj = json_object_new_object();
+        if (m_bDirectGeometry && m_bInFeaturesArray && m_nDepth == 3 &&
+            m_bKeySet && m_osCurKey == "geometry")
+        {
+            m_poGeometryObj = poNewObj;
+        }
         AppendObject(poNewObj);
         m_apoCurObj.push_back(poNewObj);
     }
@@ -175,6 +582,9 @@ void OGRJSONCollectionStreamingParser::EndObject()
                 m_osJson.size() + strlen("application/vnd.geo+json");
         }
 
+        if (m_poCoordsOwnerObj)
+            FinalizeDirectGeometry();
+
         json_object *poObjTypeObj =
             CPL_json_object_object_get(m_poCurObj, "type");
         if (poObjTypeObj &&
@@ -192,6 +602,9 @@ void OGRJSONCollectionStreamingParser::EndObject()
         m_apoCurObj.clear();
         m_nCurObjMemEstimate = 0;
         m_bInCoordinates = false;
+        m_poGeometryObj = nullptr;
+        m_bHasDirectGeometry = false;
+        m_oDirectGeometry.poGeom.reset();
         m_nTotalOGRFeatureMemEstimate += sizeof(OGRFeature);
         m_osJson.clear();
         m_abFirstMember.clear();
@@ -249,6 +662,20 @@ void OGRJSONCollectionStreamingParser::StartObjectMember(const char *pszKey,
     {
         m_bInCoordinates = strcmp(pszKey, "coordinates") == 0 ||
                            strcmp(pszKey, "geometries") == 0;
+        if (EQUAL(pszKey, "geometry"))
+        {
+            // The previous geometry object is going to be replaced
+            if (m_poCoordsOwnerObj)
+                MaterializeCoordinates();
+            m_poGeometryObj = nullptr;
+        }
+    }
+    else if (m_nDepth == 4 && m_poCoordsOwnerObj &&
+             m_apoCurObj.back() == m_poCoordsOwnerObj &&
+             EQUAL(pszKey, "coordinates"))
+    {
+        // Duplicated coordinates member: let json-c deal with it
+        MaterializeCoordinates();
     }
 
     if (m_poCurObj)
@@ -294,9 +721,28 @@ void OGRJSONCollectionStreamingParser::StartArray()
 
         m_nCurObjMemEstimate += ESTIMATE_ARRAY_SIZE;
 
-        json_object *poNewObj = json_object_new_array();
-        AppendObject(poNewObj);
-        m_apoCurObj.push_back(poNewObj);
+        if (m_nCoordArrayDepth > 0)
+        {
+            m_achCoordTokens.push_back('[');
+            m_nCoordArrayDepth++;
+        }
+        else if (m_poGeometryObj && m_nDepth == 4 && m_bKeySet &&
+                 m_apoCurObj.back() == m_poGeometryObj &&
+                 m_osCurKey == "coordinates")
+        {
+            CPLAssert(m_poCoordsOwnerObj == nullptr);
+            m_poCoordsOwnerObj = m_poGeometryObj;
+            m_osCurKey.clear();
+            m_bKeySet = false;
+            m_achCoordTokens.push_back('[');
+            m_nCoordArrayDepth = 1;
+        }
+        else
+        {
+            json_object *poNewObj = json_object_new_array();
+            AppendObject(poNewObj);
+            m_apoCurObj.push_back(poNewObj);
+        }
     }
     m_nDepth++;
 }
@@ -345,7 +791,15 @@ void OGRJSONCollectionStreamingParser::EndArray()
             m_osJson += "]";
         }
 
-        m_apoCurObj.pop_back();
+        if (m_nCoordArrayDepth > 0)
+        {
+            m_achCoordTokens.push_back(']');
+            m_nCoordArrayDepth--;
+        }
+        else
+        {
+            m_apoCurObj.pop_back();
+        }
     }
 }
 
@@ -380,6 +834,8 @@ void OGRJSONCollectionStreamingParser::String(const char *pszValue, size_t nLen)
         {
             m_osJson += CPLJSonStreamingParser::GetSerializedString(pszValue);
         }
+        if (m_nCoordArrayDepth > 0)
+            MaterializeCoordinates();
         AppendObject(json_object_new_string(pszValue));
     }
 }
@@ -415,29 +871,55 @@ void OGRJSONCollectionStreamingParser::Number(const char *pszValue, size_t nLen)
             m_osJson.append(pszValue, nLen);
         }
 
+        bool bIsInteger = false;
+        GIntBig nVal = 0;
+        double dfVal = 0;
         if (CPLGetValueType(pszValue) == CPL_VALUE_REAL)
         {
-            AppendObject(json_object_new_double(CPLAtof(pszValue)));
+            dfVal = CPLAtof(pszValue);
         }
         else if (nLen == strlen("Infinity") && EQUAL(pszValue, "Infinity"))
         {
-            AppendObject(json_object_new_double(
-                std::numeric_limits<double>::infinity()));
+            dfVal = std::numeric_limits<double>::infinity();
         }
         else if (nLen == strlen("-Infinity") && EQUAL(pszValue, "-Infinity"))
         {
-            AppendObject(json_object_new_double(
-                -std::numeric_limits<double>::infinity()));
+            dfVal = -std::numeric_limits<double>::infinity();
         }
         else if (nLen == strlen("NaN") && EQUAL(pszValue, "NaN"))
         {
-            AppendObject(json_object_new_double(
-                std::numeric_limits<double>::quiet_NaN()));
+            dfVal = std::numeric_limits<double>::quiet_NaN();
         }
         else
         {
-            AppendObject(json_object_new_int64(CPLAtoGIntBig(pszValue)));
+            bIsInteger = true;
+            nVal = CPLAtoGIntBig(pszValue);
         }
+
+        if (m_nCoordArrayDepth > 0)
+        {
+            // Integers are stored as double, so only keep those that
+            // can be represented exactly.
+            constexpr GIntBig MAX_EXACT_INT = static_cast<GIntBig>(1) << 53;
+            if (!bIsInteger)
+            {
+                m_achCoordTokens.push_back('d');
+                m_adfCoordValues.push_back(dfVal);
+                return;
+            }
+            else if (nVal >= -MAX_EXACT_INT && nVal <= MAX_EXACT_INT)
+            {
+                m_achCoordTokens.push_back('i');
+                m_adfCoordValues.push_back(static_cast<double>(nVal));
+                return;
+            }
+            MaterializeCoordinates();
+        }
+
+        if (bIsInteger)
+            AppendObject(json_object_new_int64(nVal));
+        else
+            AppendObject(json_object_new_double(dfVal));
     }
 }
 
@@ -467,6 +949,8 @@ void OGRJSONCollectionStreamingParser::Boolean(bool bVal)
             m_osJson += bVal ? "true" : "false";
         }
 
+        if (m_nCoordArrayDepth > 0)
+            MaterializeCoordinates();
         AppendObject(json_object_new_boolean(bVal));
     }
 }
@@ -491,6 +975,8 @@ void OGRJSONCollectionStreamingParser::Null()
         }
 
         m_nCurObjMemEstimate += ESTIMATE_BASE_OBJECT_SIZE;
+        if (m_nCoordArrayDepth > 0)
+            MaterializeCoordinates();
         AppendObject(nullptr);
     }
 }
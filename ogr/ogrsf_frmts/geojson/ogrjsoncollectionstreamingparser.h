@@ -14,9 +14,31 @@
 #define OGRJSONCOLLECTIONSTREAMING_PARSER_H_INCLUDED
 
 #include "cpl_json_streaming_parser.h"
+#include "ogr_geometry.h"
 
 #include <json.h>  // JSON-C
 
+#include <memory>
+
+/************************************************************************/
+/*                         OGRJSONDirectGeometry                        */
+/************************************************************************/
+
+/** Geometry of a feature decoded directly from the parser events, without
+ * building the json_object tree of its "coordinates" member.
+ */
+struct OGRJSONDirectGeometry
+{
+    //! Geometry type, as OGRGeoJSONGetOGRGeometryType() would return it
+    OGRwkbGeometryType eType = wkbUnknown;
+
+    //! Extent, as OGRGeoJSONGetExtent3D() would compute it
+    OGREnvelope3D sExtent{};
+
+    //! Geometry. Only set when not in first pass.
+    std::unique_ptr<OGRGeometry> poGeom{};
+};
+
 /************************************************************************/
 /*                      OGRJSONCollectionStreamingParser                */
 /************************************************************************/
@@ -51,7 +73,25 @@ class OGRJSONCollectionStreamingParser CPL_NON_FINAL
     bool m_bStartFeature = false;
     bool m_bEndFeature = false;
 
+    // Decoding of the "coordinates" member of the "geometry" object of
+    // features without building json_object instances. The coordinates
+    // are stored as a compact sequence of tokens ('[', ']', 'i' for integer
+    // values and 'd' for real values, the later two having their value in
+    // m_adfCoordValues), and are either directly converted to a geometry
+    // once the feature is complete, or materialized as json_object if they
+    // cannot be handled that way.
+    bool m_bDirectGeometry = false;
+    json_object *m_poGeometryObj = nullptr;
+    json_object *m_poCoordsOwnerObj = nullptr;
+    int m_nCoordArrayDepth = 0;
+    std::vector<char> m_achCoordTokens{};
+    std::vector<double> m_adfCoordValues{};
+    OGRJSONDirectGeometry m_oDirectGeometry{};
+    bool m_bHasDirectGeometry = false;
+
     void AppendObject(json_object *poNewObj);
+    void MaterializeCoordinates();
+    void FinalizeDirectGeometry();
 
     CPL_DISALLOW_COPY_ASSIGN(OGRJSONCollectionStreamingParser)
 
@@ -65,6 +105,25 @@ class OGRJSONCollectionStreamingParser CPL_NON_FINAL
                             const std::string &osJson) = 0;
     virtual void TooComplex() = 0;
 
+    /** Enable decoding of feature geometries straight from the parser
+     * events. GotFeature() implementations must then use
+     * GetDirectGeometry(), since the "coordinates" member of the geometry
+     * is then missing from the json_object they receive when it is set.
+     */
+    inline void SetDirectGeometry(bool bDirectGeometry)
+    {
+        m_bDirectGeometry = bDirectGeometry;
+    }
+
+    /** Return the geometry of the feature passed to GotFeature(), when it
+     * has been decoded directly, or nullptr. */
+    inline OGRJSONDirectGeometry *GetDirectGeometry()
+    {
+        return m_bHasDirectGeometry ? &m_oDirectGeometry : nullptr;
+    }
+
+    void StartSingleFeature();
+
   public:
     OGRJSONCollectionStreamingParser(bool bFirstPass, bool bStoreNativeData,
                                      size_t nMaxObjectSize);
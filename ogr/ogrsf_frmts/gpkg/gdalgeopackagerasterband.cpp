@@ -15,13 +15,17 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <map>
 #include <set>
 #include <utility>
+#include <vector>
 
 #if !defined(DEBUG_VERBOSE) && defined(DEBUG_VERBOSE_GPKG)
 #define DEBUG_VERBOSE
@@ -132,6 +136,24 @@ CPLErr GDALGPKGMBTilesLikeRasterBand::FlushCache(bool bAtClosing)
     return eErr;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GDALGPKGMBTilesLikeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize)
+        m_poTPD->PrefetchTiles(nXOff, nYOff, nXSize, nYSize);
+
+    return GDALPamRasterBand::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nPixelSpace, nLineSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                              FlushTiles()                            */
 /************************************************************************/
@@ -428,40 +450,19 @@ void GDALGPKGMBTilesLikePseudoDataset::FillEmptyTileSingleBand(GByte *pabyData)
 /************************************************************************/
 
 CPLErr GDALGPKGMBTilesLikePseudoDataset::ReadTile(
-    const CPLString &osMemFileName, GByte *pabyTileData, double dfTileOffset,
-    double dfTileScale, bool *pbIsLossyFormat)
+    const GByte *pabyBlob, size_t nBlobSize, GByte *pabyTileData,
+    double dfTileOffset, double dfTileScale, bool *pbIsLossyFormat)
 {
     const char *const apszDriversByte[] = {"JPEG", "PNG", "WEBP", nullptr};
     const char *const apszDriversInt[] = {"PNG", nullptr};
     const char *const apszDriversFloat[] = {"GTiff", nullptr};
+    const char *const *papszDrivers = (m_eDT == GDT_Byte) ? apszDriversByte
+                                      : (m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
+                                          ? apszDriversFloat
+                                          : apszDriversInt;
     int nBlockXSize, nBlockYSize;
     IGetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
     const int nBands = IGetRasterCount();
-    auto poDSTile = std::unique_ptr<GDALDataset>(GDALDataset::Open(
-        osMemFileName.c_str(), GDAL_OF_RASTER | GDAL_OF_INTERNAL,
-        (m_eDT == GDT_Byte)                   ? apszDriversByte
-        : (m_eTF == GPKG_TF_TIFF_32BIT_FLOAT) ? apszDriversFloat
-                                              : apszDriversInt,
-        nullptr, nullptr));
-    if (poDSTile == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Cannot parse tile data");
-        FillEmptyTile(pabyTileData);
-        return CE_Failure;
-    }
-
-    const int nTileBandCount = poDSTile->GetRasterCount();
-
-    if (!(poDSTile->GetRasterXSize() == nBlockXSize &&
-          poDSTile->GetRasterYSize() == nBlockYSize &&
-          (nTileBandCount >= 1 && nTileBandCount <= 4)) ||
-        (m_eDT != GDT_Byte && nTileBandCount != 1))
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Inconsistent tiles characteristics");
-        FillEmptyTile(pabyTileData);
-        return CE_Failure;
-    }
 
     GDALDataType eRequestDT = GDT_Byte;
     if (m_eTF == GPKG_TF_PNG_16BIT)
@@ -476,15 +477,106 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::ReadTile(
         eRequestDT = GDT_Float32;
     }
 
-    if (poDSTile->RasterIO(GF_Read, 0, 0, nBlockXSize, nBlockYSize,
-                           pabyTileData, nBlockXSize, nBlockYSize, eRequestDT,
-                           poDSTile->GetRasterCount(), nullptr, 0, 0, 0,
-                           nullptr) != CE_None)
+    // First try to decode the tile directly from its blob with the in-memory
+    // codec API of the candidate drivers, which avoids the cost of creating
+    // a /vsimem/ file and opening a dataset on it. Tiles larger than the
+    // block size are rejected before the decoded image is allocated.
+    CPLStringList aosDecodeOptions;
+    aosDecodeOptions.SetNameValue("MAX_XSIZE", CPLSPrintf("%d", nBlockXSize));
+    aosDecodeOptions.SetNameValue("MAX_YSIZE", CPLSPrintf("%d", nBlockYSize));
+    GDALDecodedImage sImage;
+    const char *pszTileDriverName = nullptr;
+    for (int i = 0; papszDrivers[i] != nullptr && !pszTileDriverName; ++i)
     {
+        auto poDriver =
+            GetGDALDriverManager()->GetDriverByName(papszDrivers[i]);
+        if (!poDriver || !poDriver->GetDecodeImageCallback())
+            continue;
+        const auto nErrorCounter = CPLGetErrorCounter();
+        if (poDriver->DecodeImage(pabyBlob, nBlobSize, aosDecodeOptions.List(),
+                                  sImage))
+        {
+            pszTileDriverName = papszDrivers[i];
+        }
+        else if (CPLGetErrorCounter() != nErrorCounter)
+        {
+            FillEmptyTile(pabyTileData);
+            return CE_Failure;
+        }
+    }
+
+    // Otherwise go through the dataset API.
+    CPLString osMemFileName;
+    std::unique_ptr<GDALDataset> poDSTile;
+    if (!pszTileDriverName)
+    {
+        osMemFileName = VSIMemGenerateHiddenFilename("gpkg_read_tile");
+        VSIFCloseL(VSIFileFromMemBuffer(osMemFileName.c_str(),
+                                        const_cast<GByte *>(pabyBlob),
+                                        nBlobSize, FALSE));
+        poDSTile.reset(GDALDataset::Open(osMemFileName.c_str(),
+                                         GDAL_OF_RASTER | GDAL_OF_INTERNAL,
+                                         papszDrivers, nullptr, nullptr));
+        if (poDSTile == nullptr)
+        {
+            VSIUnlink(osMemFileName);
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot parse tile data");
+            FillEmptyTile(pabyTileData);
+            return CE_Failure;
+        }
+        pszTileDriverName = poDSTile->GetDriver()->GetDescription();
+        sImage.nXSize = poDSTile->GetRasterXSize();
+        sImage.nYSize = poDSTile->GetRasterYSize();
+        sImage.nBands = poDSTile->GetRasterCount();
+    }
+
+    const int nTileBandCount = sImage.nBands;
+
+    if (!(sImage.nXSize == nBlockXSize && sImage.nYSize == nBlockYSize &&
+          (nTileBandCount >= 1 && nTileBandCount <= 4)) ||
+        (m_eDT != GDT_Byte && nTileBandCount != 1))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Inconsistent tiles characteristics");
+        if (poDSTile)
+        {
+            poDSTile.reset();
+            VSIUnlink(osMemFileName);
+        }
         FillEmptyTile(pabyTileData);
         return CE_Failure;
     }
 
+    if (poDSTile)
+    {
+        const CPLErr eErr = poDSTile->RasterIO(
+            GF_Read, 0, 0, nBlockXSize, nBlockYSize, pabyTileData, nBlockXSize,
+            nBlockYSize, eRequestDT, nTileBandCount, nullptr, 0, 0, 0,
+            nullptr);
+        if (eErr == CE_None && (nBands == 1 || nTileBandCount == 1))
+        {
+            const GDALColorTable *poTileCT =
+                poDSTile->GetRasterBand(1)->GetColorTable();
+            if (poTileCT)
+                sImage.poColorTable.reset(poTileCT->Clone());
+        }
+        poDSTile.reset();
+        VSIUnlink(osMemFileName);
+        if (eErr != CE_None)
+        {
+            FillEmptyTile(pabyTileData);
+            return CE_Failure;
+        }
+    }
+    else
+    {
+        GDALCopyWords64(sImage.abyData.data(), sImage.eDT,
+                        GDALGetDataTypeSizeBytes(sImage.eDT), pabyTileData,
+                        eRequestDT, GDALGetDataTypeSizeBytes(eRequestDT),
+                        static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize *
+                            nTileBandCount);
+    }
+
     if (m_eDT != GDT_Byte)
     {
         int bHasNoData = FALSE;
@@ -563,16 +655,16 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::ReadTile(
         return CE_None;
     }
 
-    GDALColorTable *poCT = nullptr;
+    const GDALColorTable *poCT = nullptr;
     if (nBands == 1 || nTileBandCount == 1)
     {
-        poCT = poDSTile->GetRasterBand(1)->GetColorTable();
+        poCT = sImage.poColorTable.get();
         IGetRasterBand(1)->GetColorTable();
     }
 
     if (pbIsLossyFormat)
         *pbIsLossyFormat =
-            !EQUAL(poDSTile->GetDriver()->GetDescription(), "PNG") ||
+            !EQUAL(pszTileDriverName, "PNG") ||
             (poCT != nullptr && poCT->GetColorEntryCount() == 256) /* PNG8 */;
 
     /* Map RGB(A) tile to single-band color indexed */
@@ -895,20 +987,14 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
         const int nBytes = sqlite3_column_bytes(hStmt, 0);
         GIntBig nTileId =
             (m_eDT == GDT_Byte) ? 0 : sqlite3_column_int64(hStmt, 1);
-        GByte *pabyRawData = static_cast<GByte *>(
-            const_cast<void *>(sqlite3_column_blob(hStmt, 0)));
-        const CPLString osMemFileName(
-            VSIMemGenerateHiddenFilename("gpkg_read_tile"));
-        VSILFILE *fp = VSIFileFromMemBuffer(osMemFileName.c_str(), pabyRawData,
-                                            nBytes, FALSE);
-        VSIFCloseL(fp);
+        const GByte *pabyRawData =
+            static_cast<const GByte *>(sqlite3_column_blob(hStmt, 0));
 
         double dfTileOffset = 0.0;
         double dfTileScale = 1.0;
         GetTileOffsetAndScale(nTileId, dfTileOffset, dfTileScale);
-        ReadTile(osMemFileName, pabyData, dfTileOffset, dfTileScale,
+        ReadTile(pabyRawData, nBytes, pabyData, dfTileOffset, dfTileScale,
                  pbIsLossyFormat);
-        VSIUnlink(osMemFileName);
         sqlite3_finalize(hStmt);
     }
     else if (rc == SQLITE_BUSY)
@@ -980,6 +1066,241 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
     return pabyData;
 }
 
+/************************************************************************/
+/*                          PrefetchTiles()                             */
+/************************************************************************/
+
+/** Fetch with a single SQL request the tiles intersecting the passed window
+ * that are not yet in the block cache, decode them in parallel when
+ * GDAL_NUM_THREADS is set, and store the result in the block cache, so that
+ * subsequent IReadBlock() calls are not needed for them.
+ */
+void GDALGPKGMBTilesLikePseudoDataset::PrefetchTiles(int nXOff, int nYOff,
+                                                     int nXSize, int nYSize)
+{
+    // The shifted mode composites several tiles into each block, and in
+    // update mode, tiles might have to be read back from the temporary
+    // partial tiles database: leave those cases to IReadBlock().
+    if (m_pabyCachedTiles == nullptr || IGetUpdate() ||
+        m_nShiftXPixelsMod != 0 || m_nShiftYPixelsMod != 0 ||
+        nXSize <= 0 || nYSize <= 0)
+    {
+        return;
+    }
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = std::max(
+        1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads)));
+    if (nThreads <= 1)
+        return;
+
+    GDALRasterBand *poBand1 = IGetRasterBand(1);
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand1->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBlockXStart = nXOff / nBlockXSize;
+    const int nBlockXEnd = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBlockYStart = nYOff / nBlockYSize;
+    const int nBlockYEnd = (nYOff + nYSize - 1) / nBlockYSize;
+    if (nBlockXStart == nBlockXEnd && nBlockYStart == nBlockYEnd)
+        return;
+
+    const int nBands = IGetRasterCount();
+
+    // Collect blocks for which at least one band is not cached
+    std::map<std::pair<int, int>, size_t> oMapTileToIdx;
+    for (int nBlockY = nBlockYStart; nBlockY <= nBlockYEnd; ++nBlockY)
+    {
+        for (int nBlockX = nBlockXStart; nBlockX <= nBlockXEnd; ++nBlockX)
+        {
+            bool bAllCached = true;
+            for (int iBand = 1; iBand <= nBands && bAllCached; ++iBand)
+            {
+                auto poBand = cpl::down_cast<GDALGPKGMBTilesLikeRasterBand *>(
+                    IGetRasterBand(iBand));
+                GDALRasterBlock *poBlock =
+                    poBand->AccessibleTryGetLockedBlockRef(nBlockX, nBlockY);
+                if (poBlock)
+                    poBlock->DropLock();
+                else
+                    bAllCached = false;
+            }
+            if (!bAllCached)
+            {
+                const size_t nIdx = oMapTileToIdx.size();
+                oMapTileToIdx[std::pair(nBlockY + m_nShiftYTiles,
+                                        nBlockX + m_nShiftXTiles)] = nIdx;
+            }
+        }
+    }
+    if (oMapTileToIdx.size() <= 1)
+        return;
+
+    // Do not prefetch more than what the block cache can reasonably hold
+    const size_t nBandBlockSize =
+        static_cast<size_t>(nBlockXSize) * nBlockYSize * m_nDTSize;
+    const int nTileBands = m_eDT == GDT_Byte ? 4 : 1;
+    const size_t nTileBufferSize = nTileBands * nBandBlockSize;
+    if (static_cast<GIntBig>(oMapTileToIdx.size() * nTileBufferSize) >
+        GDALGetCacheMax64() / 4)
+    {
+        return;
+    }
+
+    struct TileToDecode
+    {
+        int nRow = 0;
+        int nCol = 0;
+        GIntBig nTileId = 0;
+        double dfTileOffset = 0.0;
+        double dfTileScale = 1.0;
+        bool bHasData = false;
+        std::vector<GByte> abyRawData{};
+    };
+
+    std::vector<TileToDecode> asTiles(oMapTileToIdx.size());
+    std::vector<GByte> abyTilesData;
+    try
+    {
+        abyTilesData.resize(asTiles.size() * nTileBufferSize);
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    for (const auto &[oRowCol, nIdx] : oMapTileToIdx)
+    {
+        asTiles[nIdx].nRow = oRowCol.first;
+        asTiles[nIdx].nCol = oRowCol.second;
+    }
+
+    const int nRowMin = nBlockYStart + m_nShiftYTiles;
+    const int nRowMax = nBlockYEnd + m_nShiftYTiles;
+    int nDBRowMin = GetRowFromIntoTopConvention(nRowMin);
+    int nDBRowMax = GetRowFromIntoTopConvention(nRowMax);
+    if (nDBRowMin > nDBRowMax)
+        std::swap(nDBRowMin, nDBRowMax);
+
+    char *pszSQL = sqlite3_mprintf(
+        "SELECT tile_column, tile_row, tile_data%s FROM \"%w\" "
+        "WHERE zoom_level = %d AND tile_column BETWEEN %d AND %d AND "
+        "tile_row BETWEEN %d AND %d%s",
+        m_eDT != GDT_Byte ? ", id" : "",  // MBTiles do not have an id
+        m_osRasterTable.c_str(), m_nZoomLevel, nBlockXStart + m_nShiftXTiles,
+        nBlockXEnd + m_nShiftXTiles, nDBRowMin, nDBRowMax,
+        !m_osWHERE.empty() ? CPLSPrintf(" AND (%s)", m_osWHERE.c_str()) : "");
+
+#ifdef DEBUG_VERBOSE
+    CPLDebug("GPKG", "%s", pszSQL);
+#endif
+
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    sqlite3_free(pszSQL);
+    if (rc != SQLITE_OK)
+        return;
+    while ((rc = sqlite3_step(hStmt)) == SQLITE_ROW)
+    {
+        if (sqlite3_column_type(hStmt, 2) != SQLITE_BLOB)
+            continue;
+        const int nCol = sqlite3_column_int(hStmt, 0);
+        const int nRow =
+            GetRowFromIntoTopConvention(sqlite3_column_int(hStmt, 1));
+        const auto oIter = oMapTileToIdx.find(std::pair(nRow, nCol));
+        if (oIter == oMapTileToIdx.end())
+            continue;
+        auto &sTile = asTiles[oIter->second];
+        const GByte *pabyRawData =
+            static_cast<const GByte *>(sqlite3_column_blob(hStmt, 2));
+        try
+        {
+            sTile.abyRawData.assign(pabyRawData,
+                                    pabyRawData +
+                                        sqlite3_column_bytes(hStmt, 2));
+        }
+        catch (const std::exception &)
+        {
+            sqlite3_finalize(hStmt);
+            return;
+        }
+        sTile.bHasData = true;
+        if (m_eDT != GDT_Byte)
+            sTile.nTileId = sqlite3_column_int64(hStmt, 3);
+    }
+    sqlite3_finalize(hStmt);
+    if (rc != SQLITE_DONE)
+    {
+        // Let IReadBlock() report the error
+        return;
+    }
+
+    // Run everything that might issue SQL requests or lazily initialize
+    // state in this thread, before decoding.
+    for (auto &sTile : asTiles)
+    {
+        if (sTile.bHasData)
+            GetTileOffsetAndScale(sTile.nTileId, sTile.dfTileOffset,
+                                  sTile.dfTileScale);
+    }
+    poBand1->GetColorTable();
+    poBand1->GetNoDataValue();
+
+    CPLErrorAccumulator oErrorAccumulator;
+    auto poPool = GDALGetGlobalThreadPool(nThreads);
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    for (size_t i = 0; i < asTiles.size(); ++i)
+    {
+        auto &sTile = asTiles[i];
+        GByte *pabyTileData = abyTilesData.data() + i * nTileBufferSize;
+        if (!sTile.bHasData)
+        {
+            FillEmptyTile(pabyTileData);
+            continue;
+        }
+        const auto DecodeTile =
+            [this, &sTile, pabyTileData, &oErrorAccumulator]()
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            ReadTile(sTile.abyRawData.data(), sTile.abyRawData.size(),
+                     pabyTileData, sTile.dfTileOffset, sTile.dfTileScale);
+        };
+        if (!poQueue || !poQueue->SubmitJob(DecodeTile))
+            DecodeTile();
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    // Store decoded tiles into the block cache, without overwriting blocks
+    // that have been modified.
+    for (size_t i = 0; i < asTiles.size(); ++i)
+    {
+        const auto &sTile = asTiles[i];
+        const GByte *pabyTileData = abyTilesData.data() + i * nTileBufferSize;
+        const int nBlockX = sTile.nCol - m_nShiftXTiles;
+        const int nBlockY = sTile.nRow - m_nShiftYTiles;
+        for (int iBand = 1; iBand <= nBands; ++iBand)
+        {
+            GDALRasterBlock *poBlock =
+                IGetRasterBand(iBand)->GetLockedBlockRef(nBlockX, nBlockY,
+                                                         TRUE);
+            if (poBlock == nullptr)
+                continue;
+            if (!poBlock->GetDirty())
+            {
+                memcpy(poBlock->GetDataRef(),
+                       pabyTileData + (iBand - 1) * nBandBlockSize,
+                       nBandBlockSize);
+            }
+            poBlock->DropLock();
+        }
+    }
+}
+
 /************************************************************************/
 /*                         IReadBlock()                                 */
 /************************************************************************/
@@ -2362,23 +2683,71 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                                     CPLSPrintf("%d", nBlockYSize));
             }
         }
+        GByte *pabyBlob = nullptr;
+        vsi_l_offset nBlobSize = 0;
+        bool bEncoded = false;
+        if (l_poDriver->GetEncodeImageCallback() &&
+            !CPLTestBool(
+                CPLGetConfigOption("GPKG_SIMUL_ENCODE_IMAGE_FAILURE", "NO")))
+        {
+            // Encode the tile directly in memory. If the encoder does not
+            // support this configuration, fall back to CreateCopy() below.
+            const int nMEMBands = poMEMDS->GetRasterCount();
+            std::vector<const void *> apBandData;
+            for (int i = 1; i <= nMEMBands; i++)
+            {
+                apBandData.push_back(
+                    cpl::down_cast<MEMRasterBand *>(
+                        poMEMDS->GetRasterBand(i))
+                        ->GetData());
+            }
+            std::vector<GByte> abyEncoded;
+            {
+                CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+                bEncoded = l_poDriver->EncodeImage(
+                    nBlockXSize, nBlockYSize, nMEMBands, eTileDT,
+                    apBandData.data(),
+                    poMEMDS->GetRasterBand(1)->GetColorTable(),
+                    papszDriverOptions, abyEncoded);
+            }
+            if (bEncoded)
+            {
+                pabyBlob = static_cast<GByte *>(
+                    VSI_MALLOC_VERBOSE(abyEncoded.size()));
+                if (pabyBlob)
+                {
+                    memcpy(pabyBlob, abyEncoded.data(), abyEncoded.size());
+                    nBlobSize = abyEncoded.size();
+                }
+            }
+            else
+            {
+                CPLDebug("GPKG",
+                         "EncodeImage() failed for %s tile. "
+                         "Falling back to CreateCopy()",
+                         pszDriverName);
+            }
+        }
+        if (!bEncoded)
+        {
 #ifdef DEBUG
-        VSIStatBufL sStat;
-        CPLAssert(VSIStatL(osMemFileName, &sStat) != 0);
+            VSIStatBufL sStat;
+            CPLAssert(VSIStatL(osMemFileName, &sStat) != 0);
 #endif
-        GDALDataset *poOutDS =
-            l_poDriver->CreateCopy(osMemFileName, poMEMDS, FALSE,
-                                   papszDriverOptions, nullptr, nullptr);
+            GDALDataset *poOutDS =
+                l_poDriver->CreateCopy(osMemFileName, poMEMDS, FALSE,
+                                       papszDriverOptions, nullptr, nullptr);
+            if (poOutDS)
+            {
+                GDALClose(poOutDS);
+                pabyBlob = VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
+            }
+        }
         CSLDestroy(papszDriverOptions);
         CPLFree(pTempTileBuffer);
 
-        if (poOutDS)
+        if (pabyBlob)
         {
-            GDALClose(poOutDS);
-            vsi_l_offset nBlobSize = 0;
-            GByte *pabyBlob =
-                VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
-
             /* Create or commit and recreate transaction */
             GDALGPKGMBTilesLikePseudoDataset *poMainDS =
                 m_poParentDS ? m_poParentDS : this;
@@ -2694,14 +3063,9 @@ GDALGPKGMBTilesLikePseudoDataset::FlushRemainingShiftedTiles(bool bPartialFlush)
                             (m_eDT == GDT_Byte)
                                 ? 0
                                 : sqlite3_column_int64(hNewStmt, 1);
-                        GByte *pabyRawData =
-                            const_cast<GByte *>(static_cast<const GByte *>(
-                                sqlite3_column_blob(hNewStmt, 0)));
-                        const CPLString osMemFileName(
-                            VSIMemGenerateHiddenFilename("gpkg_read_tile"));
-                        VSILFILE *fp = VSIFileFromMemBuffer(
-                            osMemFileName.c_str(), pabyRawData, nBytes, FALSE);
-                        VSIFCloseL(fp);
+                        const GByte *pabyRawData =
+                            static_cast<const GByte *>(
+                                sqlite3_column_blob(hNewStmt, 0));
 
                         double dfTileOffset = 0.0;
                         double dfTileScale = 1.0;
@@ -2710,9 +3074,8 @@ GDALGPKGMBTilesLikePseudoDataset::FlushRemainingShiftedTiles(bool bPartialFlush)
                         const int nTileBands = m_eDT == GDT_Byte ? 4 : 1;
                         GByte *pabyTemp =
                             m_pabyCachedTiles + nTileBands * nBandBlockSize;
-                        ReadTile(osMemFileName, pabyTemp, dfTileOffset,
+                        ReadTile(pabyRawData, nBytes, pabyTemp, dfTileOffset,
                                  dfTileScale);
-                        VSIUnlink(osMemFileName);
 
                         int iYQuadrantMax = (m_nShiftYPixelsMod) ? 1 : 0;
                         int iXQuadrantMax = (m_nShiftXPixelsMod) ? 1 : 0;
@@ -114,13 +114,15 @@ class GDALGPKGMBTilesLikePseudoDataset
     void SetDataType(GDALDataType eDT);
     void SetGlobalOffsetScale(double dfOffset, double dfScale);
 
-    CPLErr ReadTile(const CPLString &osMemFileName, GByte *pabyTileData,
-                    double dfTileOffset, double dfTileScale,
-                    bool *pbIsLossyFormat = nullptr);
+    CPLErr ReadTile(const GByte *pabyBlob, size_t nBlobSize,
+                    GByte *pabyTileData, double dfTileOffset,
+                    double dfTileScale, bool *pbIsLossyFormat = nullptr);
     GByte *ReadTile(int nRow, int nCol);
     GByte *ReadTile(int nRow, int nCol, GByte *pabyData,
                     bool *pbIsLossyFormat = nullptr);
 
+    void PrefetchTiles(int nXOff, int nYOff, int nXSize, int nYSize);
+
     CPLErr WriteTile();
 
     CPLErr FlushTiles();
@@ -165,6 +167,12 @@ class GDALGPKGMBTilesLikeRasterBand : public GDALPamRasterBand
                                void *pData) override;
     virtual CPLErr FlushCache(bool bAtClosing) override;
 
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
     int IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize, int nYSize,
                                int nMaskFlagStop, double *pdfDataPct) override;
 
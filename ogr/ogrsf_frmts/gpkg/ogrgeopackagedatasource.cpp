@@ -1082,6 +1082,9 @@ CPLErr GDALGeoPackageDataset::IRasterIO(
     GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
 
 {
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize)
+        PrefetchTiles(nXOff, nYOff, nXSize, nYSize);
+
     CPLErr eErr = OGRSQLiteBaseDataSource::IRasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
@@ -106,6 +106,11 @@ class FileGDBTrivialIterator final : public FileGDBIterator
         return poParentIter->GetNextRowSortedByValue();
     }
 
+    virtual const OGRField *GetLastValueSortedByValue(int &eOutType) override
+    {
+        return poParentIter->GetLastValueSortedByValue(eOutType);
+    }
+
     virtual const OGRField *GetMinValue(int &eOutType) override
     {
         return poParentIter->GetMinValue(eOutType);
@@ -336,6 +341,14 @@ class FileGDBIndexIterator final : public FileGDBIndexIteratorBase
     char szMax[MAX_UTF8_LEN_STR + 1];
     const OGRField *GetMinMaxValue(OGRField *psField, int &eOutType,
                                    int bIsMin);
+    const OGRField *GetValueFromPage(const GByte *pabyPage, int iFeature,
+                                     OGRField *psField, int &eOutType);
+
+    //! Index in abyPageFeature of the value of the row returned by the last
+    //! GetNextRow() call, or -1.
+    int m_iLastFeatureInPage = -1;
+    OGRField m_sLastValue{};
+    char m_szLastValue[MAX_UTF8_LEN_STR + 1];
 
     virtual bool FindPages(int iLevel, uint64_t nPage) override;
     int64_t GetNextRow();
@@ -368,6 +381,8 @@ class FileGDBIndexIterator final : public FileGDBIndexIteratorBase
         return GetNextRow();
     }
 
+    virtual const OGRField *GetLastValueSortedByValue(int &eOutType) override;
+
     virtual const OGRField *GetMinValue(int &eOutType) override;
     virtual const OGRField *GetMaxValue(int &eOutType) override;
     virtual bool GetMinMaxSumCount(double &dfMin, double &dfMax, double &dfSum,
@@ -406,6 +421,17 @@ int64_t FileGDBIterator::GetNextRowSortedByValue()
     return -1;
 }
 
+/************************************************************************/
+/*                      GetLastValueSortedByValue()                     */
+/************************************************************************/
+
+const OGRField *FileGDBIterator::GetLastValueSortedByValue(int &eOutType)
+{
+    PrintError();
+    eOutType = -1;
+    return nullptr;
+}
+
 /************************************************************************/
 /*                        GetMinMaxSumCount()                           */
 /************************************************************************/
@@ -929,6 +955,7 @@ FileGDBIndexIterator::FileGDBIndexIterator(FileGDBTable *poParentIn,
     memset(&sMax, 0, sizeof(sMax));
     memset(&szMin, 0, sizeof(szMin));
     memset(&szMax, 0, sizeof(szMax));
+    memset(&m_szLastValue, 0, sizeof(m_szLastValue));
 }
 
 /************************************************************************/
@@ -1611,6 +1638,7 @@ void FileGDBIndexIterator::Reset()
 {
     FileGDBIndexIteratorBase::Reset();
     iSorted = 0;
+    m_iLastFeatureInPage = -1;
     bEOF = bEOF || bEvaluateToFALSE;
 }
 
@@ -1920,6 +1948,7 @@ int64_t FileGDBIndexIterator::GetNextRow()
 
         if (bMatch)
         {
+            m_iLastFeatureInPage = iCurFeatureInPage;
             const GUInt64 nFID =
                 m_nVersion == 1
                     ? GetUInt32(abyPageFeature + m_nLeafPageHeaderSize,
@@ -2097,7 +2126,21 @@ const OGRField *FileGDBIndexIterator::GetMinMaxValue(OGRField *psField,
     GUInt32 nFeatures = GetUInt32(l_abyPage + m_nObjectIDSize, 0);
     returnErrorIf(nFeatures < 1 || nFeatures > nMaxPerPages);
 
-    int iFeature = (bIsMin) ? 0 : nFeatures - 1;
+    const int iFeature = (bIsMin) ? 0 : nFeatures - 1;
+    return GetValueFromPage(l_abyPage, iFeature, psField, eOutType);
+}
+
+/************************************************************************/
+/*                          GetValueFromPage()                          */
+/************************************************************************/
+
+const OGRField *FileGDBIndexIterator::GetValueFromPage(const GByte *l_abyPage,
+                                                       int iFeature,
+                                                       OGRField *psField,
+                                                       int &eOutType)
+{
+    const OGRField *errorRetValue = nullptr;
+    eOutType = -1;
 
     switch (eFieldType)
     {
@@ -2217,6 +2260,22 @@ const OGRField *FileGDBIndexIterator::GetMinMaxValue(OGRField *psField,
     return nullptr;
 }
 
+/************************************************************************/
+/*                      GetLastValueSortedByValue()                     */
+/************************************************************************/
+
+const OGRField *FileGDBIndexIterator::GetLastValueSortedByValue(int &eOutType)
+{
+    eOutType = -1;
+    if (m_iLastFeatureInPage < 0 || m_iLastFeatureInPage >= nFeaturesInPage)
+        return nullptr;
+    if (eFieldType == FGFT_STRING || eFieldType == FGFT_GUID ||
+        eFieldType == FGFT_GLOBALID)
+        m_sLastValue.String = m_szLastValue;
+    return GetValueFromPage(abyPageFeature, m_iLastFeatureInPage,
+                            &m_sLastValue, eOutType);
+}
+
 /************************************************************************/
 /*                            GetMinValue()                             */
 /************************************************************************/
@@ -800,6 +800,12 @@ class FileGDBIterator
     /* Only available on a BuildIsNotNull() or Build() iterator */
     virtual int64_t GetNextRowSortedByValue();
 
+    /* Only available on a BuildIsNotNull() or Build() iterator. Returns the
+     * indexed value of the row returned by the last call to
+     * GetNextRowSortedByValue(). Note that string values are stored
+     * truncated, and possibly lower-cased, in indexes */
+    virtual const OGRField *GetLastValueSortedByValue(int &eOutOGRFieldType);
+
     static FileGDBIterator *Build(FileGDBTable *poParent, int nFieldIdx,
                                   int bAscending, FileGDBSQLOp op,
                                   OGRFieldType eOGRFieldType,
@@ -225,6 +225,7 @@ class OGROpenFileGDBLayer final : public OGRLayer
     bool HasIndexForField(const char *pszFieldName);
     FileGDBIterator *BuildIndex(const char *pszFieldName, int bAscending,
                                 int op, swq_expr_node *poValue);
+    FileGDBIterator *BuildSpatialIndexIterator(const OGREnvelope &sEnvelope);
 
     SPIState GetSpatialIndexState() const
     {
@@ -492,6 +493,9 @@ class OGROpenFileGDBDataSource final : public GDALDataset
 
     static bool IsPrivateLayerName(const CPLString &osName);
 
+    OGRLayer *ExecuteIndexedAggregateSQL(swq_select &oSelect);
+    OGRLayer *ExecuteIndexedDistinctSQL(swq_select &oSelect);
+
     bool CreateGDBSystemCatalog();
     bool CreateGDBDBTune();
     bool CreateGDBSpatialRefs();
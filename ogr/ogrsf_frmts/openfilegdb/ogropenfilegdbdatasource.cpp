@@ -1331,6 +1331,235 @@ OGRFeature *OGROpenFileGDBSingleFeatureLayer::GetNextFeature()
     return poFeature;
 }
 
+/***********************************************************************/
+/*                      OGROpenFileGDBValueBound                       */
+/***********************************************************************/
+
+/** Comparison of the value of an indexed numeric field with a numeric
+ * constant, evaluated on the values read from the index. */
+struct OGROpenFileGDBValueBound
+{
+    int nOp = SWQ_EQ;
+
+    //! Whether, given the iteration order of the index, no row following a
+    //! row that does not match the bound can match it.
+    bool bStopIteration = false;
+
+    bool bIsInteger = false;
+    GIntBig nValue = 0;
+    double dfValue = 0;
+
+    bool Evaluate(const OGRField *psValue, int eValueType) const;
+};
+
+/***********************************************************************/
+/*                             Evaluate()                              */
+/***********************************************************************/
+
+bool OGROpenFileGDBValueBound::Evaluate(const OGRField *psValue,
+                                        int eValueType) const
+{
+    int nComp = 0;
+    if ((eValueType == OFTInteger || eValueType == OFTInteger64) && bIsInteger)
+    {
+        const GIntBig nVal =
+            eValueType == OFTInteger ? psValue->Integer : psValue->Integer64;
+        nComp = nVal < nValue ? -1 : nVal > nValue ? 1 : 0;
+    }
+    else
+    {
+        const double dfVal =
+            eValueType == OFTInteger     ? psValue->Integer
+            : eValueType == OFTInteger64 ? static_cast<double>(
+                                               psValue->Integer64)
+                                         : psValue->Real;
+        const double dfRef =
+            bIsInteger ? static_cast<double>(nValue) : dfValue;
+        if (std::isnan(dfVal))
+            return false;
+        nComp = dfVal < dfRef ? -1 : dfVal > dfRef ? 1 : 0;
+    }
+    switch (nOp)
+    {
+        case SWQ_LT:
+            return nComp < 0;
+        case SWQ_LE:
+            return nComp <= 0;
+        case SWQ_EQ:
+            return nComp == 0;
+        case SWQ_GE:
+            return nComp >= 0;
+        case SWQ_GT:
+            return nComp > 0;
+        default:
+            break;
+    }
+    return false;
+}
+
+/***********************************************************************/
+/*                      OGROpenFileGDBIsColumnRef()                    */
+/***********************************************************************/
+
+static bool OGROpenFileGDBIsColumnRef(const swq_expr_node *poNode,
+                                      const char *pszFieldName)
+{
+    return (poNode->eNodeType == SNT_COLUMN ||
+            poNode->eNodeType == SNT_CONSTANT) &&
+           poNode->field_type == SWQ_STRING &&
+           EQUAL(poNode->string_value, pszFieldName);
+}
+
+/***********************************************************************/
+/*                    OGROpenFileGDBIsNumericConstant()                */
+/***********************************************************************/
+
+static bool OGROpenFileGDBIsNumericConstant(const swq_expr_node *poNode)
+{
+    return poNode->eNodeType == SNT_CONSTANT && !poNode->is_null &&
+           (poNode->field_type == SWQ_INTEGER ||
+            poNode->field_type == SWQ_INTEGER64 ||
+            poNode->field_type == SWQ_FLOAT);
+}
+
+/***********************************************************************/
+/*                      OGROpenFileGDBCollectBounds()                  */
+/***********************************************************************/
+
+typedef std::vector<std::pair<int, swq_expr_node *>> OGROpenFileGDBBounds;
+
+/** Collect the (operator, constant) pairs of a WHERE expression that is
+ * made only of comparisons of pszFieldName with constants, BETWEEN, and
+ * AND of them. Returns false if the expression has another form. */
+static bool OGROpenFileGDBCollectBounds(swq_expr_node *poNode,
+                                        const char *pszFieldName,
+                                        OGROpenFileGDBBounds &aoBounds)
+{
+    if (poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    if (poNode->nOperation == SWQ_AND)
+    {
+        for (int i = 0; i < poNode->nSubExprCount; ++i)
+        {
+            if (!OGROpenFileGDBCollectBounds(poNode->papoSubExpr[i],
+                                             pszFieldName, aoBounds))
+                return false;
+        }
+        return poNode->nSubExprCount > 0;
+    }
+
+    if (poNode->nOperation == SWQ_BETWEEN && poNode->nSubExprCount == 3 &&
+        OGROpenFileGDBIsColumnRef(poNode->papoSubExpr[0], pszFieldName) &&
+        poNode->papoSubExpr[1]->eNodeType == SNT_CONSTANT &&
+        poNode->papoSubExpr[2]->eNodeType == SNT_CONSTANT)
+    {
+        aoBounds.emplace_back(SWQ_GE, poNode->papoSubExpr[1]);
+        aoBounds.emplace_back(SWQ_LE, poNode->papoSubExpr[2]);
+        return true;
+    }
+
+    if (OGROpenFileGDBIsComparisonOp(poNode->nOperation) &&
+        poNode->nOperation != SWQ_NE && poNode->nSubExprCount == 2)
+    {
+        if (OGROpenFileGDBIsColumnRef(poNode->papoSubExpr[0], pszFieldName) &&
+            poNode->papoSubExpr[1]->eNodeType == SNT_CONSTANT)
+        {
+            aoBounds.emplace_back(poNode->nOperation, poNode->papoSubExpr[1]);
+            return true;
+        }
+        // constant <op> column
+        if (poNode->papoSubExpr[0]->eNodeType == SNT_CONSTANT &&
+            poNode->papoSubExpr[1]->eNodeType == SNT_COLUMN &&
+            OGROpenFileGDBIsColumnRef(poNode->papoSubExpr[1], pszFieldName))
+        {
+            const int nOp = poNode->nOperation == SWQ_LT   ? SWQ_GT
+                            : poNode->nOperation == SWQ_LE ? SWQ_GE
+                            : poNode->nOperation == SWQ_GT ? SWQ_LT
+                            : poNode->nOperation == SWQ_GE ? SWQ_LE
+                                                           : SWQ_EQ;
+            aoBounds.emplace_back(nOp, poNode->papoSubExpr[0]);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/***********************************************************************/
+/*                      OGROpenFileGDBPlanIndexScan()                  */
+/***********************************************************************/
+
+/** Select among aoBounds the one that is evaluated by the index iterator,
+ * and convert the other ones into bounds evaluated on the values read from
+ * the index. This is only possible on numeric fields when there are several
+ * bounds. */
+static bool
+OGROpenFileGDBPlanIndexScan(const OGRFieldDefn *poFieldDefn, bool bAscending,
+                            const OGROpenFileGDBBounds &aoBounds,
+                            int &nIndexOp, swq_expr_node *&poIndexValue,
+                            std::vector<OGROpenFileGDBValueBound> &aoResidual)
+{
+    nIndexOp = -1;
+    poIndexValue = nullptr;
+    aoResidual.clear();
+    if (aoBounds.empty())
+        return true;
+
+    if (aoBounds.size() > 1)
+    {
+        const auto eType = poFieldDefn->GetType();
+        if (eType != OFTInteger && eType != OFTInteger64 && eType != OFTReal)
+            return false;
+        for (const auto &oBound : aoBounds)
+        {
+            if (!OGROpenFileGDBIsNumericConstant(oBound.second))
+                return false;
+        }
+    }
+
+    // Prefer an equality, and then a bound that lets the index iterator
+    // skip directly to the first matching value.
+    size_t iIndexBound = 0;
+    for (int iPass = 0; iPass < 2; ++iPass)
+    {
+        size_t i = 0;
+        for (; i < aoBounds.size(); ++i)
+        {
+            const int nOp = aoBounds[i].first;
+            if (iPass == 0 ? nOp == SWQ_EQ
+                : bAscending ? (nOp == SWQ_GT || nOp == SWQ_GE)
+                             : (nOp == SWQ_LT || nOp == SWQ_LE))
+                break;
+        }
+        if (i < aoBounds.size())
+        {
+            iIndexBound = i;
+            break;
+        }
+    }
+
+    nIndexOp = aoBounds[iIndexBound].first;
+    poIndexValue = aoBounds[iIndexBound].second;
+    for (size_t i = 0; i < aoBounds.size(); ++i)
+    {
+        if (i == iIndexBound)
+            continue;
+        OGROpenFileGDBValueBound sBound;
+        sBound.nOp = aoBounds[i].first;
+        sBound.bStopIteration =
+            sBound.nOp == SWQ_EQ ||
+            (bAscending ? (sBound.nOp == SWQ_LT || sBound.nOp == SWQ_LE)
+                        : (sBound.nOp == SWQ_GT || sBound.nOp == SWQ_GE));
+        const swq_expr_node *poValue = aoBounds[i].second;
+        sBound.bIsInteger = poValue->field_type != SWQ_FLOAT;
+        sBound.nValue = poValue->int_value;
+        sBound.dfValue = poValue->float_value;
+        aoResidual.push_back(sBound);
+    }
+    return true;
+}
+
 /***********************************************************************/
 /*                     OGROpenFileGDBSimpleSQLLayer                    */
 /***********************************************************************/
@@ -1344,6 +1573,27 @@ class OGROpenFileGDBSimpleSQLLayer final : public OGRLayer
     GIntBig m_nLimit;
     GIntBig m_nSkipped = 0;
     GIntBig m_nIterated = 0;
+    bool m_bEOF = false;
+
+    //! Bounds evaluated on the values of the index, in addition to the
+    //! condition evaluated by poIter.
+    std::vector<OGROpenFileGDBValueBound> m_aoResidualBounds{};
+
+    //! Spatial filter passed to ExecuteSQL(), that applies before OFFSET and
+    //! LIMIT.
+    std::unique_ptr<OGRGeometry> m_poSrcFilterGeom{};
+    OGREnvelope m_sSrcFilterEnvelope{};
+    std::unique_ptr<FileGDBIterator> m_poSpatialIndexIter{};
+    bool m_bSpatialCandidatesBuilt = false;
+    //! Rows returned by m_poSpatialIndexIter, sorted.
+    std::vector<int64_t> m_anSpatialCandidates{};
+
+    bool HasSourceFilters() const
+    {
+        return !m_aoResidualBounds.empty() || m_poSrcFilterGeom != nullptr;
+    }
+
+    OGRFeature *TranslateFeature(OGRFeature *poSrcFeature);
 
     CPL_DISALLOW_COPY_ASSIGN(OGROpenFileGDBSimpleSQLLayer)
 
@@ -1353,6 +1603,14 @@ class OGROpenFileGDBSimpleSQLLayer final : public OGRLayer
                                  GIntBig nOffset, GIntBig nLimit);
     virtual ~OGROpenFileGDBSimpleSQLLayer();
 
+    void SetResidualBounds(std::vector<OGROpenFileGDBValueBound> &&aoBounds)
+    {
+        m_aoResidualBounds = std::move(aoBounds);
+    }
+
+    void SetSourceSpatialFilter(const OGRGeometry *poGeom,
+                                FileGDBIterator *poSpatialIndexIter);
+
     virtual void ResetReading() override;
     virtual OGRFeature *GetNextFeature() override;
     virtual OGRFeature *GetFeature(GIntBig nFeatureId) override;
@@ -1457,6 +1715,23 @@ void OGROpenFileGDBSimpleSQLLayer::ResetReading()
     poIter->Reset();
     m_nSkipped = 0;
     m_nIterated = 0;
+    m_bEOF = false;
+}
+
+/***********************************************************************/
+/*                      SetSourceSpatialFilter()                       */
+/***********************************************************************/
+
+/** Set the spatial filter passed to ExecuteSQL(), and an optional iterator
+ * over the spatial index of the base layer, whose ownership is taken. */
+void OGROpenFileGDBSimpleSQLLayer::SetSourceSpatialFilter(
+    const OGRGeometry *poGeom, FileGDBIterator *poSpatialIndexIter)
+{
+    m_poSrcFilterGeom.reset(poGeom->clone());
+    m_poSrcFilterGeom->getEnvelope(&m_sSrcFilterEnvelope);
+    m_poSpatialIndexIter.reset(poSpatialIndexIter);
+    m_bSpatialCandidatesBuilt = false;
+    m_anSpatialCandidates.clear();
 }
 
 /***********************************************************************/
@@ -1465,7 +1740,16 @@ void OGROpenFileGDBSimpleSQLLayer::ResetReading()
 
 OGRFeature *OGROpenFileGDBSimpleSQLLayer::GetFeature(GIntBig nFeatureId)
 {
-    OGRFeature *poSrcFeature = poBaseLayer->GetFeature(nFeatureId);
+    return TranslateFeature(poBaseLayer->GetFeature(nFeatureId));
+}
+
+/***********************************************************************/
+/*                         TranslateFeature()                          */
+/***********************************************************************/
+
+OGRFeature *
+OGROpenFileGDBSimpleSQLLayer::TranslateFeature(OGRFeature *poSrcFeature)
+{
     if (poSrcFeature == nullptr)
         return nullptr;
 
@@ -1487,7 +1771,20 @@ OGRFeature *OGROpenFileGDBSimpleSQLLayer::GetFeature(GIntBig nFeatureId)
 
 OGRFeature *OGROpenFileGDBSimpleSQLLayer::GetNextFeature()
 {
-    while (true)
+    if (m_poSpatialIndexIter && !m_bSpatialCandidatesBuilt)
+    {
+        m_bSpatialCandidatesBuilt = true;
+        m_poSpatialIndexIter->Reset();
+        while (true)
+        {
+            const int64_t nRow = m_poSpatialIndexIter->GetNextRowSortedByFID();
+            if (nRow < 0)
+                break;
+            m_anSpatialCandidates.push_back(nRow);
+        }
+    }
+
+    while (!m_bEOF)
     {
         if (m_nLimit >= 0 && m_nIterated == m_nLimit)
             return nullptr;
@@ -1495,17 +1792,63 @@ OGRFeature *OGROpenFileGDBSimpleSQLLayer::GetNextFeature()
         const int64_t nRow = poIter->GetNextRowSortedByValue();
         if (nRow < 0)
             return nullptr;
-        OGRFeature *poFeature = GetFeature(nRow + 1);
-        if (poFeature == nullptr)
+
+        if (!m_aoResidualBounds.empty())
+        {
+            int eValueType = -1;
+            const OGRField *psValue =
+                poIter->GetLastValueSortedByValue(eValueType);
+            if (psValue == nullptr)
+                return nullptr;
+            bool bMatch = true;
+            for (const auto &sBound : m_aoResidualBounds)
+            {
+                if (!sBound.Evaluate(psValue, eValueType))
+                {
+                    bMatch = false;
+                    if (sBound.bStopIteration)
+                        m_bEOF = true;
+                    break;
+                }
+            }
+            if (!bMatch)
+                continue;
+        }
+
+        if (m_poSpatialIndexIter &&
+            !std::binary_search(m_anSpatialCandidates.begin(),
+                                m_anSpatialCandidates.end(), nRow))
+        {
+            continue;
+        }
+
+        std::unique_ptr<OGRFeature> poSrcFeature(
+            poBaseLayer->GetFeature(nRow + 1));
+        if (poSrcFeature == nullptr)
             return nullptr;
+
+        if (m_poSrcFilterGeom)
+        {
+            const OGRGeometry *poGeom = poSrcFeature->GetGeometryRef();
+            if (poGeom == nullptr || poGeom->IsEmpty())
+                continue;
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            if (!sEnvelope.Intersects(m_sSrcFilterEnvelope) ||
+                !m_poSrcFilterGeom->Intersects(poGeom))
+            {
+                continue;
+            }
+        }
+
         if (m_nOffset >= 0 && m_nSkipped < m_nOffset)
         {
-            delete poFeature;
             m_nSkipped++;
             continue;
         }
         m_nIterated++;
 
+        OGRFeature *poFeature = TranslateFeature(poSrcFeature.release());
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeometryRef())) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
@@ -1515,6 +1858,7 @@ OGRFeature *OGROpenFileGDBSimpleSQLLayer::GetNextFeature()
 
         delete poFeature;
     }
+    return nullptr;
 }
 
 /***********************************************************************/
@@ -1525,7 +1869,8 @@ GIntBig OGROpenFileGDBSimpleSQLLayer::GetFeatureCount(int bForce)
 {
 
     /* No filter */
-    if (m_poFilterGeom == nullptr && m_poAttrQuery == nullptr)
+    if (m_poFilterGeom == nullptr && m_poAttrQuery == nullptr &&
+        !HasSourceFilters())
     {
         GIntBig nRowCount = poIter->GetRowCount();
         if (m_nOffset > 0)
@@ -1552,7 +1897,8 @@ int OGROpenFileGDBSimpleSQLLayer::TestCapability(const char *pszCap)
 
     if (EQUAL(pszCap, OLCFastFeatureCount))
     {
-        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr;
+        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr &&
+               !HasSourceFilters();
     }
     else if (EQUAL(pszCap, OLCFastGetExtent))
     {
@@ -1570,6 +1916,328 @@ int OGROpenFileGDBSimpleSQLLayer::TestCapability(const char *pszCap)
     return FALSE;
 }
 
+/***********************************************************************/
+/*                     OGROpenFileGDBGetColumnName()                   */
+/***********************************************************************/
+
+/** Return the name of the first column referenced in an expression. */
+static const char *OGROpenFileGDBGetColumnName(const swq_expr_node *poNode)
+{
+    if (poNode->eNodeType == SNT_COLUMN)
+        return poNode->string_value;
+    if (poNode->eNodeType == SNT_OPERATION)
+    {
+        for (int i = 0; i < poNode->nSubExprCount; ++i)
+        {
+            const char *pszName =
+                OGROpenFileGDBGetColumnName(poNode->papoSubExpr[i]);
+            if (pszName)
+                return pszName;
+        }
+    }
+    return nullptr;
+}
+
+/***********************************************************************/
+/*                    OGROpenFileGDBGetValueAsDouble()                 */
+/***********************************************************************/
+
+static double OGROpenFileGDBGetValueAsDouble(const OGRField *psValue,
+                                             int eValueType)
+{
+    return eValueType == OFTInteger     ? psValue->Integer
+           : eValueType == OFTInteger64 ? static_cast<double>(
+                                              psValue->Integer64)
+                                        : psValue->Real;
+}
+
+/***********************************************************************/
+/*                     OGROpenFileGDBGetNextIndexValue()               */
+/***********************************************************************/
+
+/** Return the value of the next row of poIter matching the residual
+ * bounds, or nullptr when there is none. */
+static const OGRField *OGROpenFileGDBGetNextIndexValue(
+    FileGDBIterator *poIter,
+    const std::vector<OGROpenFileGDBValueBound> &aoResidualBounds,
+    int &eValueType)
+{
+    while (poIter->GetNextRowSortedByValue() >= 0)
+    {
+        const OGRField *psValue = poIter->GetLastValueSortedByValue(eValueType);
+        if (psValue == nullptr)
+            return nullptr;
+        bool bMatch = true;
+        for (const auto &sBound : aoResidualBounds)
+        {
+            if (!sBound.Evaluate(psValue, eValueType))
+            {
+                if (sBound.bStopIteration)
+                    return nullptr;
+                bMatch = false;
+                break;
+            }
+        }
+        if (bMatch)
+            return psValue;
+    }
+    return nullptr;
+}
+
+/***********************************************************************/
+/*                     ExecuteIndexedAggregateSQL()                    */
+/***********************************************************************/
+
+/** Evaluate a SELECT of MIN/MAX/SUM/AVG/COUNT of a numeric indexed field,
+ * whose WHERE clause is made only of comparisons of that field with
+ * constants, by only reading the index of the field.
+ * Returns nullptr if the statement does not have this form. */
+OGRLayer *OGROpenFileGDBDataSource::ExecuteIndexedAggregateSQL(
+    swq_select &oSelect)
+{
+    OGROpenFileGDBLayer *poLayer = reinterpret_cast<OGROpenFileGDBLayer *>(
+        GetLayerByName(oSelect.table_defs[0].table_name));
+    if (poLayer == nullptr)
+        return nullptr;
+
+    const char *pszFieldName = nullptr;
+    for (int i = 0; i < oSelect.result_columns(); i++)
+    {
+        const swq_col_def &sColDef = oSelect.column_defs[i];
+        const swq_col_func col_func = sColDef.col_func;
+        if (!(col_func == SWQCF_MIN || col_func == SWQCF_MAX ||
+              col_func == SWQCF_COUNT || col_func == SWQCF_AVG ||
+              col_func == SWQCF_SUM))
+            return nullptr;
+        if (sColDef.field_name == nullptr || sColDef.distinct_flag ||
+            sColDef.target_type != SWQ_OTHER || sColDef.field_alias != nullptr)
+            return nullptr;
+        if (strcmp(sColDef.field_name, "*") == 0)
+        {
+            if (col_func != SWQCF_COUNT)
+                return nullptr;
+        }
+        else if (pszFieldName == nullptr)
+            pszFieldName = sColDef.field_name;
+        else if (!EQUAL(pszFieldName, sColDef.field_name))
+            return nullptr;
+    }
+    // Only COUNT(*): use the field restricted by the WHERE clause
+    if (pszFieldName == nullptr)
+        pszFieldName = OGROpenFileGDBGetColumnName(oSelect.where_expr);
+    if (pszFieldName == nullptr || !poLayer->HasIndexForField(pszFieldName))
+        return nullptr;
+
+    OGRFeatureDefn *poLayerDefn = poLayer->GetLayerDefn();
+    const int nFieldIdx = poLayerDefn->GetFieldIndex(pszFieldName);
+    if (nFieldIdx < 0)
+        return nullptr;
+    const OGRFieldDefn *poFieldDefn = poLayerDefn->GetFieldDefn(nFieldIdx);
+    const OGRFieldType eFieldType = poFieldDefn->GetType();
+    if (eFieldType != OFTInteger && eFieldType != OFTInteger64 &&
+        eFieldType != OFTReal)
+        return nullptr;
+
+    OGROpenFileGDBBounds aoBounds;
+    int op = -1;
+    swq_expr_node *poValue = nullptr;
+    std::vector<OGROpenFileGDBValueBound> aoResidualBounds;
+    if (!OGROpenFileGDBCollectBounds(oSelect.where_expr, pszFieldName,
+                                     aoBounds) ||
+        !OGROpenFileGDBPlanIndexScan(poFieldDefn, /* bAscending = */ true,
+                                     aoBounds, op, poValue, aoResidualBounds))
+        return nullptr;
+
+    std::unique_ptr<FileGDBIterator> poIter(
+        poLayer->BuildIndex(pszFieldName, TRUE, op, poValue));
+    if (poIter == nullptr)
+        return nullptr;
+
+    // Values are iterated in ascending order
+    GIntBig nCount = 0;
+    double dfSum = 0;
+    OGRField sMin{};
+    OGRField sMax{};
+    int eValueType = -1;
+    while (const OGRField *psValue = OGROpenFileGDBGetNextIndexValue(
+               poIter.get(), aoResidualBounds, eValueType))
+    {
+        if (eValueType != eFieldType)
+            return nullptr;
+        if (nCount == 0)
+            sMin = *psValue;
+        sMax = *psValue;
+        dfSum += OGROpenFileGDBGetValueAsDouble(psValue, eValueType);
+        nCount++;
+    }
+
+    auto poMemLayer = std::make_unique<OGRMemLayer>("SELECT", nullptr, wkbNone);
+    for (int i = 0; i < oSelect.result_columns(); i++)
+    {
+        const swq_col_def &sColDef = oSelect.column_defs[i];
+        const swq_col_func col_func = sColDef.col_func;
+        OGRFieldDefn oFieldDefn(CPLSPrintf("%s_%s",
+                                           (col_func == SWQCF_MIN)   ? "MIN"
+                                           : (col_func == SWQCF_MAX) ? "MAX"
+                                           : (col_func == SWQCF_AVG) ? "AVG"
+                                           : (col_func == SWQCF_SUM) ? "SUM"
+                                                                     : "COUNT",
+                                           sColDef.field_name),
+                                OFTReal);
+        if (col_func == SWQCF_COUNT)
+        {
+            oFieldDefn.SetType(OFTInteger64);
+        }
+        else if (col_func == SWQCF_MIN || col_func == SWQCF_MAX)
+        {
+            oFieldDefn.SetType(eFieldType);
+            oFieldDefn.SetSubType(poFieldDefn->GetSubType());
+        }
+        poMemLayer->CreateField(&oFieldDefn);
+    }
+
+    auto poFeature = std::make_unique<OGRFeature>(poMemLayer->GetLayerDefn());
+    for (int i = 0; i < oSelect.result_columns(); i++)
+    {
+        const swq_col_func col_func = oSelect.column_defs[i].col_func;
+        if (col_func == SWQCF_COUNT)
+            poFeature->SetField(i, nCount);
+        else if (nCount == 0)
+            continue;
+        else if (col_func == SWQCF_MIN)
+            poFeature->SetField(i, &sMin);
+        else if (col_func == SWQCF_MAX)
+            poFeature->SetField(i, &sMax);
+        else if (col_func == SWQCF_SUM)
+            poFeature->SetField(i, dfSum);
+        else
+            poFeature->SetField(i, dfSum / static_cast<double>(nCount));
+    }
+    poFeature->SetFID(0);
+    CPL_IGNORE_RET_VAL(poMemLayer->CreateFeature(poFeature.get()));
+
+    CPLDebug("OpenFileGDB",
+             "Using optimized MIN/MAX/SUM/AVG/COUNT implementation with index "
+             "on %s",
+             pszFieldName);
+    bLastSQLUsedOptimizedImplementation = true;
+    return poMemLayer.release();
+}
+
+/***********************************************************************/
+/*                     ExecuteIndexedDistinctSQL()                     */
+/***********************************************************************/
+
+/** Evaluate a SELECT DISTINCT of a numeric indexed field, optionally
+ * ordered by that field, and whose WHERE clause is made only of
+ * comparisons of that field with constants, by only reading the index of
+ * the field.
+ * Returns nullptr if the statement does not have this form. */
+OGRLayer *
+OGROpenFileGDBDataSource::ExecuteIndexedDistinctSQL(swq_select &oSelect)
+{
+    const swq_col_def &sColDef = oSelect.column_defs[0];
+    if (sColDef.col_func != SWQCF_NONE || sColDef.field_name == nullptr ||
+        sColDef.target_type != SWQ_OTHER || sColDef.field_alias != nullptr ||
+        strcmp(sColDef.field_name, "*") == 0)
+        return nullptr;
+    const char *pszFieldName = sColDef.field_name;
+
+    bool bAscending = true;
+    if (oSelect.order_specs == 1)
+    {
+        if (!EQUAL(oSelect.order_defs[0].field_name, pszFieldName))
+            return nullptr;
+        bAscending = oSelect.order_defs[0].ascending_flag != 0;
+    }
+
+    OGROpenFileGDBLayer *poLayer = reinterpret_cast<OGROpenFileGDBLayer *>(
+        GetLayerByName(oSelect.table_defs[0].table_name));
+    if (poLayer == nullptr || !poLayer->HasIndexForField(pszFieldName))
+        return nullptr;
+
+    OGRFeatureDefn *poLayerDefn = poLayer->GetLayerDefn();
+    const int nFieldIdx = poLayerDefn->GetFieldIndex(pszFieldName);
+    if (nFieldIdx < 0)
+        return nullptr;
+    const OGRFieldDefn *poFieldDefn = poLayerDefn->GetFieldDefn(nFieldIdx);
+    const OGRFieldType eFieldType = poFieldDefn->GetType();
+    // Indexed strings may be truncated or lower-cased, and date/time values
+    // have a lower precision in the index, so restrict to numeric fields
+    if (eFieldType != OFTInteger && eFieldType != OFTInteger64 &&
+        eFieldType != OFTReal)
+        return nullptr;
+
+    OGROpenFileGDBBounds aoBounds;
+    int op = -1;
+    swq_expr_node *poValue = nullptr;
+    std::vector<OGROpenFileGDBValueBound> aoResidualBounds;
+    if ((oSelect.where_expr != nullptr &&
+         !OGROpenFileGDBCollectBounds(oSelect.where_expr, pszFieldName,
+                                      aoBounds)) ||
+        !OGROpenFileGDBPlanIndexScan(poFieldDefn, bAscending, aoBounds, op,
+                                     poValue, aoResidualBounds))
+        return nullptr;
+
+    std::unique_ptr<FileGDBIterator> poIter(
+        poLayer->BuildIndex(pszFieldName, bAscending, op, poValue));
+    if (poIter == nullptr)
+        return nullptr;
+
+    // NULL is a distinct value, that is not in the index
+    if (oSelect.where_expr == nullptr &&
+        poIter->GetRowCount() != poLayer->GetFeatureCount(FALSE))
+        return nullptr;
+
+    auto poMemLayer = std::make_unique<OGRMemLayer>("SELECT", nullptr, wkbNone);
+    OGRFieldDefn oFieldDefn(poFieldDefn->GetNameRef(), eFieldType);
+    oFieldDefn.SetSubType(poFieldDefn->GetSubType());
+    oFieldDefn.SetWidth(poFieldDefn->GetWidth());
+    oFieldDefn.SetPrecision(poFieldDefn->GetPrecision());
+    poMemLayer->CreateField(&oFieldDefn);
+
+    GIntBig nSkipped = 0;
+    GIntBig nCount = 0;
+    bool bHasPrevious = false;
+    OGRField sPrevious{};
+    int eValueType = -1;
+    while (oSelect.limit < 0 || nCount < oSelect.limit)
+    {
+        const OGRField *psValue = OGROpenFileGDBGetNextIndexValue(
+            poIter.get(), aoResidualBounds, eValueType);
+        if (psValue == nullptr)
+            break;
+        if (eValueType != eFieldType)
+            return nullptr;
+        if (bHasPrevious &&
+            (eValueType == OFTInteger ? psValue->Integer == sPrevious.Integer
+             : eValueType == OFTInteger64
+                 ? psValue->Integer64 == sPrevious.Integer64
+                 : psValue->Real == sPrevious.Real))
+        {
+            continue;
+        }
+        bHasPrevious = true;
+        sPrevious = *psValue;
+
+        if (oSelect.offset > 0 && nSkipped < oSelect.offset)
+        {
+            nSkipped++;
+            continue;
+        }
+
+        OGRFeature oFeature(poMemLayer->GetLayerDefn());
+        oFeature.SetField(0, psValue);
+        oFeature.SetFID(nCount);
+        CPL_IGNORE_RET_VAL(poMemLayer->CreateFeature(&oFeature));
+        nCount++;
+    }
+
+    CPLDebug("OpenFileGDB", "Using optimized DISTINCT implementation");
+    bLastSQLUsedOptimizedImplementation = true;
+    return poMemLayer.release();
+}
+
 /***********************************************************************/
 /*                            ExecuteSQL()                             */
 /***********************************************************************/
@@ -1835,7 +2503,7 @@ OGRLayer *OGROpenFileGDBDataSource::ExecuteSQL(const char *pszSQLCommand,
         if (oSelect.join_count == 0 && oSelect.poOtherSelect == nullptr &&
             oSelect.table_count == 1 && oSelect.order_specs == 0 &&
             oSelect.query_mode != SWQM_DISTINCT_LIST &&
-            oSelect.where_expr == nullptr)
+            oSelect.where_expr == nullptr && poSpatialFilter == nullptr)
         {
             OGROpenFileGDBLayer *poLayer =
                 reinterpret_cast<OGROpenFileGDBLayer *>(
@@ -1973,6 +2641,38 @@ OGRLayer *OGROpenFileGDBDataSource::ExecuteSQL(const char *pszSQLCommand,
             }
         }
 
+        /* --------------------------------------------------------------------
+         */
+        /*      MIN/MAX/SUM/AVG/COUNT with a WHERE restricting the range of */
+        /*      the aggregated field */
+        /* --------------------------------------------------------------------
+         */
+        if (oSelect.join_count == 0 && oSelect.poOtherSelect == nullptr &&
+            oSelect.table_count == 1 && oSelect.order_specs == 0 &&
+            oSelect.query_mode != SWQM_DISTINCT_LIST &&
+            oSelect.where_expr != nullptr && poSpatialFilter == nullptr &&
+            oSelect.result_columns() > 0)
+        {
+            OGRLayer *poRet = ExecuteIndexedAggregateSQL(oSelect);
+            if (poRet)
+                return poRet;
+        }
+
+        /* --------------------------------------------------------------------
+         */
+        /*      SELECT DISTINCT optimization */
+        /* --------------------------------------------------------------------
+         */
+        if (oSelect.join_count == 0 && oSelect.poOtherSelect == nullptr &&
+            oSelect.table_count == 1 && oSelect.order_specs <= 1 &&
+            oSelect.query_mode == SWQM_DISTINCT_LIST &&
+            poSpatialFilter == nullptr && oSelect.result_columns() == 1)
+        {
+            OGRLayer *poRet = ExecuteIndexedDistinctSQL(oSelect);
+            if (poRet)
+                return poRet;
+        }
+
         /* --------------------------------------------------------------------
          */
         /*      ORDER BY optimization */
@@ -1985,34 +2685,33 @@ OGRLayer *OGROpenFileGDBDataSource::ExecuteSQL(const char *pszSQLCommand,
             OGROpenFileGDBLayer *poLayer =
                 reinterpret_cast<OGROpenFileGDBLayer *>(
                     GetLayerByName(oSelect.table_defs[0].table_name));
+            const char *pszOrderField = oSelect.order_defs[0].field_name;
+            const bool bAscending = oSelect.order_defs[0].ascending_flag != 0;
             if (poLayer != nullptr &&
-                poLayer->HasIndexForField(oSelect.order_defs[0].field_name))
+                (poSpatialFilter == nullptr ||
+                 (poLayer->GetGeomType() != wkbNone &&
+                  !poSpatialFilter->IsEmpty())) &&
+                poLayer->HasIndexForField(pszOrderField))
             {
                 OGRErr eErr = OGRERR_NONE;
-                if (oSelect.where_expr != nullptr)
+
+                /* The where must be made of comparisons of the column */
+                /* that is used for ordering with constants */
+                const int nOrderFieldIdx =
+                    poLayer->GetLayerDefn()->GetFieldIndex(pszOrderField);
+                OGROpenFileGDBBounds aoBounds;
+                int op = -1;
+                swq_expr_node *poValue = nullptr;
+                std::vector<OGROpenFileGDBValueBound> aoResidualBounds;
+                if (nOrderFieldIdx < 0 ||
+                    (oSelect.where_expr != nullptr &&
+                     !OGROpenFileGDBCollectBounds(oSelect.where_expr,
+                                                  pszOrderField, aoBounds)) ||
+                    !OGROpenFileGDBPlanIndexScan(
+                        poLayer->GetLayerDefn()->GetFieldDefn(nOrderFieldIdx),
+                        bAscending, aoBounds, op, poValue, aoResidualBounds))
                 {
-                    /* The where must be a simple comparison on the column */
-                    /* that is used for ordering */
-                    if (oSelect.where_expr->eNodeType == SNT_OPERATION &&
-                        OGROpenFileGDBIsComparisonOp(
-                            oSelect.where_expr->nOperation) &&
-                        oSelect.where_expr->nOperation != SWQ_NE &&
-                        oSelect.where_expr->nSubExprCount == 2 &&
-                        (oSelect.where_expr->papoSubExpr[0]->eNodeType ==
-                             SNT_COLUMN ||
-                         oSelect.where_expr->papoSubExpr[0]->eNodeType ==
-                             SNT_CONSTANT) &&
-                        oSelect.where_expr->papoSubExpr[0]->field_type ==
-                            SWQ_STRING &&
-                        EQUAL(oSelect.where_expr->papoSubExpr[0]->string_value,
-                              oSelect.order_defs[0].field_name) &&
-                        oSelect.where_expr->papoSubExpr[1]->eNodeType ==
-                            SNT_CONSTANT)
-                    {
-                        /* ok */
-                    }
-                    else
-                        eErr = OGRERR_FAILURE;
+                    eErr = OGRERR_FAILURE;
                 }
                 if (eErr == OGRERR_NONE)
                 {
@@ -2038,17 +2737,8 @@ OGRLayer *OGROpenFileGDBDataSource::ExecuteSQL(const char *pszSQLCommand,
                 }
                 if (eErr == OGRERR_NONE)
                 {
-                    int op = -1;
-                    swq_expr_node *poValue = nullptr;
-                    if (oSelect.where_expr != nullptr)
-                    {
-                        op = oSelect.where_expr->nOperation;
-                        poValue = oSelect.where_expr->papoSubExpr[1];
-                    }
-
                     FileGDBIterator *poIter = poLayer->BuildIndex(
-                        oSelect.order_defs[0].field_name,
-                        oSelect.order_defs[0].ascending_flag, op, poValue);
+                        pszOrderField, bAscending, op, poValue);
 
                     /* Check that they are no NULL values */
                     if (oSelect.where_expr == nullptr && poIter != nullptr &&
@@ -2064,10 +2754,21 @@ OGRLayer *OGROpenFileGDBDataSource::ExecuteSQL(const char *pszSQLCommand,
                         CPLDebug("OpenFileGDB",
                                  "Using OGROpenFileGDBSimpleSQLLayer");
                         bLastSQLUsedOptimizedImplementation = true;
-                        return new OGROpenFileGDBSimpleSQLLayer(
+                        auto poSQLLayer = new OGROpenFileGDBSimpleSQLLayer(
                             poLayer, poIter, oSelect.result_columns(),
                             oSelect.column_defs.data(), oSelect.offset,
                             oSelect.limit);
+                        poSQLLayer->SetResidualBounds(
+                            std::move(aoResidualBounds));
+                        if (poSpatialFilter != nullptr)
+                        {
+                            OGREnvelope sEnvelope;
+                            poSpatialFilter->getEnvelope(&sEnvelope);
+                            poSQLLayer->SetSourceSpatialFilter(
+                                poSpatialFilter,
+                                poLayer->BuildSpatialIndexIterator(sEnvelope));
+                        }
+                        return poSQLLayer;
                     }
                 }
             }
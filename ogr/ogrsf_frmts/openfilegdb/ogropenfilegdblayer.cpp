@@ -2431,6 +2431,26 @@ FileGDBIterator *OGROpenFileGDBLayer::BuildIndex(const char *pszFieldName,
     return nullptr;
 }
 
+/***********************************************************************/
+/*                     BuildSpatialIndexIterator()                     */
+/***********************************************************************/
+
+/** Return an iterator over the rows whose geometry envelope might intersect
+ * the passed envelope, using the .spx spatial index, or nullptr if there is
+ * no usable spatial index. */
+FileGDBIterator *
+OGROpenFileGDBLayer::BuildSpatialIndexIterator(const OGREnvelope &sEnvelope)
+{
+    if (!BuildLayerDefinition())
+        return nullptr;
+    if (m_poLyrTable->CanUseIndices() && m_poLyrTable->HasSpatialIndex() &&
+        CPLTestBool(CPLGetConfigOption("OPENFILEGDB_USE_SPATIAL_INDEX", "YES")))
+    {
+        return FileGDBSpatialIndexIterator::Build(m_poLyrTable, sEnvelope);
+    }
+    return nullptr;
+}
+
 /***********************************************************************/
 /*                          GetMinMaxValue()                           */
 /***********************************************************************/
@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Project:  OGR Core
+ * Purpose:  Test performance of OGRSimpleCurve coordinate kernels
+ *           (envelope, length, area, swapXY, WKB import/export)
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogr_geometry.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+constexpr int N_POINTS = 1000 * 1000 + 1;
+constexpr int N_ITERS = 100;
+
+template <class Func> static void Bench(const char *pszName, Func func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < N_ITERS; ++i)
+        func();
+    const auto end = std::chrono::steady_clock::now();
+    printf("%s: %.3f ms/iter\n", pszName,
+           std::chrono::duration<double, std::milli>(end - start).count() /
+               N_ITERS);
+}
+
+int main(int /* argc */, char * /* argv */[])
+{
+    OGRLinearRing oRing;
+    oRing.setNumPoints(N_POINTS, false);
+    for (int i = 0; i < N_POINTS; ++i)
+    {
+        const double dfAngle = 2 * M_PI * i / (N_POINTS - 1);
+        oRing.setPoint(i, 1000 * cos(dfAngle), 1000 * sin(dfAngle));
+    }
+    oRing.setPoint(N_POINTS - 1, oRing.getX(0), oRing.getY(0));
+
+    double dfAccum = 0;
+
+    Bench("getEnvelope(OGREnvelope)",
+          [&oRing, &dfAccum]()
+          {
+              OGREnvelope sEnvelope;
+              oRing.getEnvelope(&sEnvelope);
+              dfAccum += sEnvelope.MaxX;
+          });
+
+    Bench("get_Length()",
+          [&oRing, &dfAccum]() { dfAccum += oRing.get_Length(); });
+
+    Bench("get_Area()", [&oRing, &dfAccum]() { dfAccum += oRing.get_Area(); });
+
+    Bench("swapXY()", [&oRing]() { oRing.swapXY(); });
+
+    for (const OGRwkbByteOrder eByteOrder : {wkbNDR, wkbXDR})
+    {
+        OGRLineString oLS(oRing);
+        std::vector<GByte> abyWKB(oLS.WkbSize());
+        OGRwkbExportOptions sOptions;
+        sOptions.eByteOrder = eByteOrder;
+        sOptions.eWkbVariant = wkbVariantIso;
+        Bench(eByteOrder == wkbNDR ? "exportToWkb(NDR)" : "exportToWkb(XDR)",
+              [&oLS, &abyWKB, &sOptions]()
+              { oLS.exportToWkb(abyWKB.data(), &sOptions); });
+
+        OGRLineString oLSOut;
+        Bench(eByteOrder == wkbNDR ? "importFromWkb(NDR)"
+                                   : "importFromWkb(XDR)",
+              [&oLSOut, &abyWKB]()
+              {
+                  size_t nBytesConsumed = 0;
+                  oLSOut.importFromWkb(abyWKB.data(), abyWKB.size(),
+                                       wkbVariantIso, nBytesConsumed);
+              });
+        dfAccum += oLSOut.getX(0);
+    }
+
+    // Prevent the compiler from optimizing away the calls
+    printf("(checksum: %f)\n", dfAccum);
+
+    return 0;
+}